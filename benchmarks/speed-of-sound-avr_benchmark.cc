@@ -0,0 +1,157 @@
+// Firmware that measures the cycles taken by the core API on an AVR, for
+// running under simavr (see tools/avr-benchmark). Timer 1 counts every CPU
+// cycle and its overflow interrupt extends it to 32 bits, adding the few
+// dozen cycles of the handler every 65536 cycles. Each API is called
+// once per input, and USART0 gets one line per API:
+//   cycles <name> <min> <mean> <max>
+// followed by "done", after which the firmware sleeps with interrupts
+// disabled, which ends the simulation.
+
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include <avr/sleep.h>
+#include <stdint.h>
+
+#include "speed-of-sound-bound.h"
+#include "speed-of-sound-fixed.h"
+#include "speed-of-sound-incremental.h"
+#include "speed-of-sound.h"
+
+namespace {
+
+// Spread over the valid range, so that the soft-float paths that depend on
+// the operands are all taken
+const uint8_t kInputCount = 8;
+const speedofsound::Environment kInputs[kInputCount] = {
+    {0.0, 0.0, 75000.0, 0.0},        {4.3, 0.9, 101325.0, 0.0004},
+    {8.6, 0.3, 82000.0, 0.0099},     {12.9, 0.6, 95000.0, 0.002},
+    {17.1, 1.0, 78000.0, 0.0007},    {21.4, 0.1, 102000.0, 0.005},
+    {25.7, 0.75, 89000.0, 0.0003},   {30.0, 0.45, 99000.0, 0.008}};
+
+volatile uint16_t overflows = 0;
+volatile double sink = 0.0;
+volatile int32_t fixed_sink = 0;
+
+auto Cycles() -> uint32_t {
+  const auto sreg = SREG;
+  cli();
+  const uint16_t low = TCNT1;
+  uint16_t high = overflows;
+  // An overflow between the reads that the interrupt has not counted yet
+  if ((TIFR1 & _BV(TOV1)) != 0 && low < 0x8000) ++high;
+  SREG = sreg;
+  return (static_cast<uint32_t>(high) << 16) | low;
+}
+
+// Clears the transmit-complete flag, so that it is only set again once the
+// last character written has left
+auto Put(const char c) -> void {
+  while ((UCSR0A & _BV(UDRE0)) == 0) {
+  }
+  UCSR0A |= _BV(TXC0);
+  UDR0 = c;
+}
+
+auto Put(const char* s) -> void {
+  while (*s != '\0') Put(*s++);
+}
+
+auto Put(uint32_t value) -> void {
+  char digits[10];
+  uint8_t count = 0;
+  do {
+    digits[count++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  while (count > 0) Put(digits[--count]);
+}
+
+// Cycles of the calls between two reads of the counter with nothing between
+// them, subtracted from every measurement
+uint32_t overhead = 0;
+
+template <typename Call>
+auto Measure(const char* name, const Call& call) -> void {
+  uint32_t min = 0xffffffff;
+  uint32_t max = 0;
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < kInputCount; ++i) {
+    const auto start = Cycles();
+    call(i);
+    const auto cycles = Cycles() - start - overhead;
+    min = cycles < min ? cycles : min;
+    max = cycles > max ? cycles : max;
+    total += cycles;
+  }
+  Put("cycles ");
+  Put(name);
+  Put(' ');
+  Put(min);
+  Put(' ');
+  Put((total + kInputCount / 2) / kInputCount);
+  Put(' ');
+  Put(max);
+  Put('\n');
+}
+
+}  // namespace
+
+ISR(TIMER1_OVF_vect) { overflows = overflows + 1; }
+
+auto main() -> int {
+  UBRR0 = 0;
+  UCSR0B = _BV(TXEN0);
+  TCCR1A = 0;
+  TCCR1B = _BV(CS10);
+  TIMSK1 = _BV(TOIE1);
+  sei();
+
+  const auto start = Cycles();
+  overhead = Cycles() - start;
+
+  speedofsound::FixedEnvironment fixed_inputs[kInputCount];
+  for (uint8_t i = 0; i < kInputCount; ++i) {
+    fixed_inputs[i] = speedofsound::ToFixedEnvironment(kInputs[i]);
+  }
+  speedofsound::SpeedOfSound speed_of_sound;
+  const speedofsound::FixedSpeedOfSound fixed_speed_of_sound;
+  speedofsound::IncrementalSpeedOfSound incremental;
+  speedofsound::EnvironmentRate rate;
+  const speedofsound::TemperatureBoundSpeedOfSound temperature_bound(
+      kInputs[0]);
+
+  Measure("Compute", [&](const uint8_t i) {
+    sink = speed_of_sound.Compute(kInputs[i]);
+  });
+  Measure("ComputeRate", [&](const uint8_t i) {
+    sink = speed_of_sound.ComputeRate(kInputs[i], &rate);
+  });
+  Measure("QuickCompute", [&](const uint8_t i) {
+    sink = speed_of_sound.QuickCompute(kInputs[i]);
+  });
+  Measure("Approximate", [&](const uint8_t i) {
+    sink = speed_of_sound.Approximate(kInputs[i]);
+  });
+  // Only the humidity changes, so Psv is not evaluated again
+  Measure("IncrementalHumidity", [&](const uint8_t i) {
+    incremental.SetHumidity(kInputs[i].humidity_);
+    sink = incremental.GetSpeedOfSound();
+  });
+  Measure("TemperatureBound", [&](const uint8_t i) {
+    sink = temperature_bound.QuickCompute(kInputs[i]);
+  });
+  Measure("FixedQuickCompute", [&](const uint8_t i) {
+    fixed_sink = speedofsound::FixedQuickCompute(fixed_inputs[i]);
+  });
+  Measure("FixedApproximate", [&](const uint8_t i) {
+    fixed_sink = fixed_speed_of_sound.Approximate(fixed_inputs[i]);
+  });
+  Put("done\n");
+
+  while ((UCSR0A & _BV(TXC0)) == 0) {
+  }
+  cli();
+  sleep_enable();
+  sleep_cpu();
+  return 0;
+}
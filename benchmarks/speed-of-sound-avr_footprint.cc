@@ -0,0 +1,75 @@
+// Firmware that calls a single API, selected by defining one of
+//   SPEED_OF_SOUND_AVR_NONE, SPEED_OF_SOUND_AVR_COMPUTE, ...
+// Its size less that of the SPEED_OF_SOUND_AVR_NONE build is the flash and
+// RAM the API pulls in, including the soft-float routines it needs (see
+// tools/avr-benchmark). The input is volatile, so nothing is folded away.
+
+#include <stdint.h>
+
+#include "speed-of-sound-bound.h"
+#include "speed-of-sound-fixed.h"
+#include "speed-of-sound-incremental.h"
+#include "speed-of-sound.h"
+
+namespace {
+
+volatile double input = 20.0;
+volatile int32_t fixed_input = 1310720;
+volatile double sink = 0.0;
+volatile int32_t fixed_sink = 0;
+
+}  // namespace
+
+auto main() -> int {
+  speedofsound::Environment environment;
+  environment.temperature_ = input;
+  speedofsound::FixedEnvironment fixed_environment;
+  fixed_environment.temperature_ = fixed_input;
+#if defined(SPEED_OF_SOUND_AVR_NONE)
+  sink = environment.temperature_;
+  fixed_sink = fixed_environment.temperature_;
+#elif defined(SPEED_OF_SOUND_AVR_COMPUTE)
+  speedofsound::SpeedOfSound speed_of_sound(environment);
+  sink = speed_of_sound.GetInitSpeedOfSound();
+#elif defined(SPEED_OF_SOUND_AVR_COMPUTE_RATE)
+  const speedofsound::SpeedOfSound speed_of_sound(
+      speedofsound::Environment(), 343.0, speedofsound::EnvironmentRate(),
+      speedofsound::EnvironmentCurvature(),
+      speedofsound::ApproximationOrder::kLinear);
+  speedofsound::EnvironmentRate rate;
+  sink = speed_of_sound.ComputeRate(environment, &rate);
+#elif defined(SPEED_OF_SOUND_AVR_QUICK_COMPUTE)
+  const speedofsound::SpeedOfSound speed_of_sound(
+      speedofsound::Environment(), 343.0, speedofsound::EnvironmentRate(),
+      speedofsound::EnvironmentCurvature(),
+      speedofsound::ApproximationOrder::kLinear);
+  sink = speed_of_sound.QuickCompute(environment);
+#elif defined(SPEED_OF_SOUND_AVR_APPROXIMATE)
+  // A linearization restored without Compute, as firmware would embed one
+  const speedofsound::SpeedOfSound speed_of_sound(
+      speedofsound::Environment(), 343.0,
+      speedofsound::EnvironmentRate(0.6, 1.5, 1.0e-6, -85.0),
+      speedofsound::EnvironmentCurvature(),
+      speedofsound::ApproximationOrder::kLinear);
+  sink = speed_of_sound.Approximate(environment);
+#elif defined(SPEED_OF_SOUND_AVR_INCREMENTAL)
+  speedofsound::IncrementalSpeedOfSound incremental;
+  incremental.SetTemperature(environment.temperature_);
+  sink = incremental.GetSpeedOfSound();
+#elif defined(SPEED_OF_SOUND_AVR_TEMPERATURE_BOUND)
+  const speedofsound::TemperatureBoundSpeedOfSound temperature_bound(
+      environment);
+  sink = temperature_bound.QuickCompute(environment);
+#elif defined(SPEED_OF_SOUND_AVR_FIXED_QUICK_COMPUTE)
+  fixed_sink = speedofsound::FixedQuickCompute(fixed_environment);
+#elif defined(SPEED_OF_SOUND_AVR_FIXED_APPROXIMATE)
+  const speedofsound::FixedSpeedOfSound speed_of_sound(
+      speedofsound::FixedEnvironment(), static_cast<int64_t>(343) << 32,
+      speedofsound::FixedEnvironmentRate(651561165, 387441430, 16038212,
+                                         -1429934080));
+  fixed_sink = speed_of_sound.Approximate(fixed_environment);
+#else
+#error "Define the API to measure, e.g. SPEED_OF_SOUND_AVR_NONE"
+#endif
+  return 0;
+}
@@ -0,0 +1,103 @@
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+
+#include "speed-of-sound-concurrent.h"
+#include "speed-of-sound-memo.h"
+
+namespace {
+
+const speedofsound::Environment kQuery(15.0, 0.6, 95000.0, 0.001);
+const speedofsound::Environment kColdEnvironment(2.0, 0.2, 80000.0, 0.0002);
+const speedofsound::Environment kWarmEnvironment(28.0, 0.9, 101000.0, 0.008);
+
+// Publishes new linearization points back to back until stopped, the worst
+// case for readers
+class Writer {
+ public:
+  template <typename Publish>
+  explicit Writer(Publish publish)
+      : stop_(false), thread_([this, publish] {
+          for (auto i = 0; !stop_; ++i) {
+            publish(i % 2 == 0 ? kWarmEnvironment : kColdEnvironment);
+          }
+        }) {}
+  ~Writer() {
+    stop_ = true;
+    thread_.join();
+  }
+
+ private:
+  std::atomic<bool> stop_;
+  std::thread thread_;
+};
+
+speedofsound::ConcurrentSpeedOfSound concurrent;
+
+// Argument 0 is 1 with a writer thread running
+auto BM_ConcurrentApproximate(benchmark::State& state) -> void {
+  Writer* writer = nullptr;
+  if (state.thread_index() == 0 && state.range(0)) {
+    writer = new Writer([](const speedofsound::Environment& environment) {
+      concurrent.Compute(environment);
+    });
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(concurrent.Approximate(kQuery));
+  }
+  delete writer;
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConcurrentApproximate)
+    ->ArgName("writer")
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, 4)
+    ->UseRealTime();
+
+// The same with a mutex around a plain SpeedOfSound, for comparison
+std::mutex mutex;
+speedofsound::SpeedOfSound locked;
+
+auto BM_MutexApproximate(benchmark::State& state) -> void {
+  Writer* writer = nullptr;
+  if (state.thread_index() == 0 && state.range(0)) {
+    writer = new Writer([](const speedofsound::Environment& environment) {
+      const speedofsound::SpeedOfSound speed_of_sound(environment);
+      std::lock_guard<std::mutex> lock(mutex);
+      locked = speed_of_sound;
+    });
+  }
+  for (auto _ : state) {
+    std::lock_guard<std::mutex> lock(mutex);
+    benchmark::DoNotOptimize(locked.Approximate(kQuery));
+  }
+  delete writer;
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MutexApproximate)
+    ->ArgName("writer")
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, 4)
+    ->UseRealTime();
+
+// Each thread cycles through its own readings, all of which fit in the cache
+speedofsound::ShardedMemoizedSpeedOfSound sharded(16, 1 << 16);
+
+auto BM_ShardedMemoizedQuickCompute(benchmark::State& state) -> void {
+  const auto offset = 1000 * state.thread_index();
+  int i = 0;
+  for (auto _ : state) {
+    const speedofsound::Environment reading(
+        15.0 + 0.01 * (offset + i), 0.6, 95000.0, 0.001);
+    benchmark::DoNotOptimize(sharded.QuickCompute(reading));
+    i = (i + 1) % 1000;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ShardedMemoizedQuickCompute)->ThreadRange(1, 4)->UseRealTime();
+
+}  // namespace
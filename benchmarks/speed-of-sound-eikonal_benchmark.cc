@@ -0,0 +1,67 @@
+#include <math.h>
+
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "speed-of-sound-eikonal.h"
+
+namespace {
+
+// 10^7 cells, 2 cm apart: a 4.3 m x 4.3 m x 10.8 m tunnel section
+const speedofsound::GridShape kShape(215, 215, 541, 0.02);
+
+// Temperature rising along the tunnel and humidity varying across it
+class Grid {
+ public:
+  Grid()
+      : temperature_(kShape.Cells()),
+        humidity_(kShape.Cells()),
+        pressure_(kShape.Cells(), 101325.0),
+        co2_mole_fraction_(kShape.Cells(), 0.0004),
+        travel_time_(kShape.Cells()) {
+    for (size_t i = 0; i < kShape.Cells(); ++i) {
+      const auto x = i % kShape.x_size_;
+      const auto z = i / (kShape.x_size_ * kShape.y_size_);
+      temperature_[i] = 30.0 * z / (kShape.z_size_ - 1);
+      humidity_[i] = 0.5 + 0.4 * sin(0.1 * x);
+    }
+  }
+  auto Arrays() const -> speedofsound::EnvironmentArrays {
+    return speedofsound::EnvironmentArrays(
+        temperature_.data(), humidity_.data(), pressure_.data(),
+        co2_mole_fraction_.data());
+  }
+
+  std::vector<double> temperature_, humidity_, pressure_, co2_mole_fraction_;
+  std::vector<double> travel_time_;
+};
+
+auto SharedGrid() -> Grid* {
+  static Grid grid;
+  return &grid;
+}
+
+auto BM_EikonalSolve(benchmark::State& state) -> void {
+  auto grid = SharedGrid();
+  speedofsound::ThreadPool pool(state.range(0));
+  speedofsound::EikonalSolver solver(&pool);
+  for (auto _ : state) {
+    solver.SetEnvironment(kShape, grid->Arrays());
+    solver.Solve(kShape.x_size_ / 2, kShape.y_size_ / 2, 0,
+                 grid->travel_time_.data());
+    benchmark::DoNotOptimize(grid->travel_time_.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kShape.Cells());
+  state.counters["threads"] = state.range(0);
+  state.counters["iterations"] = solver.GetIterationCount();
+}
+BENCHMARK(BM_EikonalSolve)
+    ->Arg(1)
+    ->Arg(std::max<int>(1, std::thread::hardware_concurrency()))
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,125 @@
+// The loops of BM_CLoop, BM_QuickComputeLoop and BM_ApproximateLoop with the
+// model defined in the headers, as in the HEADER_ONLY build, so that the
+// compiler inlines it into the loop. Compare them to see the cost of calling
+// into the library.
+#ifndef SPEED_OF_SOUND_HEADER_ONLY
+#define SPEED_OF_SOUND_HEADER_ONLY
+#endif
+
+#include <chrono>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "environment.h"
+#include "speed-of-sound-theory.h"
+#include "speed-of-sound.h"
+
+namespace {
+
+const size_t kCount = 4096;
+
+// The sequential inputs of speed-of-sound_benchmark.cc
+class Inputs {
+ public:
+  Inputs()
+      : temperature_(kCount),
+        pressure_(kCount),
+        co2_mole_fraction_(kCount),
+        xw_(kCount),
+        speed_of_sound_(kCount) {
+    using speedofsound::theory::kMaxCO2MoleFraction;
+    using speedofsound::theory::kMaxHumidity;
+    using speedofsound::theory::kMaxPressure;
+    using speedofsound::theory::kMaxTemperature;
+    using speedofsound::theory::kMinCO2MoleFraction;
+    using speedofsound::theory::kMinHumidity;
+    using speedofsound::theory::kMinPressure;
+    using speedofsound::theory::kMinTemperature;
+    for (size_t i = 0; i < kCount; ++i) {
+      const auto fraction = static_cast<double>(i) / (kCount - 1);
+      temperature_[i] =
+          kMinTemperature + (kMaxTemperature - kMinTemperature) * fraction;
+      const auto humidity =
+          kMaxHumidity - (kMaxHumidity - kMinHumidity) * fraction;
+      pressure_[i] = kMinPressure + (kMaxPressure - kMinPressure) * fraction;
+      co2_mole_fraction_[i] =
+          kMinCO2MoleFraction +
+          (kMaxCO2MoleFraction - kMinCO2MoleFraction) * fraction;
+      environment_.push_back(speedofsound::Environment(
+          temperature_[i], humidity, pressure_[i], co2_mole_fraction_[i]));
+      xw_[i] = speedofsound::theory::Xw(
+          humidity, speedofsound::theory::F(pressure_[i], temperature_[i]),
+          speedofsound::theory::Psv(speedofsound::theory::T(temperature_[i])),
+          pressure_[i]);
+    }
+  }
+
+  std::vector<double> temperature_, pressure_, co2_mole_fraction_, xw_;
+  std::vector<speedofsound::Environment> environment_;
+  std::vector<double> speed_of_sound_;
+};
+
+auto SharedInputs() -> Inputs* {
+  static Inputs inputs;
+  return &inputs;
+}
+
+using Clock = std::chrono::steady_clock;
+
+auto SetCallCounters(benchmark::State& state, const Clock::time_point start)
+    -> void {
+  const auto calls = static_cast<double>(state.iterations() * kCount);
+  const auto ns = std::chrono::duration<double, std::nano>(Clock::now() - start)
+                      .count();
+  state.SetItemsProcessed(static_cast<int64_t>(calls));
+  state.counters["ns/call"] = ns / calls;
+}
+
+auto BM_InlineCLoop(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs();
+  auto* out = inputs->speed_of_sound_.data();
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; ++i) {
+      out[i] = speedofsound::theory::C(
+          inputs->temperature_[i], inputs->pressure_[i], inputs->xw_[i],
+          inputs->co2_mole_fraction_[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+  SetCallCounters(state, start);
+}
+BENCHMARK(BM_InlineCLoop);
+
+auto BM_InlineQuickComputeLoop(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs();
+  const speedofsound::SpeedOfSound speed_of_sound;
+  auto* out = inputs->speed_of_sound_.data();
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; ++i) {
+      out[i] = speed_of_sound.QuickCompute(inputs->environment_[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+  SetCallCounters(state, start);
+}
+BENCHMARK(BM_InlineQuickComputeLoop);
+
+auto BM_InlineApproximateLoop(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs();
+  const speedofsound::SpeedOfSound speed_of_sound;
+  auto* out = inputs->speed_of_sound_.data();
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; ++i) {
+      out[i] = speed_of_sound.Approximate(inputs->environment_[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+  SetCallCounters(state, start);
+}
+BENCHMARK(BM_InlineApproximateLoop);
+
+}  // namespace
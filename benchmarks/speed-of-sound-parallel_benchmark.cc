@@ -0,0 +1,84 @@
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "speed-of-sound-parallel.h"
+#include "speed-of-sound-theory.h"
+
+namespace {
+
+const size_t kCount = 1 << 22;
+
+// Environments spread over the valid range, shared by every benchmark
+class Batch {
+ public:
+  Batch()
+      : temperature_(kCount),
+        humidity_(kCount),
+        pressure_(kCount),
+        co2_mole_fraction_(kCount),
+        speed_of_sound_(kCount) {
+    using speedofsound::theory::kMaxCO2MoleFraction;
+    using speedofsound::theory::kMaxHumidity;
+    using speedofsound::theory::kMaxPressure;
+    using speedofsound::theory::kMaxTemperature;
+    using speedofsound::theory::kMinCO2MoleFraction;
+    using speedofsound::theory::kMinHumidity;
+    using speedofsound::theory::kMinPressure;
+    using speedofsound::theory::kMinTemperature;
+    for (size_t i = 0; i < kCount; ++i) {
+      temperature_[i] = kMinTemperature + (kMaxTemperature - kMinTemperature) *
+                                              (i % 1021) / 1020.0;
+      humidity_[i] =
+          kMinHumidity + (kMaxHumidity - kMinHumidity) * (i % 101) / 100.0;
+      pressure_[i] =
+          kMinPressure + (kMaxPressure - kMinPressure) * (i % 97) / 96.0;
+      co2_mole_fraction_[i] =
+          kMinCO2MoleFraction +
+          (kMaxCO2MoleFraction - kMinCO2MoleFraction) * (i % 13) / 12.0;
+    }
+  }
+  auto Arrays() const -> speedofsound::EnvironmentArrays {
+    return speedofsound::EnvironmentArrays(
+        temperature_.data(), humidity_.data(), pressure_.data(),
+        co2_mole_fraction_.data());
+  }
+
+  std::vector<double> temperature_, humidity_, pressure_, co2_mole_fraction_;
+  std::vector<double> speed_of_sound_;
+};
+
+auto SharedBatch() -> Batch* {
+  static Batch batch;
+  return &batch;
+}
+
+// Throughput against thread count: powers of two up to the hardware threads
+auto ThreadCounts(benchmark::internal::Benchmark* benchmark) -> void {
+  const auto hardware_threads =
+      std::max<int>(1, std::thread::hardware_concurrency());
+  for (int threads = 1; threads < hardware_threads; threads *= 2) {
+    benchmark->Arg(threads);
+  }
+  benchmark->Arg(hardware_threads);
+}
+
+auto BM_ParallelQuickComputeBatch(benchmark::State& state) -> void {
+  auto batch = SharedBatch();
+  speedofsound::ThreadPool pool(state.range(0));
+  for (auto _ : state) {
+    speedofsound::ParallelQuickComputeBatch(&pool, batch->Arrays(), kCount,
+                                            batch->speed_of_sound_.data());
+    benchmark::DoNotOptimize(batch->speed_of_sound_.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+  state.counters["threads"] = state.range(0);
+}
+BENCHMARK(BM_ParallelQuickComputeBatch)
+    ->Apply(ThreadCounts)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
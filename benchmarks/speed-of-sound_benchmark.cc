@@ -0,0 +1,483 @@
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "speed-of-sound-adaptive.h"
+#include "speed-of-sound-anchored.h"
+#include "speed-of-sound-batch.h"
+#include "speed-of-sound-bound.h"
+#include "speed-of-sound-fixed.h"
+#include "speed-of-sound-incremental.h"
+#include "speed-of-sound-memo.h"
+#include "speed-of-sound-theory.h"
+#include "speed-of-sound.h"
+
+namespace {
+
+// A power of two, so that single-call benchmarks can wrap with a mask
+const size_t kCount = 4096;
+
+// Environments in the valid range, either slowly drifting like a sensor
+// stream or drawn at random, so that branches and the adaptive cache see
+// both the friendly and the hostile case
+class Inputs {
+ public:
+  explicit Inputs(const bool random)
+      : temperature_(kCount),
+        humidity_(kCount),
+        pressure_(kCount),
+        co2_mole_fraction_(kCount),
+        speed_of_sound_(kCount),
+        float_speed_of_sound_(kCount),
+        rate_(4, std::vector<double>(kCount)) {
+    using speedofsound::theory::kMaxCO2MoleFraction;
+    using speedofsound::theory::kMaxHumidity;
+    using speedofsound::theory::kMaxPressure;
+    using speedofsound::theory::kMaxTemperature;
+    using speedofsound::theory::kMinCO2MoleFraction;
+    using speedofsound::theory::kMinHumidity;
+    using speedofsound::theory::kMinPressure;
+    using speedofsound::theory::kMinTemperature;
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    for (size_t i = 0; i < kCount; ++i) {
+      double fraction[4];
+      for (auto j = 0; j < 4; ++j) {
+        fraction[j] = random ? uniform(generator)
+                             : static_cast<double>(i) / (kCount - 1);
+      }
+      temperature_[i] =
+          kMinTemperature + (kMaxTemperature - kMinTemperature) * fraction[0];
+      humidity_[i] =
+          kMaxHumidity - (kMaxHumidity - kMinHumidity) * fraction[1];
+      pressure_[i] = kMinPressure + (kMaxPressure - kMinPressure) * fraction[2];
+      co2_mole_fraction_[i] =
+          kMinCO2MoleFraction +
+          (kMaxCO2MoleFraction - kMinCO2MoleFraction) * fraction[3];
+      float_temperature_.push_back(static_cast<float>(temperature_[i]));
+      float_humidity_.push_back(static_cast<float>(humidity_[i]));
+      float_pressure_.push_back(static_cast<float>(pressure_[i]));
+      float_co2_mole_fraction_.push_back(
+          static_cast<float>(co2_mole_fraction_[i]));
+      environment_.push_back(speedofsound::Environment(
+          temperature_[i], humidity_[i], pressure_[i], co2_mole_fraction_[i]));
+      fixed_environment_.push_back(
+          speedofsound::ToFixedEnvironment(environment_.back()));
+      thermodynamic_temperature_.push_back(
+          speedofsound::theory::T(temperature_[i]));
+      xw_.push_back(speedofsound::theory::Xw(
+          humidity_[i], speedofsound::theory::F(pressure_[i], temperature_[i]),
+          speedofsound::theory::Psv(thermodynamic_temperature_[i]),
+          pressure_[i]));
+    }
+  }
+  auto Arrays() const -> speedofsound::EnvironmentArrays {
+    return speedofsound::EnvironmentArrays(
+        temperature_.data(), humidity_.data(), pressure_.data(),
+        co2_mole_fraction_.data());
+  }
+  auto FloatArrays() const -> speedofsound::FloatEnvironmentArrays {
+    return speedofsound::FloatEnvironmentArrays(
+        float_temperature_.data(), float_humidity_.data(),
+        float_pressure_.data(), float_co2_mole_fraction_.data());
+  }
+  auto RateArrays() -> speedofsound::EnvironmentRateArrays {
+    return speedofsound::EnvironmentRateArrays(
+        rate_[0].data(), rate_[1].data(), rate_[2].data(), rate_[3].data());
+  }
+
+  std::vector<double> temperature_, humidity_, pressure_, co2_mole_fraction_;
+  std::vector<float> float_temperature_, float_humidity_, float_pressure_,
+      float_co2_mole_fraction_;
+  std::vector<speedofsound::Environment> environment_;
+  std::vector<speedofsound::FixedEnvironment> fixed_environment_;
+  std::vector<double> thermodynamic_temperature_, xw_;
+  std::vector<double> speed_of_sound_;
+  std::vector<float> float_speed_of_sound_;
+  std::vector<std::vector<double>> rate_;
+};
+
+// Argument 0 selects the inputs: 0 for sequential, 1 for random
+auto SharedInputs(const benchmark::State& state) -> Inputs* {
+  static Inputs sequential(false);
+  static Inputs random(true);
+  return state.range(0) ? &random : &sequential;
+}
+
+using Clock = std::chrono::steady_clock;
+
+// ns/call and cycles/call from the wall time since start and the nominal
+// clock rate of the host, as plain numbers rather than inverted rates, which
+// the console would print in seconds; calls are single evaluations, so a
+// batch counts its elements
+auto SetCallCounters(benchmark::State& state, const Clock::time_point start,
+                     const size_t calls_per_iteration) -> void {
+  const auto calls =
+      static_cast<double>(state.iterations() * calls_per_iteration);
+  const auto ns = std::chrono::duration<double, std::nano>(Clock::now() - start)
+                      .count();
+  const auto cycles_per_second = benchmark::CPUInfo::Get().cycles_per_second;
+  state.SetItemsProcessed(static_cast<int64_t>(calls));
+  state.counters["ns/call"] = ns / calls;
+  state.counters["cycles/call"] = ns * 1.0e-9 * cycles_per_second / calls;
+}
+
+auto BM_Psv(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  size_t i = 0;
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        speedofsound::theory::Psv(inputs->thermodynamic_temperature_[i]));
+    i = (i + 1) & (kCount - 1);
+  }
+  SetCallCounters(state, start, 1);
+}
+BENCHMARK(BM_Psv)->ArgName("random")->Arg(0)->Arg(1);
+
+auto BM_C(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  size_t i = 0;
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(speedofsound::theory::C(
+        inputs->temperature_[i], inputs->pressure_[i], inputs->xw_[i],
+        inputs->co2_mole_fraction_[i]));
+    i = (i + 1) & (kCount - 1);
+  }
+  SetCallCounters(state, start, 1);
+}
+BENCHMARK(BM_C)->ArgName("random")->Arg(0)->Arg(1);
+
+// Compute also moves the linearization point, as it does in use
+auto BM_Compute(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  speedofsound::SpeedOfSound speed_of_sound;
+  size_t i = 0;
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(speed_of_sound.Compute(inputs->environment_[i]));
+    i = (i + 1) & (kCount - 1);
+  }
+  SetCallCounters(state, start, 1);
+}
+BENCHMARK(BM_Compute)->ArgName("random")->Arg(0)->Arg(1);
+
+auto BM_ComputeRate(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  const speedofsound::SpeedOfSound speed_of_sound;
+  speedofsound::EnvironmentRate rate;
+  size_t i = 0;
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        speed_of_sound.ComputeRate(inputs->environment_[i], &rate));
+    benchmark::DoNotOptimize(rate);
+    i = (i + 1) & (kCount - 1);
+  }
+  SetCallCounters(state, start, 1);
+}
+BENCHMARK(BM_ComputeRate)->ArgName("random")->Arg(0)->Arg(1);
+
+auto BM_QuickCompute(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  const speedofsound::SpeedOfSound speed_of_sound;
+  size_t i = 0;
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        speed_of_sound.QuickCompute(inputs->environment_[i]));
+    i = (i + 1) & (kCount - 1);
+  }
+  SetCallCounters(state, start, 1);
+}
+BENCHMARK(BM_QuickCompute)->ArgName("random")->Arg(0)->Arg(1);
+
+auto BM_Approximate(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  const speedofsound::SpeedOfSound speed_of_sound;
+  size_t i = 0;
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        speed_of_sound.Approximate(inputs->environment_[i]));
+    i = (i + 1) & (kCount - 1);
+  }
+  SetCallCounters(state, start, 1);
+}
+BENCHMARK(BM_Approximate)->ArgName("random")->Arg(0)->Arg(1);
+
+// Tight loops over the sequential inputs, calling into the library unless
+// it is built with HEADER_ONLY or ENABLE_LTO. The same loops with the model
+// inlined are in speed-of-sound-inline_benchmark.cc.
+auto BM_CLoop(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  auto* out = inputs->speed_of_sound_.data();
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; ++i) {
+      out[i] = speedofsound::theory::C(
+          inputs->temperature_[i], inputs->pressure_[i], inputs->xw_[i],
+          inputs->co2_mole_fraction_[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+  SetCallCounters(state, start, kCount);
+}
+BENCHMARK(BM_CLoop)->ArgName("random")->Arg(0);
+
+auto BM_QuickComputeLoop(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  const speedofsound::SpeedOfSound speed_of_sound;
+  auto* out = inputs->speed_of_sound_.data();
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; ++i) {
+      out[i] = speed_of_sound.QuickCompute(inputs->environment_[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+  SetCallCounters(state, start, kCount);
+}
+BENCHMARK(BM_QuickComputeLoop)->ArgName("random")->Arg(0);
+
+auto BM_ApproximateLoop(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  const speedofsound::SpeedOfSound speed_of_sound;
+  auto* out = inputs->speed_of_sound_.data();
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; ++i) {
+      out[i] = speed_of_sound.Approximate(inputs->environment_[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+  SetCallCounters(state, start, kCount);
+}
+BENCHMARK(BM_ApproximateLoop)->ArgName("random")->Arg(0);
+
+// Temperature bound for the frame; the other inputs vary per call
+auto BM_TemperatureBoundQuickCompute(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  const speedofsound::Environment standard;
+  const speedofsound::TemperatureBoundSpeedOfSound bound(standard);
+  size_t i = 0;
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bound.QuickCompute(inputs->environment_[i]));
+    i = (i + 1) & (kCount - 1);
+  }
+  SetCallCounters(state, start, 1);
+}
+BENCHMARK(BM_TemperatureBoundQuickCompute)
+    ->ArgName("random")
+    ->Arg(0)
+    ->Arg(1);
+
+// Temperature and pressure bound, as for the channels of one sensor
+auto BM_TemperaturePressureBoundQuickCompute(benchmark::State& state)
+    -> void {
+  const auto inputs = SharedInputs(state);
+  const speedofsound::Environment standard;
+  const speedofsound::BoundSpeedOfSound<speedofsound::kBoundTemperature |
+                                        speedofsound::kBoundPressure>
+      bound(standard);
+  size_t i = 0;
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bound.QuickCompute(inputs->environment_[i]));
+    i = (i + 1) & (kCount - 1);
+  }
+  SetCallCounters(state, start, 1);
+}
+BENCHMARK(BM_TemperaturePressureBoundQuickCompute)
+    ->ArgName("random")
+    ->Arg(0)
+    ->Arg(1);
+
+auto BM_FixedQuickCompute(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  size_t i = 0;
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        speedofsound::FixedQuickCompute(inputs->fixed_environment_[i]));
+    i = (i + 1) & (kCount - 1);
+  }
+  SetCallCounters(state, start, 1);
+}
+BENCHMARK(BM_FixedQuickCompute)->ArgName("random")->Arg(0)->Arg(1);
+
+auto BM_FixedApproximate(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  const speedofsound::FixedSpeedOfSound speed_of_sound;
+  size_t i = 0;
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        speed_of_sound.Approximate(inputs->fixed_environment_[i]));
+    i = (i + 1) & (kCount - 1);
+  }
+  SetCallCounters(state, start, 1);
+}
+BENCHMARK(BM_FixedApproximate)->ArgName("random")->Arg(0)->Arg(1);
+
+// Recomputes whenever the estimated error exceeds 0.01 m/s, so the cost
+// depends on how far successive inputs move
+auto BM_AdaptiveApproximate(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  speedofsound::AdaptiveSpeedOfSound speed_of_sound(0.01);
+  size_t i = 0;
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        speed_of_sound.Approximate(inputs->environment_[i]));
+    i = (i + 1) & (kCount - 1);
+  }
+  SetCallCounters(state, start, 1);
+  state.counters["recomputes"] = benchmark::Counter(
+      speed_of_sound.GetRecomputeCount(), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_AdaptiveApproximate)->ArgName("random")->Arg(0)->Arg(1);
+
+// Within 0.01 m/s everywhere; anchors are added during the first pass over
+// the inputs
+auto BM_AnchoredApproximate(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  speedofsound::AnchoredSpeedOfSound speed_of_sound(0.01);
+  size_t i = 0;
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        speed_of_sound.Approximate(inputs->environment_[i]));
+    i = (i + 1) & (kCount - 1);
+  }
+  SetCallCounters(state, start, 1);
+  state.counters["anchors"] = speed_of_sound.GetAnchorCount();
+}
+BENCHMARK(BM_AnchoredApproximate)->ArgName("random")->Arg(0)->Arg(1);
+
+// The inputs fit in the cache, so after the first pass every call hits
+auto BM_MemoizedQuickCompute(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  speedofsound::MemoizedSpeedOfSound memo(4 * kCount);
+  size_t i = 0;
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(memo.QuickCompute(inputs->environment_[i]));
+    i = (i + 1) & (kCount - 1);
+  }
+  SetCallCounters(state, start, 1);
+  state.counters["hit_rate"] = memo.GetStatistics().HitRate();
+}
+BENCHMARK(BM_MemoizedQuickCompute)->ArgName("random")->Arg(0)->Arg(1);
+
+// One input changes per call, the case IncrementalSpeedOfSound is for.
+// Argument 1 is the input that changes, in Environment order; argument 2 is
+// 1 to also take the rate, as Compute does.
+auto BM_IncrementalCompute(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  speedofsound::IncrementalSpeedOfSound speed_of_sound;
+  const auto input = state.range(1);
+  const auto with_rate = state.range(2) != 0;
+  size_t i = 0;
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    switch (input) {
+      case 0:
+        speed_of_sound.SetTemperature(inputs->temperature_[i]);
+        break;
+      case 1:
+        speed_of_sound.SetHumidity(inputs->humidity_[i]);
+        break;
+      case 2:
+        speed_of_sound.SetPressure(inputs->pressure_[i]);
+        break;
+      default:
+        speed_of_sound.SetCO2MoleFraction(inputs->co2_mole_fraction_[i]);
+    }
+    if (with_rate) {
+      benchmark::DoNotOptimize(speed_of_sound.GetEnvironmentRate());
+    } else {
+      benchmark::DoNotOptimize(speed_of_sound.GetSpeedOfSound());
+    }
+    i = (i + 1) & (kCount - 1);
+  }
+  SetCallCounters(state, start, 1);
+}
+BENCHMARK(BM_IncrementalCompute)
+    ->ArgNames({"random", "input", "rate"})
+    ->ArgsProduct({{0}, {0, 1, 2, 3}, {0, 1}});
+
+// Argument 1 is the BatchKernel; kernels the host lacks are skipped
+auto BatchArguments(benchmark::internal::Benchmark* benchmark) -> void {
+  benchmark->ArgNames({"random", "kernel"});
+  const speedofsound::BatchKernel kernels[] = {
+      speedofsound::BatchKernel::kScalar, speedofsound::BatchKernel::kSse2,
+      speedofsound::BatchKernel::kAvx2, speedofsound::BatchKernel::kAvx512};
+  for (const auto kernel : kernels) {
+    if (!speedofsound::BatchKernelSupported(kernel)) continue;
+    for (auto random = 0; random < 2; ++random) {
+      benchmark->Args({random, static_cast<int64_t>(kernel)});
+    }
+  }
+}
+
+auto BM_QuickComputeBatch(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  const auto kernel = static_cast<speedofsound::BatchKernel>(state.range(1));
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    speedofsound::QuickComputeBatch(inputs->Arrays(), kCount,
+                                    inputs->speed_of_sound_.data(), kernel);
+    benchmark::ClobberMemory();
+  }
+  SetCallCounters(state, start, kCount);
+}
+BENCHMARK(BM_QuickComputeBatch)->Apply(BatchArguments);
+
+auto BM_FloatQuickComputeBatch(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  const auto kernel = static_cast<speedofsound::BatchKernel>(state.range(1));
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    speedofsound::QuickComputeBatch(inputs->FloatArrays(), kCount,
+                                    inputs->float_speed_of_sound_.data(),
+                                    kernel);
+    benchmark::ClobberMemory();
+  }
+  SetCallCounters(state, start, kCount);
+}
+BENCHMARK(BM_FloatQuickComputeBatch)->Apply(BatchArguments);
+
+auto BM_ComputeRateBatch(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  const auto kernel = static_cast<speedofsound::BatchKernel>(state.range(1));
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    speedofsound::ComputeRateBatch(inputs->Arrays(), kCount,
+                                   inputs->speed_of_sound_.data(),
+                                   inputs->RateArrays(), kernel);
+    benchmark::ClobberMemory();
+  }
+  SetCallCounters(state, start, kCount);
+}
+BENCHMARK(BM_ComputeRateBatch)->Apply(BatchArguments);
+
+auto BM_FastPsvBatch(benchmark::State& state) -> void {
+  const auto inputs = SharedInputs(state);
+  const auto kernel = static_cast<speedofsound::BatchKernel>(state.range(1));
+  const auto start = Clock::now();
+  for (auto _ : state) {
+    speedofsound::FastPsvBatch(inputs->thermodynamic_temperature_.data(),
+                               kCount, inputs->speed_of_sound_.data(),
+                               nullptr, kernel);
+    benchmark::ClobberMemory();
+  }
+  SetCallCounters(state, start, kCount);
+}
+BENCHMARK(BM_FastPsvBatch)->Apply(BatchArguments);
+
+}  // namespace
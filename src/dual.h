@@ -0,0 +1,150 @@
+#ifndef DUAL_H_
+#define DUAL_H_
+
+#include "speed-of-sound-coefficients.h"
+
+namespace speedofsound {
+
+// Forward-mode automatic differentiation: a value and its partial derivatives
+// with respect to N inputs, propagated through every arithmetic operation
+template <typename Scalar, int N>
+class Dual {
+ public:
+  Dual() : value_(0), gradient_() {}
+  explicit Dual(const Scalar value) : value_(value), gradient_() {}
+  // The index-th input, i.e. a unit gradient
+  static auto Variable(const Scalar value, const int index) -> Dual {
+    Dual variable(value);
+    variable.gradient_[index] = 1;
+    return variable;
+  }
+  auto operator+=(const Dual& x) -> Dual& {
+    value_ += x.value_;
+    for (int i = 0; i < N; ++i) gradient_[i] += x.gradient_[i];
+    return *this;
+  }
+  auto operator+=(const Scalar x) -> Dual& {
+    value_ += x;
+    return *this;
+  }
+  auto operator-=(const Dual& x) -> Dual& {
+    value_ -= x.value_;
+    for (int i = 0; i < N; ++i) gradient_[i] -= x.gradient_[i];
+    return *this;
+  }
+  auto operator*=(const Dual& x) -> Dual& {
+    for (int i = 0; i < N; ++i) {
+      gradient_[i] = gradient_[i] * x.value_ + value_ * x.gradient_[i];
+    }
+    value_ *= x.value_;
+    return *this;
+  }
+  auto operator*=(const Scalar x) -> Dual& {
+    value_ *= x;
+    for (int i = 0; i < N; ++i) gradient_[i] *= x;
+    return *this;
+  }
+  Scalar value_;
+  Scalar gradient_[N];
+};
+
+// f(x) from f and df/dx evaluated at the value of x
+template <typename Scalar, int N>
+auto Chain(const Scalar f, const Scalar df_dx, const Dual<Scalar, N>& x)
+    -> Dual<Scalar, N> {
+  Dual<Scalar, N> y(f);
+  for (int i = 0; i < N; ++i) y.gradient_[i] = df_dx * x.gradient_[i];
+  return y;
+}
+
+template <typename Scalar, int N>
+auto operator-(const Dual<Scalar, N>& x) -> Dual<Scalar, N> {
+  return x * static_cast<Scalar>(-1);
+}
+
+template <typename Scalar, int N>
+auto operator+(Dual<Scalar, N> x, const Dual<Scalar, N>& y)
+    -> Dual<Scalar, N> {
+  return x += y;
+}
+
+template <typename Scalar, int N>
+auto operator+(Dual<Scalar, N> x, const Scalar y) -> Dual<Scalar, N> {
+  return x += y;
+}
+
+template <typename Scalar, int N>
+auto operator+(const Scalar x, Dual<Scalar, N> y) -> Dual<Scalar, N> {
+  return y += x;
+}
+
+template <typename Scalar, int N>
+auto operator-(Dual<Scalar, N> x, const Dual<Scalar, N>& y)
+    -> Dual<Scalar, N> {
+  return x -= y;
+}
+
+template <typename Scalar, int N>
+auto operator-(Dual<Scalar, N> x, const Scalar y) -> Dual<Scalar, N> {
+  return x += -y;
+}
+
+template <typename Scalar, int N>
+auto operator-(const Scalar x, const Dual<Scalar, N>& y) -> Dual<Scalar, N> {
+  return -y + x;
+}
+
+template <typename Scalar, int N>
+auto operator*(Dual<Scalar, N> x, const Dual<Scalar, N>& y)
+    -> Dual<Scalar, N> {
+  return x *= y;
+}
+
+template <typename Scalar, int N>
+auto operator*(Dual<Scalar, N> x, const Scalar y) -> Dual<Scalar, N> {
+  return x *= y;
+}
+
+template <typename Scalar, int N>
+auto operator*(const Scalar x, Dual<Scalar, N> y) -> Dual<Scalar, N> {
+  return y *= x;
+}
+
+template <typename Scalar, int N>
+auto operator/(const Dual<Scalar, N>& x, const Dual<Scalar, N>& y)
+    -> Dual<Scalar, N> {
+  const auto reciprocal = 1 / y.value_;
+  Dual<Scalar, N> quotient(x.value_ / y.value_);
+  for (int i = 0; i < N; ++i) {
+    quotient.gradient_[i] =
+        (x.gradient_[i] - quotient.value_ * y.gradient_[i]) * reciprocal;
+  }
+  return quotient;
+}
+
+template <typename Scalar, int N>
+auto operator/(const Dual<Scalar, N>& x, const Scalar y) -> Dual<Scalar, N> {
+  const auto reciprocal = 1 / y;
+  Dual<Scalar, N> quotient(x.value_ / y);
+  for (int i = 0; i < N; ++i) {
+    quotient.gradient_[i] = x.gradient_[i] * reciprocal;
+  }
+  return quotient;
+}
+
+template <typename Scalar, int N>
+auto operator/(const Scalar x, const Dual<Scalar, N>& y) -> Dual<Scalar, N> {
+  return Chain(x / y.value_, -x / (y.value_ * y.value_), y);
+}
+
+namespace theory {
+
+// Constants stay plain numbers instead of carrying a zero gradient
+template <typename Scalar, int N>
+class Coefficients<Dual<Scalar, N>> : public Coefficients<Scalar> {};
+
+}  // namespace theory
+
+}  // namespace speedofsound
+
+#endif  // DUAL_H_
@@ -0,0 +1,45 @@
+#ifndef ENVIRONMENT_INL_H_
+#define ENVIRONMENT_INL_H_
+
+#include "environment.h"
+
+#include "speed-of-sound-instrumentation.h"
+#include "speed-of-sound-theory.h"
+
+namespace speedofsound {
+
+template <typename Scalar>
+auto BasicEnvironment<Scalar>::ValidateTemperature() const -> bool {
+  return theory::kMinTemperature <= temperature_ &&
+         temperature_ <= theory::kMaxTemperature;
+}
+
+template <typename Scalar>
+auto BasicEnvironment<Scalar>::ValidateHumidity() const -> bool {
+  return theory::kMinHumidity <= humidity_ && humidity_ <= theory::kMaxHumidity;
+}
+
+template <typename Scalar>
+auto BasicEnvironment<Scalar>::ValidatePressure() const -> bool {
+  return theory::kMinPressure <= pressure_ && pressure_ <= theory::kMaxPressure;
+}
+
+template <typename Scalar>
+auto BasicEnvironment<Scalar>::ValidateCO2MoleFraction() const -> bool {
+  return theory::kMinCO2MoleFraction <= co2_mole_fraction_ &&
+         co2_mole_fraction_ <= theory::kMaxCO2MoleFraction;
+}
+
+template <typename Scalar>
+auto BasicEnvironment<Scalar>::ValidateEnvironment() const -> bool {
+  const auto valid = ValidateTemperature() && ValidateHumidity() &&
+                     ValidatePressure() && ValidateCO2MoleFraction();
+  if (!valid) {
+    SPEED_OF_SOUND_COUNT_INVALID_ENVIRONMENT();
+  }
+  return valid;
+}
+
+}  // namespace speedofsound
+
+#endif  // ENVIRONMENT_INL_H_
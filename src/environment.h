@@ -1,31 +1,113 @@
 #ifndef ENVIRONMENT_H_
 #define ENVIRONMENT_H_
 
+#include "speed-of-sound-theory.h"
+
 namespace speedofsound {
 
-class Environment {
+// Validation is defined in environment-inl.h and instantiated for float,
+// double and long double; SPEED_OF_SOUND_HEADER_ONLY includes it below
+template <typename Scalar>
+class BasicEnvironment {
  public:
-  Environment();
+  constexpr BasicEnvironment()
+      : temperature_(static_cast<Scalar>(theory::kStdTemperature)),
+        humidity_(static_cast<Scalar>(theory::kStdHumidity)),
+        pressure_(static_cast<Scalar>(theory::kStdPressure)),
+        co2_mole_fraction_(static_cast<Scalar>(theory::kStdCO2MoleFraction)) {}
+  constexpr BasicEnvironment(const Scalar temperature, const Scalar humidity,
+                             const Scalar pressure,
+                             const Scalar co2_mole_fraction)
+      : temperature_(temperature),
+        humidity_(humidity),
+        pressure_(pressure),
+        co2_mole_fraction_(co2_mole_fraction) {}
   auto ValidateTemperature() const -> bool;
   auto ValidateHumidity() const -> bool;
   auto ValidatePressure() const -> bool;
   auto ValidateCO2MoleFraction() const -> bool;
   auto ValidateEnvironment() const -> bool;
-  double temperature_;
-  double humidity_;
-  double pressure_;
-  double co2_mole_fraction_;
+  Scalar temperature_;
+  Scalar humidity_;
+  Scalar pressure_;
+  Scalar co2_mole_fraction_;
+};
+
+template <typename Scalar>
+class BasicEnvironmentRate {
+ public:
+  constexpr BasicEnvironmentRate()
+      : temperature_rate_(0.0),
+        humidity_rate_(0.0),
+        pressure_rate_(0.0),
+        co2_mole_fraction_rate_(0.0) {}
+  constexpr BasicEnvironmentRate(const Scalar temperature_rate,
+                                 const Scalar humidity_rate,
+                                 const Scalar pressure_rate,
+                                 const Scalar co2_mole_fraction_rate)
+      : temperature_rate_(temperature_rate),
+        humidity_rate_(humidity_rate),
+        pressure_rate_(pressure_rate),
+        co2_mole_fraction_rate_(co2_mole_fraction_rate) {}
+  Scalar temperature_rate_;
+  Scalar humidity_rate_;
+  Scalar pressure_rate_;
+  Scalar co2_mole_fraction_rate_;
 };
 
-class EnvironmentRate {
+template <typename Scalar>
+class BasicEnvironmentCurvature {
  public:
-  EnvironmentRate();
-  double temperature_rate_;
-  double humidity_rate_;
-  double pressure_rate_;
-  double co2_mole_fraction_rate_;
+  constexpr BasicEnvironmentCurvature()
+      : temperature_temperature_(0.0),
+        temperature_humidity_(0.0),
+        temperature_pressure_(0.0),
+        temperature_co2_mole_fraction_(0.0),
+        humidity_humidity_(0.0),
+        humidity_pressure_(0.0),
+        humidity_co2_mole_fraction_(0.0),
+        pressure_pressure_(0.0),
+        pressure_co2_mole_fraction_(0.0),
+        co2_mole_fraction_co2_mole_fraction_(0.0) {}
+  constexpr BasicEnvironmentCurvature(
+      const Scalar temperature_temperature, const Scalar temperature_humidity,
+      const Scalar temperature_pressure,
+      const Scalar temperature_co2_mole_fraction,
+      const Scalar humidity_humidity, const Scalar humidity_pressure,
+      const Scalar humidity_co2_mole_fraction, const Scalar pressure_pressure,
+      const Scalar pressure_co2_mole_fraction,
+      const Scalar co2_mole_fraction_co2_mole_fraction)
+      : temperature_temperature_(temperature_temperature),
+        temperature_humidity_(temperature_humidity),
+        temperature_pressure_(temperature_pressure),
+        temperature_co2_mole_fraction_(temperature_co2_mole_fraction),
+        humidity_humidity_(humidity_humidity),
+        humidity_pressure_(humidity_pressure),
+        humidity_co2_mole_fraction_(humidity_co2_mole_fraction),
+        pressure_pressure_(pressure_pressure),
+        pressure_co2_mole_fraction_(pressure_co2_mole_fraction),
+        co2_mole_fraction_co2_mole_fraction_(
+            co2_mole_fraction_co2_mole_fraction) {}
+  Scalar temperature_temperature_;
+  Scalar temperature_humidity_;
+  Scalar temperature_pressure_;
+  Scalar temperature_co2_mole_fraction_;
+  Scalar humidity_humidity_;
+  Scalar humidity_pressure_;
+  Scalar humidity_co2_mole_fraction_;
+  Scalar pressure_pressure_;
+  Scalar pressure_co2_mole_fraction_;
+  Scalar co2_mole_fraction_co2_mole_fraction_;
 };
 
+using Environment = BasicEnvironment<double>;
+using EnvironmentRate = BasicEnvironmentRate<double>;
+using EnvironmentCurvature = BasicEnvironmentCurvature<double>;
+
 }  // namespace speedofsound
 
+#ifdef SPEED_OF_SOUND_HEADER_ONLY
+#include "environment-inl.h"
+#endif
+
 #endif  // ENVIRONMENT_H_
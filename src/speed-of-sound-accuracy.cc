@@ -0,0 +1,334 @@
+#include "speed-of-sound-accuracy.h"
+
+#include <math.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "speed-of-sound-anchored.h"
+#include "speed-of-sound-batch.h"
+#include "speed-of-sound-chebyshev-fitter.h"
+#include "speed-of-sound-theory.h"
+#include "speed-of-sound.h"
+
+namespace speedofsound {
+
+namespace {
+
+const char* const kEngineNames[kAccuracyEngineCount] = {
+    "compute",     "quick_compute",         "float_quick_compute",
+    "batch",       "approximate",           "quadratic_approximate",
+    "anchored",    "lookup_table",          "chebyshev"};
+
+// Environments timed per engine, and the least time spent on them
+const size_t kTimingCount = 4096;
+const double kMinTimingSeconds = 0.02;
+
+auto GridValue(const double min, const double max, const size_t points,
+               const size_t index) -> double {
+  return min + (max - min) * index / static_cast<double>(points - 1);
+}
+
+// State of the engines that change as they evaluate, one per thread
+class Workspace {
+ public:
+  explicit Workspace(const double surrogate_tolerance)
+      : anchored_(surrogate_tolerance) {}
+  SpeedOfSound compute_;
+  AnchoredSpeedOfSound anchored_;
+};
+
+// Engines built once per run and shared read-only by the threads
+class Engines {
+ public:
+  explicit Engines(const AccuracySweepOptions& options)
+      : quadratic_(Environment(), ApproximationOrder::kQuadratic),
+        surrogate_tolerance_(options.surrogate_tolerance_) {}
+
+  auto Build(const AccuracySweepOptions& options,
+             const std::vector<AccuracyEngine>& engines) -> bool {
+    for (const auto engine : engines) {
+      if (engine == AccuracyEngine::kLookupTable &&
+          !lookup_table_.Build(options.lookup_table_resolution_)) {
+        return false;
+      }
+      if (engine == AccuracyEngine::kChebyshev) {
+        if (!fitter_.Fit(options.surrogate_tolerance_)) return false;
+        surrogate_ = fitter_.GetSurrogate();
+      }
+    }
+    return true;
+  }
+
+  auto NewWorkspace() const -> Workspace {
+    return Workspace(surrogate_tolerance_);
+  }
+
+  // Everything but the batch engine, which evaluates whole arrays
+  auto Evaluate(const AccuracyEngine engine, const Environment& environment,
+                Workspace* workspace) const -> double {
+    switch (engine) {
+      case AccuracyEngine::kCompute:
+        return workspace->compute_.Compute(environment);
+      case AccuracyEngine::kQuickCompute:
+        return linear_.QuickCompute(environment);
+      case AccuracyEngine::kFloatQuickCompute:
+        return float_.QuickCompute(BasicEnvironment<float>(
+            static_cast<float>(environment.temperature_),
+            static_cast<float>(environment.humidity_),
+            static_cast<float>(environment.pressure_),
+            static_cast<float>(environment.co2_mole_fraction_)));
+      case AccuracyEngine::kApproximate:
+        return linear_.Approximate(environment);
+      case AccuracyEngine::kQuadraticApproximate:
+        return quadratic_.Approximate(environment);
+      case AccuracyEngine::kAnchored:
+        return workspace->anchored_.Approximate(environment);
+      case AccuracyEngine::kLookupTable:
+        return lookup_table_.Interpolate(environment);
+      case AccuracyEngine::kChebyshev:
+        return surrogate_.Evaluate(environment);
+      default:
+        return NAN;
+    }
+  }
+
+ private:
+  SpeedOfSound linear_;
+  SpeedOfSound quadratic_;
+  BasicSpeedOfSound<float> float_;
+  double surrogate_tolerance_;
+  LookupTable lookup_table_;
+  ChebyshevFitter fitter_;
+  ChebyshevSurrogate surrogate_;
+};
+
+// Grid points of one temperature plane, as arrays for the batch engine
+class Plane {
+ public:
+  Plane(const AccuracySweepOptions& options, const size_t t_index)
+      : h_points_(options.humidity_points_),
+        p_points_(options.pressure_points_),
+        xc_points_(options.co2_mole_fraction_points_),
+        size_(h_points_ * p_points_ * xc_points_),
+        temperature_(size_),
+        humidity_(size_),
+        pressure_(size_),
+        co2_mole_fraction_(size_) {
+    const auto t = GridValue(theory::kMinTemperature, theory::kMaxTemperature,
+                             options.temperature_points_, t_index);
+    size_t i = 0;
+    for (size_t h = 0; h < h_points_; ++h) {
+      for (size_t p = 0; p < p_points_; ++p) {
+        for (size_t xc = 0; xc < xc_points_; ++xc, ++i) {
+          temperature_[i] = t;
+          humidity_[i] = GridValue(theory::kMinHumidity,
+                                   theory::kMaxHumidity, h_points_, h);
+          pressure_[i] = GridValue(theory::kMinPressure,
+                                   theory::kMaxPressure, p_points_, p);
+          co2_mole_fraction_[i] =
+              GridValue(theory::kMinCO2MoleFraction,
+                        theory::kMaxCO2MoleFraction, xc_points_, xc);
+        }
+      }
+    }
+  }
+
+  auto Size() const -> size_t { return size_; }
+  auto HumidityIndex(const size_t i) const -> size_t {
+    return i / (p_points_ * xc_points_);
+  }
+  auto At(const size_t i) const -> Environment {
+    return Environment(temperature_[i], humidity_[i], pressure_[i],
+                       co2_mole_fraction_[i]);
+  }
+  auto Arrays() const -> EnvironmentArrays {
+    return EnvironmentArrays(temperature_.data(), humidity_.data(),
+                             pressure_.data(), co2_mole_fraction_.data());
+  }
+
+ private:
+  size_t h_points_;
+  size_t p_points_;
+  size_t xc_points_;
+  size_t size_;
+  std::vector<double> temperature_;
+  std::vector<double> humidity_;
+  std::vector<double> pressure_;
+  std::vector<double> co2_mole_fraction_;
+};
+
+// Mean nanoseconds per call over environments, on the calling thread
+auto TimeEngine(const Engines& engines, const AccuracyEngine engine,
+                const Plane& plane) -> double {
+  auto workspace = engines.NewWorkspace();
+  std::vector<double> values(plane.Size());
+  const auto arrays = plane.Arrays();
+  volatile double sink = 0.0;
+  size_t calls = 0;
+  const auto start = std::chrono::steady_clock::now();
+  double seconds = 0.0;
+  do {
+    if (engine == AccuracyEngine::kQuickComputeBatch) {
+      QuickComputeBatch(arrays, plane.Size(), values.data());
+      sink = sink + values[calls % plane.Size()];
+    } else {
+      double sum = 0.0;
+      for (size_t i = 0; i < plane.Size(); ++i) {
+        sum += engines.Evaluate(engine, plane.At(i), &workspace);
+      }
+      sink = sink + sum;
+    }
+    calls += plane.Size();
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                            start)
+                  .count();
+  } while (seconds < kMinTimingSeconds);
+  return seconds * 1.0e9 / calls;
+}
+
+// The timing pass uses an evenly spaced subset of the grid in one plane
+auto TimingOptions(const AccuracySweepOptions& options)
+    -> AccuracySweepOptions {
+  auto timing = options;
+  timing.humidity_points_ = 16;
+  timing.pressure_points_ = 16;
+  timing.co2_mole_fraction_points_ = kTimingCount / (16 * 16);
+  return timing;
+}
+
+}  // namespace
+
+auto AccuracyEngineName(const AccuracyEngine engine) -> const char* {
+  return kEngineNames[static_cast<size_t>(engine)];
+}
+
+auto ParseAccuracyEngine(const char* name, AccuracyEngine* engine) -> bool {
+  for (size_t i = 0; i < kAccuracyEngineCount; ++i) {
+    if (strcmp(name, kEngineNames[i]) == 0) {
+      *engine = static_cast<AccuracyEngine>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+AccuracySweepOptions::AccuracySweepOptions()
+    : temperature_points_(61),
+      humidity_points_(41),
+      pressure_points_(55),
+      co2_mole_fraction_points_(11),
+      temperature_regions_(6),
+      humidity_regions_(5),
+      surrogate_tolerance_(0.01) {}
+
+auto AccuracySweepOptions::Validate() const -> bool {
+  return temperature_points_ >= 2 && humidity_points_ >= 2 &&
+         pressure_points_ >= 2 && co2_mole_fraction_points_ >= 2 &&
+         temperature_regions_ >= 1 &&
+         temperature_regions_ <= temperature_points_ &&
+         humidity_regions_ >= 1 && humidity_regions_ <= humidity_points_ &&
+         surrogate_tolerance_ > 0.0 && lookup_table_resolution_.Validate();
+}
+
+AccuracyStatistics::AccuracyStatistics()
+    : max_error_(0.0), sum_error_(0.0), count_(0) {}
+
+// NaN counts as the largest error
+auto AccuracyStatistics::Add(const double error) -> void {
+  max_error_ = error <= max_error_ ? max_error_ : error;
+  sum_error_ += error;
+  ++count_;
+}
+
+auto AccuracyStatistics::Merge(const AccuracyStatistics& other) -> void {
+  max_error_ = other.max_error_ <= max_error_ ? max_error_ : other.max_error_;
+  sum_error_ += other.sum_error_;
+  count_ += other.count_;
+}
+
+auto AccuracyStatistics::MeanError() const -> double {
+  return count_ > 0 ? sum_error_ / count_ : 0.0;
+}
+
+EngineAccuracy::EngineAccuracy()
+    : engine_(AccuracyEngine::kQuickCompute), nanoseconds_per_call_(0.0) {}
+
+AccuracySweep::AccuracySweep(ThreadPool* pool) : pool_(pool) {}
+
+auto AccuracySweep::Run(const AccuracySweepOptions& options,
+                        const std::vector<AccuracyEngine>& engines,
+                        std::vector<EngineAccuracy>* results) -> bool {
+  if (!options.Validate()) return false;
+  bool listed[kAccuracyEngineCount] = {};
+  for (const auto engine : engines) {
+    auto& seen = listed[static_cast<size_t>(engine)];
+    if (seen) return false;
+    seen = true;
+  }
+  Engines built(options);
+  if (!built.Build(options, engines)) return false;
+
+  const auto planes = options.temperature_points_;
+  const auto h_regions = options.humidity_regions_;
+  const auto engine_count = engines.size();
+  // Statistics of each plane, engine and humidity region
+  std::vector<AccuracyStatistics> plane_statistics(planes * engine_count *
+                                                   h_regions);
+  pool_->ParallelFor(planes, 1, [&](const size_t begin, const size_t end) {
+    for (auto t = begin; t < end; ++t) {
+      const Plane plane(options, t);
+      std::vector<double> reference(plane.Size());
+      const BasicSpeedOfSound<long double> reference_speed_of_sound;
+      for (size_t i = 0; i < plane.Size(); ++i) {
+        const auto environment = plane.At(i);
+        const BasicEnvironment<long double> long_environment(
+            environment.temperature_, environment.humidity_,
+            environment.pressure_, environment.co2_mole_fraction_);
+        reference[i] = static_cast<double>(
+            reference_speed_of_sound.QuickCompute(long_environment));
+      }
+      std::vector<double> values(plane.Size());
+      for (size_t e = 0; e < engine_count; ++e) {
+        if (engines[e] == AccuracyEngine::kQuickComputeBatch) {
+          QuickComputeBatch(plane.Arrays(), plane.Size(), values.data());
+        } else {
+          auto workspace = built.NewWorkspace();
+          for (size_t i = 0; i < plane.Size(); ++i) {
+            values[i] = built.Evaluate(engines[e], plane.At(i), &workspace);
+          }
+        }
+        const auto statistics =
+            &plane_statistics[(t * engine_count + e) * h_regions];
+        for (size_t i = 0; i < plane.Size(); ++i) {
+          const auto region = plane.HumidityIndex(i) * h_regions /
+                              options.humidity_points_;
+          statistics[region].Add(fabs(values[i] - reference[i]));
+        }
+      }
+    }
+  });
+
+  const auto t_regions = options.temperature_regions_;
+  const Plane timing_plane(TimingOptions(options),
+                           options.temperature_points_ / 2);
+  results->assign(engine_count, EngineAccuracy());
+  for (size_t e = 0; e < engine_count; ++e) {
+    auto& result = (*results)[e];
+    result.engine_ = engines[e];
+    result.regions_.assign(t_regions * h_regions, AccuracyStatistics());
+    for (size_t t = 0; t < planes; ++t) {
+      const auto row = t * t_regions / planes;
+      for (size_t h = 0; h < h_regions; ++h) {
+        const auto& statistics =
+            plane_statistics[(t * engine_count + e) * h_regions + h];
+        result.regions_[row * h_regions + h].Merge(statistics);
+        result.total_.Merge(statistics);
+      }
+    }
+    result.nanoseconds_per_call_ = TimeEngine(built, engines[e], timing_plane);
+  }
+  return true;
+}
+
+}  // namespace speedofsound
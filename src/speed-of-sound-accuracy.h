@@ -0,0 +1,96 @@
+#ifndef SPEED_OF_SOUND_ACCURACY_H_
+#define SPEED_OF_SOUND_ACCURACY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "speed-of-sound-lookup-table.h"
+#include "thread-pool.h"
+
+namespace speedofsound {
+
+// Ways of evaluating the speed of sound that AccuracySweep compares.
+// Approximate and QuadraticApproximate are linearized at the standard
+// environment; Anchored, LookupTable and Chebyshev are built from the
+// AccuracySweepOptions.
+enum class AccuracyEngine {
+  kCompute,
+  kQuickCompute,
+  kFloatQuickCompute,
+  kQuickComputeBatch,
+  kApproximate,
+  kQuadraticApproximate,
+  kAnchored,
+  kLookupTable,
+  kChebyshev
+};
+const size_t kAccuracyEngineCount = 9;
+
+auto AccuracyEngineName(const AccuracyEngine engine) -> const char*;
+// False for an unknown name
+auto ParseAccuracyEngine(const char* name, AccuracyEngine* engine) -> bool;
+
+class AccuracySweepOptions {
+ public:
+  AccuracySweepOptions();
+  auto Validate() const -> bool;
+  // Grid points per axis over the valid range, ends included
+  size_t temperature_points_;
+  size_t humidity_points_;
+  size_t pressure_points_;
+  size_t co2_mole_fraction_points_;
+  // The error map splits temperature and humidity into this many regions
+  size_t temperature_regions_;
+  size_t humidity_regions_;
+  // Tolerance (m/s) of the anchored approximation and the Chebyshev fit
+  double surrogate_tolerance_;
+  LookupTableResolution lookup_table_resolution_;
+};
+
+// Absolute errors (m/s) against the reference over a set of grid points
+class AccuracyStatistics {
+ public:
+  AccuracyStatistics();
+  auto Add(const double error) -> void;
+  auto Merge(const AccuracyStatistics& other) -> void;
+  // Zero without points
+  auto MeanError() const -> double;
+  double max_error_;
+  double sum_error_;
+  uint64_t count_;
+};
+
+class EngineAccuracy {
+ public:
+  EngineAccuracy();
+  AccuracyEngine engine_;
+  AccuracyStatistics total_;
+  // temperature_regions_ rows of humidity_regions_ regions
+  std::vector<AccuracyStatistics> regions_;
+  // Mean time of one evaluation on one thread, from a separate timing pass
+  double nanoseconds_per_call_;
+};
+
+// Evaluates engines on a dense grid over the valid range and compares them
+// with the long double instantiation of QuickCompute, which is within
+// kLongDoubleMaxRelativeError of the model. Temperature planes of the grid
+// are spread over the threads of pool; each is reduced on its own and the
+// planes are merged in order, so results do not depend on the thread count.
+class AccuracySweep {
+ public:
+  explicit AccuracySweep(ThreadPool* pool);
+  // False if the options are not valid, an engine cannot be built or an
+  // engine is listed twice
+  auto Run(const AccuracySweepOptions& options,
+           const std::vector<AccuracyEngine>& engines,
+           std::vector<EngineAccuracy>* results) -> bool;
+
+ private:
+  ThreadPool* pool_;
+};
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_ACCURACY_H_
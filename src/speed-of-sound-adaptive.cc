@@ -0,0 +1,84 @@
+#include "speed-of-sound-adaptive.h"
+
+#include <math.h>
+
+namespace speedofsound {
+
+AdaptiveSpeedOfSound::AdaptiveSpeedOfSound(const double tolerance)
+    : tolerance_(tolerance),
+      approximation_count_(0),
+      recompute_count_(0) {}
+
+AdaptiveSpeedOfSound::AdaptiveSpeedOfSound(const Environment& ambient_conitions,
+                                           const double tolerance)
+    : speed_of_sound_(ambient_conitions),
+      tolerance_(tolerance),
+      approximation_count_(0),
+      recompute_count_(0) {}
+
+auto AdaptiveSpeedOfSound::IsValid() const -> bool {
+  return tolerance_ > 0.0;
+}
+
+auto AdaptiveSpeedOfSound::GetTolerance() const -> double {
+  return tolerance_;
+}
+
+auto AdaptiveSpeedOfSound::GetSpeedOfSound() const -> SpeedOfSound {
+  return speed_of_sound_;
+}
+
+auto AdaptiveSpeedOfSound::GetApproximationCount() const -> unsigned long {
+  return approximation_count_;
+}
+
+auto AdaptiveSpeedOfSound::GetRecomputeCount() const -> unsigned long {
+  return recompute_count_;
+}
+
+auto AdaptiveSpeedOfSound::ResetCounters() -> void {
+  approximation_count_ = 0;
+  recompute_count_ = 0;
+}
+
+// Lagrange remainder of the first-order Taylor expansion, with each second
+// derivative replaced by its bound over the valid range
+auto LinearizationErrorBound(const double dt, const double dh, const double dp,
+                             const double dxc) -> double {
+  auto error = theory::kMaxD2C_dt2 * dt * dt;
+  error += theory::kMaxD2C_dh2 * dh * dh;
+  error += theory::kMaxD2C_dp2 * dp * dp;
+  error += theory::kMaxD2C_dxc2 * dxc * dxc;
+  error *= 0.5;
+  error += theory::kMaxD2C_dtdh * dt * dh;
+  error += theory::kMaxD2C_dtdp * dt * dp;
+  error += theory::kMaxD2C_dtdxc * dt * dxc;
+  error += theory::kMaxD2C_dhdp * dh * dp;
+  error += theory::kMaxD2C_dhdxc * dh * dxc;
+  error += theory::kMaxD2C_dpdxc * dp * dxc;
+  return error;
+}
+
+auto AdaptiveSpeedOfSound::EstimateError(
+    const Environment& ambient_conitions) const -> double {
+  const auto init_environment = speed_of_sound_.GetInitEnvironment();
+  return LinearizationErrorBound(
+      fabs(ambient_conitions.temperature_ - init_environment.temperature_),
+      fabs(ambient_conitions.humidity_ - init_environment.humidity_),
+      fabs(ambient_conitions.pressure_ - init_environment.pressure_),
+      fabs(ambient_conitions.co2_mole_fraction_ -
+           init_environment.co2_mole_fraction_));
+}
+
+auto AdaptiveSpeedOfSound::Approximate(const Environment& ambient_conitions)
+    -> double {
+  // Written so that a NaN tolerance or error recomputes
+  if (!(EstimateError(ambient_conitions) <= tolerance_)) {
+    ++recompute_count_;
+    return speed_of_sound_.Compute(ambient_conitions);
+  }
+  ++approximation_count_;
+  return speed_of_sound_.Approximate(ambient_conitions);
+}
+
+}  // namespace speedofsound
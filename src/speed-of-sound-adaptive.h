@@ -0,0 +1,42 @@
+#ifndef SPEED_OF_SOUND_ADAPTIVE_H_
+#define SPEED_OF_SOUND_ADAPTIVE_H_
+
+#include "environment.h"
+#include "speed-of-sound.h"
+
+namespace speedofsound {
+
+// Bound (m/s) on the error of the linear approximation at distances dt, dh,
+// dp and dxc from the linearization point, within the valid range
+auto LinearizationErrorBound(const double dt, const double dh, const double dp,
+                             const double dxc) -> double;
+
+// Approximates the speed of sound and calls Compute again whenever the bound
+// on the linear approximation error would exceed the tolerance (m/s). The
+// bound holds for environments within the valid range.
+class AdaptiveSpeedOfSound {
+ public:
+  // A tolerance that is not positive (or NaN) is false from IsValid and
+  // recomputes on every call
+  explicit AdaptiveSpeedOfSound(const double tolerance);
+  explicit AdaptiveSpeedOfSound(const Environment& ambient_conitions,
+                                const double tolerance);
+  auto IsValid() const -> bool;
+  auto GetTolerance() const -> double;
+  auto GetSpeedOfSound() const -> SpeedOfSound;
+  auto GetApproximationCount() const -> unsigned long;
+  auto GetRecomputeCount() const -> unsigned long;
+  auto ResetCounters() -> void;
+  auto EstimateError(const Environment& ambient_conitions) const -> double;
+  auto Approximate(const Environment& ambient_conitions) -> double;
+
+ private:
+  SpeedOfSound speed_of_sound_;
+  double tolerance_;
+  unsigned long approximation_count_;
+  unsigned long recompute_count_;
+};
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_ADAPTIVE_H_
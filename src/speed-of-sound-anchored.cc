@@ -0,0 +1,135 @@
+#include "speed-of-sound-anchored.h"
+
+#include "speed-of-sound-adaptive.h"
+#include "speed-of-sound-theory.h"
+#include "speed-of-sound.h"
+
+namespace speedofsound {
+
+namespace {
+
+const double kMin[4] = {theory::kMinTemperature, theory::kMinHumidity,
+                        theory::kMinPressure, theory::kMinCO2MoleFraction};
+const double kMax[4] = {theory::kMaxTemperature, theory::kMaxHumidity,
+                        theory::kMaxPressure, theory::kMaxCO2MoleFraction};
+
+// Distance from the centre of a cell to its corners
+auto CellErrorBound(const size_t* cells) -> double {
+  double half_width[4];
+  for (size_t axis = 0; axis < 4; ++axis) {
+    half_width[axis] = 0.5 * (kMax[axis] - kMin[axis]) / cells[axis];
+  }
+  return LinearizationErrorBound(half_width[0], half_width[1], half_width[2],
+                                 half_width[3]);
+}
+
+}  // namespace
+
+const size_t AnchoredSpeedOfSound::kMaxCells;
+
+AnchoredSpeedOfSound::AnchoredSpeedOfSound(const double tolerance)
+    : tolerance_(tolerance),
+      error_bound_(0.0),
+      cells_{1, 1, 1, 1},
+      scale_(),
+      offset_(),
+      max_position_(),
+      stride_() {
+  error_bound_ = CellErrorBound(cells_);
+  size_t cell_count = 1;
+  while (IsValid() && error_bound_ > tolerance_ &&
+         2 * cell_count <= kMaxCells) {
+    size_t best_axis = 0;
+    auto best_bound = error_bound_;
+    for (size_t axis = 0; axis < 4; ++axis) {
+      cells_[axis] *= 2;
+      const auto bound = CellErrorBound(cells_);
+      cells_[axis] /= 2;
+      if (bound < best_bound) {
+        best_axis = axis;
+        best_bound = bound;
+      }
+    }
+    cells_[best_axis] *= 2;
+    cell_count *= 2;
+    error_bound_ = best_bound;
+  }
+  size_t stride = 1;
+  for (size_t axis = 4; axis-- > 0;) {
+    scale_[axis] = cells_[axis] / (kMax[axis] - kMin[axis]);
+    offset_[axis] = kMin[axis] * scale_[axis];
+    max_position_[axis] = cells_[axis] - 1;
+    stride_[axis] = stride;
+    stride *= cells_[axis];
+  }
+  anchor_index_.assign(cell_count, 0);
+}
+
+auto AnchoredSpeedOfSound::IsValid() const -> bool {
+  return tolerance_ > 0.0;
+}
+
+auto AnchoredSpeedOfSound::GetTolerance() const -> double {
+  return tolerance_;
+}
+
+auto AnchoredSpeedOfSound::GetErrorBound() const -> double {
+  return error_bound_;
+}
+
+auto AnchoredSpeedOfSound::GetCellCount() const -> size_t {
+  return anchor_index_.size();
+}
+
+auto AnchoredSpeedOfSound::GetAnchorCount() const -> size_t {
+  return anchors_.size();
+}
+
+auto AnchoredSpeedOfSound::Approximate(const Environment& ambient_conitions)
+    -> double {
+  const double x[4] = {ambient_conitions.temperature_,
+                       ambient_conitions.humidity_,
+                       ambient_conitions.pressure_,
+                       ambient_conitions.co2_mole_fraction_};
+  size_t cell = 0;
+  for (size_t axis = 0; axis < 4; ++axis) {
+    auto u = x[axis] * scale_[axis] - offset_[axis];
+    // Compiles to max and min; NaN lands in the first cell
+    u = u > 0.0 ? u : 0.0;
+    u = u < max_position_[axis] ? u : max_position_[axis];
+    cell += static_cast<int>(u) * stride_[axis];
+  }
+  auto index = anchor_index_[cell];
+  if (index == 0) index = AddAnchor(cell);
+  const auto& anchor = anchors_[index - 1];
+  auto approx_speed_of_sound = anchor.speed_of_sound_;
+  for (size_t axis = 0; axis < 4; ++axis) {
+    approx_speed_of_sound +=
+        (x[axis] - anchor.environment_[axis]) * anchor.rate_[axis];
+  }
+  return approx_speed_of_sound;
+}
+
+auto AnchoredSpeedOfSound::AddAnchor(const size_t cell) -> uint32_t {
+  Anchor anchor;
+  auto remainder = cell;
+  for (size_t axis = 0; axis < 4; ++axis) {
+    const auto index = remainder / stride_[axis];
+    remainder %= stride_[axis];
+    anchor.environment_[axis] = (index + 0.5 + offset_[axis]) / scale_[axis];
+  }
+  const Environment environment(
+      anchor.environment_[0], anchor.environment_[1], anchor.environment_[2],
+      anchor.environment_[3]);
+  EnvironmentRate rate;
+  anchor.speed_of_sound_ = SpeedOfSound().ComputeRate(environment, &rate);
+  anchor.rate_[0] = rate.temperature_rate_;
+  anchor.rate_[1] = rate.humidity_rate_;
+  anchor.rate_[2] = rate.pressure_rate_;
+  anchor.rate_[3] = rate.co2_mole_fraction_rate_;
+  anchors_.push_back(anchor);
+  anchor_index_[cell] = static_cast<uint32_t>(anchors_.size());
+  return anchor_index_[cell];
+}
+
+}  // namespace speedofsound
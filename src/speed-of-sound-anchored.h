@@ -0,0 +1,63 @@
+#ifndef SPEED_OF_SOUND_ANCHORED_H_
+#define SPEED_OF_SOUND_ANCHORED_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "environment.h"
+
+namespace speedofsound {
+
+// Approximates the speed of sound from the nearest of many linearization
+// points (anchors). The valid range is split into a uniform grid of cells,
+// fine enough that the linear approximation from a cell's centre stays within
+// the tolerance (m/s) everywhere in the cell. An anchor is computed the first
+// time its cell is visited. Environments outside the valid range use the
+// nearest edge cell, without the bound.
+class AnchoredSpeedOfSound {
+ public:
+  // Cells are added along the axis that reduces the bound most until it
+  // meets the tolerance or the grid reaches kMaxCells
+  static const size_t kMaxCells = size_t(1) << 22;
+
+  // A tolerance that is not positive (or NaN) is false from IsValid and
+  // leaves a single cell
+  explicit AnchoredSpeedOfSound(const double tolerance);
+  auto IsValid() const -> bool;
+  auto GetTolerance() const -> double;
+  // Bound on the approximation error within the valid range; above the
+  // tolerance only if kMaxCells was reached
+  auto GetErrorBound() const -> double;
+  auto GetCellCount() const -> size_t;
+  auto GetAnchorCount() const -> size_t;
+  auto Approximate(const Environment& ambient_conitions) -> double;
+
+ private:
+  // Linearization point; the centre of its cell
+  class Anchor {
+   public:
+    double speed_of_sound_;
+    double environment_[4];
+    double rate_[4];
+  };
+
+  auto AddAnchor(const size_t cell) -> uint32_t;
+
+  double tolerance_;
+  double error_bound_;
+  size_t cells_[4];
+  // Cell position of an environment is x * scale_ - offset_
+  double scale_[4];
+  double offset_[4];
+  double max_position_[4];
+  size_t stride_[4];
+  // One more than the index of the cell's anchor, zero before the first visit
+  std::vector<uint32_t> anchor_index_;
+  std::vector<Anchor> anchors_;
+};
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_ANCHORED_H_
@@ -0,0 +1,109 @@
+#include "speed-of-sound-batch-kernels.h"
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
+namespace speedofsound {
+
+namespace internal {
+
+#if defined(__AVX2__) && defined(__FMA__)
+
+namespace {
+
+class Avx2 {
+ public:
+  typedef double Scalar;
+  typedef __m256d Vector;
+  static const size_t kWidth = 4;
+  static auto Set1(const double x) -> Vector { return _mm256_set1_pd(x); }
+  static auto Load(const double* x) -> Vector { return _mm256_loadu_pd(x); }
+  static auto Store(double* y, const Vector x) -> void {
+    _mm256_storeu_pd(y, x);
+  }
+  static auto Add(const Vector a, const Vector b) -> Vector {
+    return _mm256_add_pd(a, b);
+  }
+  static auto Sub(const Vector a, const Vector b) -> Vector {
+    return _mm256_sub_pd(a, b);
+  }
+  static auto Mul(const Vector a, const Vector b) -> Vector {
+    return _mm256_mul_pd(a, b);
+  }
+  static auto Div(const Vector a, const Vector b) -> Vector {
+    return _mm256_div_pd(a, b);
+  }
+  static auto MulAdd(const Vector a, const Vector b, const Vector c) -> Vector {
+    return _mm256_fmadd_pd(a, b, c);
+  }
+  static auto Pow2(const Vector kn) -> Vector {
+    const auto n = _mm256_slli_epi64(_mm256_castpd_si256(kn), 52);
+    const auto one = _mm256_castpd_si256(_mm256_set1_pd(1.0));
+    return _mm256_castsi256_pd(_mm256_add_epi64(n, one));
+  }
+};
+
+class Avx2Float {
+ public:
+  typedef float Scalar;
+  typedef __m256 Vector;
+  static const size_t kWidth = 8;
+  static auto Set1(const double x) -> Vector {
+    return _mm256_set1_ps(static_cast<float>(x));
+  }
+  static auto Load(const float* x) -> Vector { return _mm256_loadu_ps(x); }
+  static auto Store(float* y, const Vector x) -> void {
+    _mm256_storeu_ps(y, x);
+  }
+  static auto Add(const Vector a, const Vector b) -> Vector {
+    return _mm256_add_ps(a, b);
+  }
+  static auto Sub(const Vector a, const Vector b) -> Vector {
+    return _mm256_sub_ps(a, b);
+  }
+  static auto Mul(const Vector a, const Vector b) -> Vector {
+    return _mm256_mul_ps(a, b);
+  }
+  static auto Div(const Vector a, const Vector b) -> Vector {
+    return _mm256_div_ps(a, b);
+  }
+  static auto MulAdd(const Vector a, const Vector b, const Vector c) -> Vector {
+    return _mm256_fmadd_ps(a, b, c);
+  }
+  static auto Pow2(const Vector kn) -> Vector {
+    const auto n = _mm256_slli_epi32(_mm256_castps_si256(kn), 23);
+    const auto one = _mm256_castps_si256(_mm256_set1_ps(1.0f));
+    return _mm256_castsi256_ps(_mm256_add_epi32(n, one));
+  }
+};
+
+auto QuickComputeAvx2(const EnvironmentArrays& ambient_conditions,
+                      const size_t count, double* speed_of_sound) -> void {
+  QuickComputeBatch<Avx2>(ambient_conditions, count, speed_of_sound);
+}
+
+auto FastPsvAvx2(const double* T, const size_t count, double* Psv,
+                 double* dPsv_dt) -> void {
+  FastPsvBatch<Avx2>(T, count, Psv, dPsv_dt);
+}
+
+auto QuickComputeFloatAvx2(const FloatEnvironmentArrays& ambient_conditions,
+                           const size_t count, float* speed_of_sound) -> void {
+  QuickComputeBatch<Avx2Float>(ambient_conditions, count, speed_of_sound);
+}
+
+}  // namespace
+
+const KernelTable kAvx2Kernels = {&QuickComputeAvx2, &FastPsvAvx2,
+                                  &QuickComputeFloatAvx2};
+
+#else
+
+const KernelTable kAvx2Kernels = {nullptr, nullptr, nullptr};
+
+#endif
+
+}  // namespace internal
+
+}  // namespace speedofsound
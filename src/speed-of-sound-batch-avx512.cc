@@ -0,0 +1,110 @@
+#include "speed-of-sound-batch-kernels.h"
+
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace speedofsound {
+
+namespace internal {
+
+#if defined(__AVX512F__)
+
+namespace {
+
+class Avx512 {
+ public:
+  typedef double Scalar;
+  typedef __m512d Vector;
+  static const size_t kWidth = 8;
+  static auto Set1(const double x) -> Vector { return _mm512_set1_pd(x); }
+  static auto Load(const double* x) -> Vector { return _mm512_loadu_pd(x); }
+  static auto Store(double* y, const Vector x) -> void {
+    _mm512_storeu_pd(y, x);
+  }
+  static auto Add(const Vector a, const Vector b) -> Vector {
+    return _mm512_add_pd(a, b);
+  }
+  static auto Sub(const Vector a, const Vector b) -> Vector {
+    return _mm512_sub_pd(a, b);
+  }
+  static auto Mul(const Vector a, const Vector b) -> Vector {
+    return _mm512_mul_pd(a, b);
+  }
+  static auto Div(const Vector a, const Vector b) -> Vector {
+    return _mm512_div_pd(a, b);
+  }
+  static auto MulAdd(const Vector a, const Vector b, const Vector c) -> Vector {
+    return _mm512_fmadd_pd(a, b, c);
+  }
+  static auto Pow2(const Vector kn) -> Vector {
+    const auto n = _mm512_slli_epi64(_mm512_castpd_si512(kn), 52);
+    const auto one = _mm512_castpd_si512(_mm512_set1_pd(1.0));
+    return _mm512_castsi512_pd(_mm512_add_epi64(n, one));
+  }
+};
+
+class Avx512Float {
+ public:
+  typedef float Scalar;
+  typedef __m512 Vector;
+  static const size_t kWidth = 16;
+  static auto Set1(const double x) -> Vector {
+    return _mm512_set1_ps(static_cast<float>(x));
+  }
+  static auto Load(const float* x) -> Vector { return _mm512_loadu_ps(x); }
+  static auto Store(float* y, const Vector x) -> void {
+    _mm512_storeu_ps(y, x);
+  }
+  static auto Add(const Vector a, const Vector b) -> Vector {
+    return _mm512_add_ps(a, b);
+  }
+  static auto Sub(const Vector a, const Vector b) -> Vector {
+    return _mm512_sub_ps(a, b);
+  }
+  static auto Mul(const Vector a, const Vector b) -> Vector {
+    return _mm512_mul_ps(a, b);
+  }
+  static auto Div(const Vector a, const Vector b) -> Vector {
+    return _mm512_div_ps(a, b);
+  }
+  static auto MulAdd(const Vector a, const Vector b, const Vector c) -> Vector {
+    return _mm512_fmadd_ps(a, b, c);
+  }
+  static auto Pow2(const Vector kn) -> Vector {
+    const auto n = _mm512_slli_epi32(_mm512_castps_si512(kn), 23);
+    const auto one = _mm512_castps_si512(_mm512_set1_ps(1.0f));
+    return _mm512_castsi512_ps(_mm512_add_epi32(n, one));
+  }
+};
+
+auto QuickComputeAvx512(const EnvironmentArrays& ambient_conditions,
+                        const size_t count, double* speed_of_sound) -> void {
+  QuickComputeBatch<Avx512>(ambient_conditions, count, speed_of_sound);
+}
+
+auto FastPsvAvx512(const double* T, const size_t count, double* Psv,
+                   double* dPsv_dt) -> void {
+  FastPsvBatch<Avx512>(T, count, Psv, dPsv_dt);
+}
+
+auto QuickComputeFloatAvx512(const FloatEnvironmentArrays& ambient_conditions,
+                             const size_t count, float* speed_of_sound)
+    -> void {
+  QuickComputeBatch<Avx512Float>(ambient_conditions, count, speed_of_sound);
+}
+
+}  // namespace
+
+const KernelTable kAvx512Kernels = {&QuickComputeAvx512, &FastPsvAvx512,
+                                    &QuickComputeFloatAvx512};
+
+#else
+
+const KernelTable kAvx512Kernels = {nullptr, nullptr, nullptr};
+
+#endif
+
+}  // namespace internal
+
+}  // namespace speedofsound
@@ -0,0 +1,193 @@
+#ifndef SPEED_OF_SOUND_BATCH_KERNELS_H_
+#define SPEED_OF_SOUND_BATCH_KERNELS_H_
+
+#include <stddef.h>
+
+#include "speed-of-sound-batch.h"
+#include "speed-of-sound-coefficients.h"
+
+namespace speedofsound {
+
+namespace internal {
+
+typedef void (*QuickComputeKernel)(const EnvironmentArrays& ambient_conditions,
+                                   const size_t count, double* speed_of_sound);
+typedef void (*FastPsvKernel)(const double* T, const size_t count, double* Psv,
+                              double* dPsv_dt);
+typedef void (*FloatQuickComputeKernel)(
+    const FloatEnvironmentArrays& ambient_conditions, const size_t count,
+    float* speed_of_sound);
+
+class KernelTable {
+ public:
+  QuickComputeKernel quick_compute_;
+  FastPsvKernel fast_psv_;
+  FloatQuickComputeKernel float_quick_compute_;
+};
+
+// Members are null when the compiler could not target the instruction set
+extern const KernelTable kSse2Kernels;
+extern const KernelTable kAvx2Kernels;
+extern const KernelTable kAvx512Kernels;
+
+auto QuickComputeScalar(const EnvironmentArrays& ambient_conditions,
+                        const size_t begin, const size_t end,
+                        double* speed_of_sound) -> void;
+auto QuickComputeScalar(const FloatEnvironmentArrays& ambient_conditions,
+                        const size_t begin, const size_t end,
+                        float* speed_of_sound) -> void;
+auto FastPsvScalar(const double* T, const size_t begin, const size_t end,
+                   double* Psv, double* dPsv_dt) -> void;
+
+// Everything below is instantiated once per instruction set and scalar type
+// with a Simd policy providing Scalar, Vector, kWidth, Set1, Load, Store, Add,
+// Sub, Mul, Div, MulAdd and Pow2, where Pow2 moves the integer that the
+// rounding shift leaves in the low mantissa bits into the exponent field of
+// 1.0. Non-template inline functions must not be added here: each kernel is
+// compiled with different target flags.
+
+const double kLog2e = 1.4426950408889634074;
+// Taylor coefficients 1/13!, ..., 1/0! of exp(r) for |r| <= ln(2) / 2
+const double kExpCoefficients[] = {
+    1.0 / 6227020800.0, 1.0 / 479001600.0, 1.0 / 39916800.0,
+    1.0 / 3628800.0,    1.0 / 362880.0,    1.0 / 40320.0,
+    1.0 / 5040.0,       1.0 / 720.0,       1.0 / 120.0,
+    1.0 / 24.0,         1.0 / 6.0,         1.0 / 2.0,
+    1.0,                1.0};
+const size_t kExpCoefficientCount =
+    sizeof(kExpCoefficients) / sizeof(kExpCoefficients[0]);
+
+// Adding 1.5 * 2^(mantissa bits) rounds to the nearest integer and leaves it
+// in the low mantissa bits. n * kLn2Hi is exact for the exponents of Psv, and
+// float keeps the last kExpDegree + 1 coefficients.
+template <typename Scalar>
+class ExpConstants;
+
+template <>
+class ExpConstants<double> {
+ public:
+  static constexpr double kRoundingShift = 6755399441055744.0;
+  static constexpr double kLn2Hi = 6.93147180369123816490e-01;
+  static constexpr double kLn2Lo = 1.90821492927058770002e-10;
+  static constexpr size_t kExpDegree = 13;
+};
+
+template <>
+class ExpConstants<float> {
+ public:
+  static constexpr double kRoundingShift = 12582912.0;
+  static constexpr double kLn2Hi = 6.93359375e-01;
+  static constexpr double kLn2Lo = -2.12194440e-04;
+  static constexpr size_t kExpDegree = 7;
+};
+
+template <typename Simd>
+inline auto Exp(const typename Simd::Vector x) -> typename Simd::Vector {
+  using Constants = ExpConstants<typename Simd::Scalar>;
+  const auto shift = Simd::Set1(Constants::kRoundingShift);
+  const auto kn = Simd::Add(Simd::Mul(x, Simd::Set1(kLog2e)), shift);
+  const auto n = Simd::Sub(kn, shift);
+  auto r = Simd::Sub(x, Simd::Mul(n, Simd::Set1(Constants::kLn2Hi)));
+  r = Simd::Sub(r, Simd::Mul(n, Simd::Set1(Constants::kLn2Lo)));
+  const auto first = kExpCoefficientCount - 1 - Constants::kExpDegree;
+  auto exp_r = Simd::Set1(kExpCoefficients[first]);
+  for (auto k = first + 1; k < kExpCoefficientCount; ++k) {
+    exp_r = Simd::MulAdd(exp_r, r, Simd::Set1(kExpCoefficients[k]));
+  }
+  return Simd::Mul(exp_r, Simd::Pow2(kn));
+}
+
+template <typename Simd>
+inline auto FastPsv(const typename Simd::Vector T) -> typename Simd::Vector {
+  auto exponent = Simd::Mul(Simd::Mul(Simd::Set1(theory::k19), T), T);
+  exponent = Simd::Add(exponent, Simd::Mul(Simd::Set1(theory::k20), T));
+  exponent = Simd::Add(exponent, Simd::Set1(theory::k21));
+  exponent = Simd::Add(exponent, Simd::Div(Simd::Set1(theory::k22), T));
+  return Exp<Simd>(exponent);
+}
+
+template <typename Simd>
+inline auto FastPsvAndDerivative(const typename Simd::Vector T,
+                                 typename Simd::Vector* dPsv_dt) ->
+    typename Simd::Vector {
+  const auto Psv = FastPsv<Simd>(T);
+  auto dexponent_dT = Simd::Mul(Simd::Set1(2.0 * theory::k19), T);
+  dexponent_dT = Simd::Add(dexponent_dT, Simd::Set1(theory::k20));
+  dexponent_dT = Simd::Sub(
+      dexponent_dT, Simd::Div(Simd::Set1(theory::k22), Simd::Mul(T, T)));
+  *dPsv_dt = Simd::Mul(dexponent_dT, Psv);
+  return Psv;
+}
+
+template <typename Simd>
+inline auto FastPsvBatch(const double* T, const size_t count, double* Psv,
+                         double* dPsv_dt) -> void {
+  size_t i = 0;
+  for (; i + Simd::kWidth <= count; i += Simd::kWidth) {
+    typename Simd::Vector dPsv_dt_i;
+    Simd::Store(Psv + i, FastPsvAndDerivative<Simd>(Simd::Load(T + i),
+                                                    &dPsv_dt_i));
+    if (dPsv_dt != nullptr) Simd::Store(dPsv_dt + i, dPsv_dt_i);
+  }
+  FastPsvScalar(T, i, count, Psv, dPsv_dt);
+}
+
+// Evaluates k0 + k1 * t + k2 * t * t in the same order as the scalar model
+template <typename Simd>
+inline auto Quadratic(const double k0, const double k1, const double k2,
+                      const typename Simd::Vector t) -> typename Simd::Vector {
+  return Simd::Add(Simd::Add(Simd::Set1(k0), Simd::Mul(Simd::Set1(k1), t)),
+                   Simd::Mul(Simd::Mul(Simd::Set1(k2), t), t));
+}
+
+// Operation order mirrors speed-of-sound-theory-inl.h
+template <typename Simd>
+inline auto QuickCompute(const typename Simd::Vector t,
+                         const typename Simd::Vector h,
+                         const typename Simd::Vector p,
+                         const typename Simd::Vector xc) ->
+    typename Simd::Vector {
+  const auto T = Simd::Add(t, Simd::Set1(273.15));
+  const auto F = Simd::Add(
+      Simd::Add(Simd::Set1(theory::k16), Simd::Mul(Simd::Set1(theory::k17), p)),
+      Simd::Mul(Simd::Mul(Simd::Set1(theory::k18), t), t));
+  const auto Psv = FastPsv<Simd>(T);
+  const auto Xw = Simd::Div(Simd::Mul(Simd::Mul(h, F), Psv), p);
+  auto C = Quadratic<Simd>(theory::k00, theory::k01, theory::k02, t);
+  C = Simd::Add(C, Simd::Mul(Quadratic<Simd>(theory::k03, theory::k04,
+                                             theory::k05, t),
+                             Xw));
+  C = Simd::Add(C, Simd::Mul(Quadratic<Simd>(theory::k06, theory::k07,
+                                             theory::k08, t),
+                             p));
+  C = Simd::Add(C, Simd::Mul(Quadratic<Simd>(theory::k09, theory::k10,
+                                             theory::k11, t),
+                             xc));
+  C = Simd::Add(C, Simd::Mul(Simd::Mul(Simd::Set1(theory::k12), Xw), Xw));
+  C = Simd::Add(C, Simd::Mul(Simd::Mul(Simd::Set1(theory::k13), p), p));
+  C = Simd::Add(C, Simd::Mul(Simd::Mul(Simd::Set1(theory::k14), xc), xc));
+  C = Simd::Add(
+      C, Simd::Mul(Simd::Mul(Simd::Mul(Simd::Set1(theory::k15), Xw), p), xc));
+  return C;
+}
+
+template <typename Simd, typename Arrays>
+inline auto QuickComputeBatch(const Arrays& ambient_conditions,
+                              const size_t count,
+                              typename Simd::Scalar* speed_of_sound) -> void {
+  size_t i = 0;
+  for (; i + Simd::kWidth <= count; i += Simd::kWidth) {
+    const auto t = Simd::Load(ambient_conditions.temperature_ + i);
+    const auto h = Simd::Load(ambient_conditions.humidity_ + i);
+    const auto p = Simd::Load(ambient_conditions.pressure_ + i);
+    const auto xc = Simd::Load(ambient_conditions.co2_mole_fraction_ + i);
+    Simd::Store(speed_of_sound + i, QuickCompute<Simd>(t, h, p, xc));
+  }
+  QuickComputeScalar(ambient_conditions, i, count, speed_of_sound);
+}
+
+}  // namespace internal
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_BATCH_KERNELS_H_
@@ -0,0 +1,109 @@
+#include "speed-of-sound-batch-kernels.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace speedofsound {
+
+namespace internal {
+
+#if defined(__SSE2__)
+
+namespace {
+
+class Sse2 {
+ public:
+  typedef double Scalar;
+  typedef __m128d Vector;
+  static const size_t kWidth = 2;
+  static auto Set1(const double x) -> Vector { return _mm_set1_pd(x); }
+  static auto Load(const double* x) -> Vector { return _mm_loadu_pd(x); }
+  static auto Store(double* y, const Vector x) -> void {
+    _mm_storeu_pd(y, x);
+  }
+  static auto Add(const Vector a, const Vector b) -> Vector {
+    return _mm_add_pd(a, b);
+  }
+  static auto Sub(const Vector a, const Vector b) -> Vector {
+    return _mm_sub_pd(a, b);
+  }
+  static auto Mul(const Vector a, const Vector b) -> Vector {
+    return _mm_mul_pd(a, b);
+  }
+  static auto Div(const Vector a, const Vector b) -> Vector {
+    return _mm_div_pd(a, b);
+  }
+  static auto MulAdd(const Vector a, const Vector b, const Vector c) -> Vector {
+    return _mm_add_pd(_mm_mul_pd(a, b), c);
+  }
+  static auto Pow2(const Vector kn) -> Vector {
+    const auto n = _mm_slli_epi64(_mm_castpd_si128(kn), 52);
+    const auto one = _mm_castpd_si128(_mm_set1_pd(1.0));
+    return _mm_castsi128_pd(_mm_add_epi64(n, one));
+  }
+};
+
+class Sse2Float {
+ public:
+  typedef float Scalar;
+  typedef __m128 Vector;
+  static const size_t kWidth = 4;
+  static auto Set1(const double x) -> Vector {
+    return _mm_set1_ps(static_cast<float>(x));
+  }
+  static auto Load(const float* x) -> Vector { return _mm_loadu_ps(x); }
+  static auto Store(float* y, const Vector x) -> void {
+    _mm_storeu_ps(y, x);
+  }
+  static auto Add(const Vector a, const Vector b) -> Vector {
+    return _mm_add_ps(a, b);
+  }
+  static auto Sub(const Vector a, const Vector b) -> Vector {
+    return _mm_sub_ps(a, b);
+  }
+  static auto Mul(const Vector a, const Vector b) -> Vector {
+    return _mm_mul_ps(a, b);
+  }
+  static auto Div(const Vector a, const Vector b) -> Vector {
+    return _mm_div_ps(a, b);
+  }
+  static auto MulAdd(const Vector a, const Vector b, const Vector c) -> Vector {
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+  }
+  static auto Pow2(const Vector kn) -> Vector {
+    const auto n = _mm_slli_epi32(_mm_castps_si128(kn), 23);
+    const auto one = _mm_castps_si128(_mm_set1_ps(1.0f));
+    return _mm_castsi128_ps(_mm_add_epi32(n, one));
+  }
+};
+
+auto QuickComputeSse2(const EnvironmentArrays& ambient_conditions,
+                      const size_t count, double* speed_of_sound) -> void {
+  QuickComputeBatch<Sse2>(ambient_conditions, count, speed_of_sound);
+}
+
+auto FastPsvSse2(const double* T, const size_t count, double* Psv,
+                 double* dPsv_dt) -> void {
+  FastPsvBatch<Sse2>(T, count, Psv, dPsv_dt);
+}
+
+auto QuickComputeFloatSse2(const FloatEnvironmentArrays& ambient_conditions,
+                           const size_t count, float* speed_of_sound) -> void {
+  QuickComputeBatch<Sse2Float>(ambient_conditions, count, speed_of_sound);
+}
+
+}  // namespace
+
+const KernelTable kSse2Kernels = {&QuickComputeSse2, &FastPsvSse2,
+                                  &QuickComputeFloatSse2};
+
+#else
+
+const KernelTable kSse2Kernels = {nullptr, nullptr, nullptr};
+
+#endif
+
+}  // namespace internal
+
+}  // namespace speedofsound
@@ -0,0 +1,236 @@
+#include "speed-of-sound-batch.h"
+
+#include "speed-of-sound-batch-kernels.h"
+#include "speed-of-sound-inl.h"
+#include "speed-of-sound-theory.h"
+
+namespace speedofsound {
+
+namespace {
+
+// Environments per FastPsvBatch call in ComputeRateBatch, small enough for the
+// buffers to live on the stack of an 8-bit microcontroller
+const size_t kRateBlockSize = 32;
+
+auto CpuSupports(const BatchKernel kernel) -> bool {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  switch (kernel) {
+    case BatchKernel::kSse2:
+      return __builtin_cpu_supports("sse2");
+    case BatchKernel::kAvx2:
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case BatchKernel::kAvx512:
+      return __builtin_cpu_supports("avx512f");
+    default:
+      return false;
+  }
+#else
+  static_cast<void>(kernel);
+  return false;
+#endif
+}
+
+auto Kernels(const BatchKernel kernel) -> const internal::KernelTable* {
+  switch (kernel) {
+    case BatchKernel::kSse2:
+      return &internal::kSse2Kernels;
+    case BatchKernel::kAvx2:
+      return &internal::kAvx2Kernels;
+    case BatchKernel::kAvx512:
+      return &internal::kAvx512Kernels;
+    default:
+      return nullptr;
+  }
+}
+
+auto SelectKernel(const BatchKernel kernel) -> BatchKernel {
+  return kernel == BatchKernel::kAuto ? BestBatchKernel() : kernel;
+}
+
+}  // namespace
+
+EnvironmentArrays::EnvironmentArrays()
+    : temperature_(nullptr),
+      humidity_(nullptr),
+      pressure_(nullptr),
+      co2_mole_fraction_(nullptr) {}
+
+EnvironmentArrays::EnvironmentArrays(const double* temperature,
+                                     const double* humidity,
+                                     const double* pressure,
+                                     const double* co2_mole_fraction)
+    : temperature_(temperature),
+      humidity_(humidity),
+      pressure_(pressure),
+      co2_mole_fraction_(co2_mole_fraction) {}
+
+FloatEnvironmentArrays::FloatEnvironmentArrays()
+    : temperature_(nullptr),
+      humidity_(nullptr),
+      pressure_(nullptr),
+      co2_mole_fraction_(nullptr) {}
+
+FloatEnvironmentArrays::FloatEnvironmentArrays(const float* temperature,
+                                               const float* humidity,
+                                               const float* pressure,
+                                               const float* co2_mole_fraction)
+    : temperature_(temperature),
+      humidity_(humidity),
+      pressure_(pressure),
+      co2_mole_fraction_(co2_mole_fraction) {}
+
+EnvironmentRateArrays::EnvironmentRateArrays()
+    : temperature_rate_(nullptr),
+      humidity_rate_(nullptr),
+      pressure_rate_(nullptr),
+      co2_mole_fraction_rate_(nullptr) {}
+
+EnvironmentRateArrays::EnvironmentRateArrays(double* temperature_rate,
+                                             double* humidity_rate,
+                                             double* pressure_rate,
+                                             double* co2_mole_fraction_rate)
+    : temperature_rate_(temperature_rate),
+      humidity_rate_(humidity_rate),
+      pressure_rate_(pressure_rate),
+      co2_mole_fraction_rate_(co2_mole_fraction_rate) {}
+
+auto BatchKernelSupported(const BatchKernel kernel) -> bool {
+  if (kernel == BatchKernel::kAuto || kernel == BatchKernel::kScalar) {
+    return true;
+  }
+  const auto kernels = Kernels(kernel);
+  return kernels != nullptr && kernels->quick_compute_ != nullptr &&
+         kernels->fast_psv_ != nullptr &&
+         kernels->float_quick_compute_ != nullptr && CpuSupports(kernel);
+}
+
+auto BestBatchKernel() -> BatchKernel {
+  if (BatchKernelSupported(BatchKernel::kAvx512)) return BatchKernel::kAvx512;
+  if (BatchKernelSupported(BatchKernel::kAvx2)) return BatchKernel::kAvx2;
+  if (BatchKernelSupported(BatchKernel::kSse2)) return BatchKernel::kSse2;
+  return BatchKernel::kScalar;
+}
+
+auto QuickComputeBatch(const EnvironmentArrays& ambient_conditions,
+                       const size_t count, double* speed_of_sound,
+                       const BatchKernel kernel) -> bool {
+  const auto selected_kernel = SelectKernel(kernel);
+  if (!BatchKernelSupported(selected_kernel)) return false;
+  if (selected_kernel == BatchKernel::kScalar) {
+    internal::QuickComputeScalar(ambient_conditions, 0, count, speed_of_sound);
+  } else {
+    Kernels(selected_kernel)
+        ->quick_compute_(ambient_conditions, count, speed_of_sound);
+  }
+  return true;
+}
+
+auto QuickComputeBatch(const FloatEnvironmentArrays& ambient_conditions,
+                       const size_t count, float* speed_of_sound,
+                       const BatchKernel kernel) -> bool {
+  const auto selected_kernel = SelectKernel(kernel);
+  if (!BatchKernelSupported(selected_kernel)) return false;
+  if (selected_kernel == BatchKernel::kScalar) {
+    internal::QuickComputeScalar(ambient_conditions, 0, count, speed_of_sound);
+  } else {
+    Kernels(selected_kernel)
+        ->float_quick_compute_(ambient_conditions, count, speed_of_sound);
+  }
+  return true;
+}
+
+auto ComputeRateBatch(const EnvironmentArrays& ambient_conditions,
+                      const size_t count, double* speed_of_sound,
+                      const EnvironmentRateArrays& rate,
+                      const BatchKernel kernel) -> bool {
+  const auto selected_kernel = SelectKernel(kernel);
+  if (!BatchKernelSupported(selected_kernel)) return false;
+  double T[kRateBlockSize];
+  double Psv[kRateBlockSize];
+  double dPsv_dt[kRateBlockSize];
+  for (size_t begin = 0; begin < count; begin += kRateBlockSize) {
+    const auto block_size =
+        count - begin < kRateBlockSize ? count - begin : kRateBlockSize;
+    for (size_t i = 0; i < block_size; ++i) {
+      T[i] = theory::T(ambient_conditions.temperature_[begin + i]);
+    }
+    FastPsvBatch(T, block_size, Psv, dPsv_dt, selected_kernel);
+    for (size_t i = 0; i < block_size; ++i) {
+      const auto j = begin + i;
+      const Environment environment(
+          ambient_conditions.temperature_[j], ambient_conditions.humidity_[j],
+          ambient_conditions.pressure_[j],
+          ambient_conditions.co2_mole_fraction_[j]);
+      EnvironmentRate environment_rate;
+      speed_of_sound[j] = internal::ComputeRate(environment, Psv[i],
+                                                dPsv_dt[i], &environment_rate);
+      rate.temperature_rate_[j] = environment_rate.temperature_rate_;
+      rate.humidity_rate_[j] = environment_rate.humidity_rate_;
+      rate.pressure_rate_[j] = environment_rate.pressure_rate_;
+      rate.co2_mole_fraction_rate_[j] =
+          environment_rate.co2_mole_fraction_rate_;
+    }
+  }
+  return true;
+}
+
+auto FastPsvBatch(const double* T, const size_t count, double* Psv,
+                  double* dPsv_dt, const BatchKernel kernel) -> bool {
+  const auto selected_kernel = SelectKernel(kernel);
+  if (!BatchKernelSupported(selected_kernel)) return false;
+  if (selected_kernel == BatchKernel::kScalar) {
+    internal::FastPsvScalar(T, 0, count, Psv, dPsv_dt);
+  } else {
+    Kernels(selected_kernel)->fast_psv_(T, count, Psv, dPsv_dt);
+  }
+  return true;
+}
+
+namespace internal {
+
+auto QuickComputeScalar(const EnvironmentArrays& ambient_conditions,
+                        const size_t begin, const size_t end,
+                        double* speed_of_sound) -> void {
+  for (auto i = begin; i < end; ++i) {
+    const auto t = ambient_conditions.temperature_[i];
+    const auto h = ambient_conditions.humidity_[i];
+    const auto p = ambient_conditions.pressure_[i];
+    const auto xc = ambient_conditions.co2_mole_fraction_[i];
+    const auto T = theory::T(t);
+    const auto F = theory::F(p, t);
+    const auto Psv = theory::FastPsv(T);
+    const auto Xw = theory::Xw(h, F, Psv, p);
+    speed_of_sound[i] = theory::C(t, p, Xw, xc);
+  }
+}
+
+auto QuickComputeScalar(const FloatEnvironmentArrays& ambient_conditions,
+                        const size_t begin, const size_t end,
+                        float* speed_of_sound) -> void {
+  for (auto i = begin; i < end; ++i) {
+    const auto t = ambient_conditions.temperature_[i];
+    const auto h = ambient_conditions.humidity_[i];
+    const auto p = ambient_conditions.pressure_[i];
+    const auto xc = ambient_conditions.co2_mole_fraction_[i];
+    const auto T = theory::T(t);
+    const auto F = theory::F(p, t);
+    const auto Psv = theory::FastPsv(T);
+    const auto Xw = theory::Xw(h, F, Psv, p);
+    speed_of_sound[i] = theory::C(t, p, Xw, xc);
+  }
+}
+
+auto FastPsvScalar(const double* T, const size_t begin, const size_t end,
+                   double* Psv, double* dPsv_dt) -> void {
+  for (auto i = begin; i < end; ++i) {
+    if (dPsv_dt == nullptr) {
+      Psv[i] = theory::FastPsv(T[i]);
+    } else {
+      Psv[i] = theory::FastPsvAndDerivative(T[i], &dPsv_dt[i]);
+    }
+  }
+}
+
+}  // namespace internal
+
+}  // namespace speedofsound
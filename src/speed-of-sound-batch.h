@@ -0,0 +1,75 @@
+#ifndef SPEED_OF_SOUND_BATCH_H_
+#define SPEED_OF_SOUND_BATCH_H_
+
+#include <stddef.h>
+
+namespace speedofsound {
+
+class EnvironmentArrays {
+ public:
+  EnvironmentArrays();
+  EnvironmentArrays(const double* temperature, const double* humidity,
+                    const double* pressure, const double* co2_mole_fraction);
+  const double* temperature_;
+  const double* humidity_;
+  const double* pressure_;
+  const double* co2_mole_fraction_;
+};
+
+class FloatEnvironmentArrays {
+ public:
+  FloatEnvironmentArrays();
+  FloatEnvironmentArrays(const float* temperature, const float* humidity,
+                         const float* pressure, const float* co2_mole_fraction);
+  const float* temperature_;
+  const float* humidity_;
+  const float* pressure_;
+  const float* co2_mole_fraction_;
+};
+
+// Outputs of ComputeRateBatch, one array per partial derivative
+class EnvironmentRateArrays {
+ public:
+  EnvironmentRateArrays();
+  EnvironmentRateArrays(double* temperature_rate, double* humidity_rate,
+                        double* pressure_rate, double* co2_mole_fraction_rate);
+  double* temperature_rate_;
+  double* humidity_rate_;
+  double* pressure_rate_;
+  double* co2_mole_fraction_rate_;
+};
+
+enum class BatchKernel { kAuto, kScalar, kSse2, kAvx2, kAvx512 };
+
+// SIMD kernels agree with SpeedOfSound::QuickCompute to within
+// kBatchMaxUlpError units in the last place for valid environments. The
+// scalar kernel is bit-identical to it.
+const int kBatchMaxUlpError = 4;
+// The same for the float kernels and BasicSpeedOfSound<float>::QuickCompute
+const int kFloatBatchMaxUlpError = 2;
+
+auto BatchKernelSupported(const BatchKernel kernel) -> bool;
+auto BestBatchKernel() -> BatchKernel;
+auto QuickComputeBatch(const EnvironmentArrays& ambient_conditions,
+                       const size_t count, double* speed_of_sound,
+                       const BatchKernel kernel = BatchKernel::kAuto) -> bool;
+// Twice the environments per vector of the double kernels
+auto QuickComputeBatch(const FloatEnvironmentArrays& ambient_conditions,
+                       const size_t count, float* speed_of_sound,
+                       const BatchKernel kernel = BatchKernel::kAuto) -> bool;
+// Batch form of SpeedOfSound::ComputeRate, e.g. to recompute many
+// linearization points. Psv and its derivative are evaluated with the kernel,
+// so results agree with ComputeRate like QuickComputeBatch agrees with
+// QuickCompute.
+auto ComputeRateBatch(const EnvironmentArrays& ambient_conditions,
+                      const size_t count, double* speed_of_sound,
+                      const EnvironmentRateArrays& rate,
+                      const BatchKernel kernel = BatchKernel::kAuto) -> bool;
+// Batch form of theory::FastPsvAndDerivative; dPsv_dt may be null
+auto FastPsvBatch(const double* T, const size_t count, double* Psv,
+                  double* dPsv_dt,
+                  const BatchKernel kernel = BatchKernel::kAuto) -> bool;
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_BATCH_H_
@@ -0,0 +1,153 @@
+#include "speed-of-sound-bound.h"
+
+#include "speed-of-sound-theory-inl.h"
+
+namespace speedofsound {
+
+namespace {
+
+const unsigned kT = kBoundTemperature;
+const unsigned kH = kBoundHumidity;
+const unsigned kP = kBoundPressure;
+const unsigned kXc = kBoundCO2MoleFraction;
+
+template <unsigned kBound>
+constexpr auto IsBound(const unsigned inputs) -> bool {
+  return (kBound & inputs) == inputs;
+}
+
+// QuickCompute with the inputs in kBound taken from bound_environment and
+// the terms that depend only on them from bound; the rest are evaluated into
+// terms. The compiler drops the branches, and with them the unused stores to
+// terms.
+template <unsigned kBound>
+auto Evaluate(const Environment& ambient_conitions,
+              const Environment& bound_environment,
+              const internal::BoundTerms& bound, internal::BoundTerms* terms)
+    -> double {
+  using K = theory::Coefficients<double>;
+  const auto t = IsBound<kBound>(kT) ? bound_environment.temperature_
+                                     : ambient_conitions.temperature_;
+  const auto h = IsBound<kBound>(kH) ? bound_environment.humidity_
+                                     : ambient_conitions.humidity_;
+  const auto p = IsBound<kBound>(kP) ? bound_environment.pressure_
+                                     : ambient_conitions.pressure_;
+  const auto xc = IsBound<kBound>(kXc)
+                      ? bound_environment.co2_mole_fraction_
+                      : ambient_conitions.co2_mole_fraction_;
+  if (IsBound<kBound>(kT)) {
+    *terms = bound;
+  } else {
+    terms->Psv_ = theory::FastPsv(theory::T(t));
+    terms->k18tt_ = K::k18 * t * t;
+    terms->A_ = K::k00 + K::k01 * t + K::k02 * t * t;
+    terms->B_ = K::k03 + K::k04 * t + K::k05 * t * t;
+    terms->D_ = K::k06 + K::k07 * t + K::k08 * t * t;
+    terms->E_ = K::k09 + K::k10 * t + K::k11 * t * t;
+  }
+  if (IsBound<kBound>(kP)) {
+    terms->k17p_ = bound.k17p_;
+    terms->k13pp_ = bound.k13pp_;
+  } else {
+    terms->k17p_ = K::k17 * p;
+    terms->k13pp_ = K::k13 * p * p;
+  }
+  terms->k14xcxc_ =
+      IsBound<kBound>(kXc) ? bound.k14xcxc_ : K::k14 * xc * xc;
+  if (IsBound<kBound>(kT | kP)) {
+    terms->F_ = bound.F_;
+    terms->Dp_ = bound.Dp_;
+  } else {
+    terms->F_ = K::k16 + terms->k17p_ + terms->k18tt_;
+    terms->Dp_ = terms->D_ * p;
+  }
+  terms->Exc_ = IsBound<kBound>(kT | kXc) ? bound.Exc_ : terms->E_ * xc;
+  if (IsBound<kBound>(kT | kH | kP)) {
+    terms->Xw_ = bound.Xw_;
+    terms->k12XwXw_ = bound.k12XwXw_;
+    terms->k15Xwp_ = bound.k15Xwp_;
+    terms->C2_ = bound.C2_;
+  } else {
+    const auto Xw = theory::Xw(h, terms->F_, terms->Psv_, p);
+    terms->Xw_ = Xw;
+    terms->k12XwXw_ = K::k12 * Xw * Xw;
+    terms->k15Xwp_ = K::k15 * Xw * p;
+    auto C = terms->A_;
+    C += terms->B_ * Xw;
+    C += terms->Dp_;
+    terms->C2_ = C;
+  }
+  if (IsBound<kBound>(kT | kH | kP | kXc)) return bound.C_;
+  auto C = terms->C2_;
+  C += terms->Exc_;
+  C += terms->k12XwXw_;
+  C += terms->k13pp_;
+  C += terms->k14xcxc_;
+  C += terms->k15Xwp_ * xc;
+  terms->C_ = C;
+  return C;
+}
+
+}  // namespace
+
+namespace internal {
+
+BoundTerms::BoundTerms()
+    : Psv_(0.0),
+      k18tt_(0.0),
+      A_(0.0),
+      B_(0.0),
+      D_(0.0),
+      E_(0.0),
+      k17p_(0.0),
+      k13pp_(0.0),
+      k14xcxc_(0.0),
+      F_(0.0),
+      Dp_(0.0),
+      Exc_(0.0),
+      Xw_(0.0),
+      k12XwXw_(0.0),
+      k15Xwp_(0.0),
+      C2_(0.0),
+      C_(0.0) {}
+
+}  // namespace internal
+
+template <unsigned kBound>
+BoundSpeedOfSound<kBound>::BoundSpeedOfSound(
+    const Environment& bound_conditions)
+    : bound_environment_(bound_conditions) {
+  Evaluate<0>(bound_conditions, bound_conditions, internal::BoundTerms(),
+              &bound_terms_);
+}
+
+template <unsigned kBound>
+auto BoundSpeedOfSound<kBound>::GetBoundEnvironment() const -> Environment {
+  return bound_environment_;
+}
+
+template <unsigned kBound>
+auto BoundSpeedOfSound<kBound>::QuickCompute(
+    const Environment& ambient_conitions) const -> double {
+  internal::BoundTerms terms;
+  return Evaluate<kBound>(ambient_conitions, bound_environment_, bound_terms_,
+                         &terms);
+}
+
+template class BoundSpeedOfSound<1>;
+template class BoundSpeedOfSound<2>;
+template class BoundSpeedOfSound<3>;
+template class BoundSpeedOfSound<4>;
+template class BoundSpeedOfSound<5>;
+template class BoundSpeedOfSound<6>;
+template class BoundSpeedOfSound<7>;
+template class BoundSpeedOfSound<8>;
+template class BoundSpeedOfSound<9>;
+template class BoundSpeedOfSound<10>;
+template class BoundSpeedOfSound<11>;
+template class BoundSpeedOfSound<12>;
+template class BoundSpeedOfSound<13>;
+template class BoundSpeedOfSound<14>;
+template class BoundSpeedOfSound<15>;
+
+}  // namespace speedofsound
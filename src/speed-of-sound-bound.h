@@ -0,0 +1,77 @@
+#ifndef SPEED_OF_SOUND_BOUND_H_
+#define SPEED_OF_SOUND_BOUND_H_
+
+#include "environment.h"
+
+namespace speedofsound {
+
+// Inputs that a BoundSpeedOfSound holds fixed, or'ed together
+enum BoundInput : unsigned {
+  kBoundTemperature = 1,
+  kBoundHumidity = 2,
+  kBoundPressure = 4,
+  kBoundCO2MoleFraction = 8
+};
+
+namespace internal {
+
+// The subexpressions of QuickCompute, grouped by the inputs they depend on
+class BoundTerms {
+ public:
+  BoundTerms();
+  // t
+  double Psv_;
+  double k18tt_;
+  double A_;
+  double B_;
+  double D_;
+  double E_;
+  // p
+  double k17p_;
+  double k13pp_;
+  // xc
+  double k14xcxc_;
+  // t, p
+  double F_;
+  double Dp_;
+  // t, xc
+  double Exc_;
+  // t, h, p
+  double Xw_;
+  double k12XwXw_;
+  double k15Xwp_;
+  double C2_;  // A + B Xw + D p
+  // all inputs
+  double C_;
+};
+
+}  // namespace internal
+
+// QuickCompute partially evaluated at the inputs in kBound. Everything in
+// the model that depends only on bound inputs is evaluated once by the
+// constructor; for a bound temperature that is Psv and the coefficients of
+// C, which leaves a division and a low order polynomial in Xw, p and xc per
+// call. Terms are evaluated as in QuickCompute, so results are identical.
+template <unsigned kBound>
+class BoundSpeedOfSound {
+  static_assert(kBound != 0 && kBound <= 15, "kBound is a set of BoundInput");
+
+ public:
+  // Binds the inputs in kBound to their values in bound_conditions
+  explicit BoundSpeedOfSound(const Environment& bound_conditions);
+  auto GetBoundEnvironment() const -> Environment;
+  // QuickCompute at ambient_conitions with the bound inputs replaced by
+  // their bound values
+  auto QuickCompute(const Environment& ambient_conitions) const -> double;
+
+ private:
+  Environment bound_environment_;
+  internal::BoundTerms bound_terms_;
+};
+
+// Temperature fixed for a frame while the other inputs vary per channel
+using TemperatureBoundSpeedOfSound = BoundSpeedOfSound<kBoundTemperature>;
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_BOUND_H_
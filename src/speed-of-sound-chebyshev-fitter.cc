@@ -0,0 +1,181 @@
+#include "speed-of-sound-chebyshev-fitter.h"
+
+#include <math.h>
+
+#include <algorithm>
+
+#include "speed-of-sound-theory.h"
+#include "speed-of-sound.h"
+
+namespace speedofsound {
+
+namespace {
+
+const size_t kNodes = kMaxChebyshevDegree + 1;
+const size_t kCoefficients = kNodes * kNodes * kNodes * kNodes;
+const double kMin[4] = {theory::kMinTemperature, theory::kMinHumidity,
+                        theory::kMinPressure, theory::kMinCO2MoleFraction};
+const double kMax[4] = {theory::kMaxTemperature, theory::kMaxHumidity,
+                        theory::kMaxPressure, theory::kMaxCO2MoleFraction};
+
+auto Node(const size_t axis, const size_t index) -> double {
+  const auto u = cos(M_PI * (index + 0.5) / kNodes);
+  return kMin[axis] + (kMax[axis] - kMin[axis]) * (u + 1.0) / 2.0;
+}
+
+auto GridValue(const size_t axis, const size_t points, const size_t index)
+    -> double {
+  return kMin[axis] +
+         (kMax[axis] - kMin[axis]) * index / static_cast<double>(points - 1);
+}
+
+// Degree of the coefficient at index along axis (0 is temperature)
+auto AxisDegree(const size_t index, const size_t axis) -> size_t {
+  auto stride = kCoefficients;
+  for (size_t outer = 0; outer <= axis; ++outer) stride /= kNodes;
+  return (index / stride) % kNodes;
+}
+
+}  // namespace
+
+ChebyshevFitter::ChebyshevFitter() : max_error_(0.0) {}
+
+auto ChebyshevFitter::Fit(const double tolerance) -> bool {
+  Reset();
+  if (!(tolerance > 0.0)) return false;
+  Interpolate();
+  if (!SelectTerms(tolerance)) {
+    Reset();
+    return false;
+  }
+  max_error_ = ComputeMaxError();
+  if (max_error_ > tolerance) {
+    Reset();
+    return false;
+  }
+  return true;
+}
+
+auto ChebyshevFitter::IsValid() const -> bool { return !terms_.empty(); }
+
+auto ChebyshevFitter::GetDegree() const -> ChebyshevDegree { return degree_; }
+
+auto ChebyshevFitter::GetTerms() const -> const std::vector<ChebyshevTerm>& {
+  return terms_;
+}
+
+auto ChebyshevFitter::GetMaxError() const -> double { return max_error_; }
+
+auto ChebyshevFitter::GetSurrogate() const -> ChebyshevSurrogate {
+  if (!IsValid()) return ChebyshevSurrogate();
+  return ChebyshevSurrogate(degree_, terms_.data(), terms_.size(), max_error_);
+}
+
+// Samples QuickCompute at the Chebyshev nodes and applies a discrete cosine
+// transform along one axis at a time
+auto ChebyshevFitter::Interpolate() -> void {
+  if (!coefficients_.empty()) return;
+  coefficients_.resize(kCoefficients);
+  const SpeedOfSound speed_of_sound;
+  Environment environment;
+  for (size_t i = 0; i < kCoefficients; ++i) {
+    environment.temperature_ = Node(0, AxisDegree(i, 0));
+    environment.humidity_ = Node(1, AxisDegree(i, 1));
+    environment.pressure_ = Node(2, AxisDegree(i, 2));
+    environment.co2_mole_fraction_ = Node(3, AxisDegree(i, 3));
+    coefficients_[i] = speed_of_sound.QuickCompute(environment);
+  }
+  std::vector<double> transformed(kCoefficients);
+  auto stride = kCoefficients;
+  for (size_t axis = 0; axis < 4; ++axis) {
+    stride /= kNodes;
+    for (size_t i = 0; i < kCoefficients; ++i) {
+      const auto degree = AxisDegree(i, axis);
+      const auto first = i - degree * stride;
+      auto sum = 0.0;
+      for (size_t node = 0; node < kNodes; ++node) {
+        sum += coefficients_[first + node * stride] *
+               cos(M_PI * degree * (node + 0.5) / kNodes);
+      }
+      transformed[i] = sum * (degree == 0 ? 1.0 : 2.0) / kNodes;
+    }
+    coefficients_.swap(transformed);
+  }
+}
+
+// |T_n| <= 1, so the dropped coefficients bound the truncation error. Dropping
+// the smallest first keeps the fewest terms.
+auto ChebyshevFitter::SelectTerms(const double tolerance) -> bool {
+  std::vector<size_t> order;
+  auto dropped = 0.0;
+  for (size_t i = 0; i < kCoefficients; ++i) {
+    auto highest = false;
+    for (size_t axis = 0; axis < 4; ++axis) {
+      highest = highest || AxisDegree(i, axis) == kMaxChebyshevDegree;
+    }
+    if (highest) {
+      dropped += fabs(coefficients_[i]);
+    } else {
+      order.push_back(i);
+    }
+  }
+  if (dropped > tolerance) return false;
+  std::sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+    return fabs(coefficients_[a]) < fabs(coefficients_[b]);
+  });
+  auto first_kept = order.begin();
+  while (first_kept != order.end() &&
+         dropped + fabs(coefficients_[*first_kept]) <= tolerance) {
+    dropped += fabs(coefficients_[*first_kept]);
+    ++first_kept;
+  }
+  std::sort(first_kept, order.end());
+  size_t degrees[4] = {0, 0, 0, 0};
+  for (auto i = first_kept; i != order.end(); ++i) {
+    for (size_t axis = 0; axis < 4; ++axis) {
+      degrees[axis] = std::max(degrees[axis], AxisDegree(*i, axis));
+    }
+    terms_.push_back(ChebyshevTerm(coefficients_[*i],
+                                   static_cast<uint8_t>(AxisDegree(*i, 0)),
+                                   static_cast<uint8_t>(AxisDegree(*i, 1)),
+                                   static_cast<uint8_t>(AxisDegree(*i, 2)),
+                                   static_cast<uint8_t>(AxisDegree(*i, 3))));
+  }
+  degree_ = ChebyshevDegree(degrees[0], degrees[1], degrees[2], degrees[3]);
+  return !terms_.empty();
+}
+
+auto ChebyshevFitter::ComputeMaxError() const -> double {
+  const size_t points[4] = {4 * degree_.temperature_degree_ + 5,
+                            4 * degree_.humidity_degree_ + 5,
+                            4 * degree_.pressure_degree_ + 5,
+                            4 * degree_.co2_mole_fraction_degree_ + 5};
+  const auto surrogate = GetSurrogate();
+  const SpeedOfSound speed_of_sound;
+  Environment environment;
+  auto max_error = 0.0;
+  for (size_t t = 0; t < points[0]; ++t) {
+    environment.temperature_ = GridValue(0, points[0], t);
+    for (size_t h = 0; h < points[1]; ++h) {
+      environment.humidity_ = GridValue(1, points[1], h);
+      for (size_t p = 0; p < points[2]; ++p) {
+        environment.pressure_ = GridValue(2, points[2], p);
+        for (size_t xc = 0; xc < points[3]; ++xc) {
+          environment.co2_mole_fraction_ = GridValue(3, points[3], xc);
+          const auto error = fabs(surrogate.Evaluate(environment) -
+                                  speed_of_sound.QuickCompute(environment));
+          max_error = error > max_error ? error : max_error;
+        }
+      }
+    }
+  }
+  return max_error;
+}
+
+auto ChebyshevFitter::Reset() -> void {
+  terms_.clear();
+  degree_ = ChebyshevDegree();
+  max_error_ = 0.0;
+}
+
+}  // namespace speedofsound
@@ -0,0 +1,41 @@
+#ifndef SPEED_OF_SOUND_CHEBYSHEV_FITTER_H_
+#define SPEED_OF_SOUND_CHEBYSHEV_FITTER_H_
+
+#include <vector>
+
+#include "speed-of-sound-chebyshev.h"
+
+namespace speedofsound {
+
+// Interpolates QuickCompute at the Chebyshev nodes of degree
+// kMaxChebyshevDegree on every axis and keeps the fewest terms whose dropped
+// coefficients sum to at most the tolerance (m/s). Terms of the highest degree
+// estimate the interpolation error, so they are always dropped.
+class ChebyshevFitter {
+ public:
+  ChebyshevFitter();
+  auto Fit(const double tolerance) -> bool;
+  auto IsValid() const -> bool;
+  auto GetDegree() const -> ChebyshevDegree;
+  auto GetTerms() const -> const std::vector<ChebyshevTerm>&;
+  // Largest absolute difference from QuickCompute (m/s), sampled on a grid
+  // four times finer than the degree on every axis
+  auto GetMaxError() const -> double;
+  // References the fitted terms, so it is invalidated by the next Fit
+  auto GetSurrogate() const -> ChebyshevSurrogate;
+
+ private:
+  auto Interpolate() -> void;
+  auto SelectTerms(const double tolerance) -> bool;
+  auto ComputeMaxError() const -> double;
+  auto Reset() -> void;
+
+  std::vector<double> coefficients_;
+  std::vector<ChebyshevTerm> terms_;
+  ChebyshevDegree degree_;
+  double max_error_;
+};
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_CHEBYSHEV_FITTER_H_
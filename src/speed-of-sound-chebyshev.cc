@@ -0,0 +1,84 @@
+#include "speed-of-sound-chebyshev.h"
+
+#include <math.h>
+
+namespace speedofsound {
+
+namespace {
+
+// T_0(u) ... T_degree(u) by the three-term recurrence
+auto Chebyshev(const double x, const double min, const double max,
+               const size_t degree, double* values) -> void {
+  const auto u = (2.0 * x - (min + max)) * (1.0 / (max - min));
+  values[0] = 1.0;
+  values[1] = u;
+  for (size_t n = 2; n <= degree; ++n) {
+    values[n] = 2.0 * u * values[n - 1] - values[n - 2];
+  }
+}
+
+}  // namespace
+
+auto ChebyshevDegree::Validate() const -> bool {
+  return temperature_degree_ <= kMaxChebyshevDegree &&
+         humidity_degree_ <= kMaxChebyshevDegree &&
+         pressure_degree_ <= kMaxChebyshevDegree &&
+         co2_mole_fraction_degree_ <= kMaxChebyshevDegree;
+}
+
+auto ChebyshevSurrogate::IsValid() const -> bool {
+  if (terms_ == nullptr || term_count_ == 0 || !degree_.Validate()) {
+    return false;
+  }
+  for (size_t i = 0; i < term_count_; ++i) {
+    if (terms_[i].temperature_degree_ > degree_.temperature_degree_ ||
+        terms_[i].humidity_degree_ > degree_.humidity_degree_ ||
+        terms_[i].pressure_degree_ > degree_.pressure_degree_ ||
+        terms_[i].co2_mole_fraction_degree_ >
+            degree_.co2_mole_fraction_degree_) {
+      return false;
+    }
+  }
+  return true;
+}
+
+auto ChebyshevSurrogate::GetDegree() const -> ChebyshevDegree {
+  return degree_;
+}
+
+auto ChebyshevSurrogate::GetTerms() const -> const ChebyshevTerm* {
+  return terms_;
+}
+
+auto ChebyshevSurrogate::GetTermCount() const -> size_t { return term_count_; }
+
+auto ChebyshevSurrogate::GetMaxError() const -> double { return max_error_; }
+
+auto ChebyshevSurrogate::Evaluate(const Environment& ambient_conditions) const
+    -> double {
+  // The polynomial values below have room for kMaxChebyshevDegree only
+  if (!degree_.Validate()) return NAN;
+  double t[kMaxChebyshevDegree + 1];
+  double h[kMaxChebyshevDegree + 1];
+  double p[kMaxChebyshevDegree + 1];
+  double xc[kMaxChebyshevDegree + 1];
+  Chebyshev(ambient_conditions.temperature_, theory::kMinTemperature,
+            theory::kMaxTemperature, degree_.temperature_degree_, t);
+  Chebyshev(ambient_conditions.humidity_, theory::kMinHumidity,
+            theory::kMaxHumidity, degree_.humidity_degree_, h);
+  Chebyshev(ambient_conditions.pressure_, theory::kMinPressure,
+            theory::kMaxPressure, degree_.pressure_degree_, p);
+  Chebyshev(ambient_conditions.co2_mole_fraction_, theory::kMinCO2MoleFraction,
+            theory::kMaxCO2MoleFraction, degree_.co2_mole_fraction_degree_, xc);
+  auto speed_of_sound = 0.0;
+  for (size_t i = 0; i < term_count_; ++i) {
+    const auto& term = terms_[i];
+    speed_of_sound +=
+        term.coefficient_ *
+        (t[term.temperature_degree_] * h[term.humidity_degree_]) *
+        (p[term.pressure_degree_] * xc[term.co2_mole_fraction_degree_]);
+  }
+  return speed_of_sound;
+}
+
+}  // namespace speedofsound
@@ -0,0 +1,98 @@
+#ifndef SPEED_OF_SOUND_CHEBYSHEV_H_
+#define SPEED_OF_SOUND_CHEBYSHEV_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "environment.h"
+
+namespace speedofsound {
+
+constexpr size_t kMaxChebyshevDegree = 11;
+
+class ChebyshevDegree {
+ public:
+  constexpr ChebyshevDegree()
+      : temperature_degree_(0),
+        humidity_degree_(0),
+        pressure_degree_(0),
+        co2_mole_fraction_degree_(0) {}
+  constexpr ChebyshevDegree(const size_t temperature_degree,
+                            const size_t humidity_degree,
+                            const size_t pressure_degree,
+                            const size_t co2_mole_fraction_degree)
+      : temperature_degree_(temperature_degree),
+        humidity_degree_(humidity_degree),
+        pressure_degree_(pressure_degree),
+        co2_mole_fraction_degree_(co2_mole_fraction_degree) {}
+  auto Validate() const -> bool;
+  size_t temperature_degree_;
+  size_t humidity_degree_;
+  size_t pressure_degree_;
+  size_t co2_mole_fraction_degree_;
+};
+
+// coefficient * T_i(t) * T_j(h) * T_k(p) * T_l(xc), where T_n is the Chebyshev
+// polynomial of degree n and each variable is mapped from its valid range onto
+// [-1, 1]
+class ChebyshevTerm {
+ public:
+  constexpr ChebyshevTerm()
+      : coefficient_(0.0),
+        temperature_degree_(0),
+        humidity_degree_(0),
+        pressure_degree_(0),
+        co2_mole_fraction_degree_(0) {}
+  constexpr ChebyshevTerm(const double coefficient,
+                          const uint8_t temperature_degree,
+                          const uint8_t humidity_degree,
+                          const uint8_t pressure_degree,
+                          const uint8_t co2_mole_fraction_degree)
+      : coefficient_(coefficient),
+        temperature_degree_(temperature_degree),
+        humidity_degree_(humidity_degree),
+        pressure_degree_(pressure_degree),
+        co2_mole_fraction_degree_(co2_mole_fraction_degree) {}
+  double coefficient_;
+  uint8_t temperature_degree_;
+  uint8_t humidity_degree_;
+  uint8_t pressure_degree_;
+  uint8_t co2_mole_fraction_degree_;
+};
+
+// Sparse Chebyshev series over the valid environment range, with no exp or
+// division. The degree bounds every term on each axis. Terms are not copied,
+// so they must outlive the surrogate (e.g. an array generated by
+// chebyshev-fitter). Several times slower than QuickCompute, so it is part of
+// the host library, for comparison, rather than the core one.
+class ChebyshevSurrogate {
+ public:
+  constexpr ChebyshevSurrogate()
+      : degree_(), terms_(nullptr), term_count_(0), max_error_(0.0) {}
+  constexpr ChebyshevSurrogate(const ChebyshevDegree& degree,
+                               const ChebyshevTerm* terms,
+                               const size_t term_count, const double max_error)
+      : degree_(degree),
+        terms_(terms),
+        term_count_(term_count),
+        max_error_(max_error) {}
+  auto IsValid() const -> bool;
+  auto GetDegree() const -> ChebyshevDegree;
+  auto GetTerms() const -> const ChebyshevTerm*;
+  auto GetTermCount() const -> size_t;
+  // Largest absolute difference from QuickCompute (m/s) measured by the fitter
+  auto GetMaxError() const -> double;
+  // NaN if the degree exceeds kMaxChebyshevDegree. Terms are expected to be
+  // within the degree, as IsValid checks.
+  auto Evaluate(const Environment& ambient_conditions) const -> double;
+
+ private:
+  ChebyshevDegree degree_;
+  const ChebyshevTerm* terms_;
+  size_t term_count_;
+  double max_error_;
+};
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_CHEBYSHEV_H_
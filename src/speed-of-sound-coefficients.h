@@ -0,0 +1,67 @@
+#ifndef SPEED_OF_SOUND_COEFFICIENTS_H_
+#define SPEED_OF_SOUND_COEFFICIENTS_H_
+
+namespace speedofsound {
+
+namespace theory {
+
+// Experimental constants shared by the reference model and the batch kernels
+constexpr double k00 = 3.315024000e+02;
+constexpr double k01 = 6.030550000e-01;
+constexpr double k02 = -5.280000000e-04;
+constexpr double k03 = 5.147193500e+01;
+constexpr double k04 = 1.495874000e-01;
+constexpr double k05 = -7.820000000e-04;
+constexpr double k06 = -1.820000000e-07;
+constexpr double k07 = 3.730000000e-08;
+constexpr double k08 = -2.930000000e-10;
+constexpr double k09 = -8.520931000e+01;
+constexpr double k10 = -2.285250000e-01;
+constexpr double k11 = 5.910000000e-05;
+constexpr double k12 = -2.835149000e+00;
+constexpr double k13 = -2.150000000e-13;
+constexpr double k14 = 2.917976200e+01;
+constexpr double k15 = 4.860000000e-04;
+constexpr double k16 = 1.000620000e+00;
+constexpr double k17 = 3.140000000e-08;
+constexpr double k18 = 5.600000000e-07;
+constexpr double k19 = 1.281180500e-05;
+constexpr double k20 = -1.950987400e-02;
+constexpr double k21 = 3.404926034e+01;
+constexpr double k22 = -6.353631100e+03;
+
+// The constants above rounded to the scalar type of the model, so that float
+// instantiations do not promote to double
+template <typename Scalar>
+class Coefficients {
+ public:
+  static constexpr Scalar k00 = static_cast<Scalar>(theory::k00);
+  static constexpr Scalar k01 = static_cast<Scalar>(theory::k01);
+  static constexpr Scalar k02 = static_cast<Scalar>(theory::k02);
+  static constexpr Scalar k03 = static_cast<Scalar>(theory::k03);
+  static constexpr Scalar k04 = static_cast<Scalar>(theory::k04);
+  static constexpr Scalar k05 = static_cast<Scalar>(theory::k05);
+  static constexpr Scalar k06 = static_cast<Scalar>(theory::k06);
+  static constexpr Scalar k07 = static_cast<Scalar>(theory::k07);
+  static constexpr Scalar k08 = static_cast<Scalar>(theory::k08);
+  static constexpr Scalar k09 = static_cast<Scalar>(theory::k09);
+  static constexpr Scalar k10 = static_cast<Scalar>(theory::k10);
+  static constexpr Scalar k11 = static_cast<Scalar>(theory::k11);
+  static constexpr Scalar k12 = static_cast<Scalar>(theory::k12);
+  static constexpr Scalar k13 = static_cast<Scalar>(theory::k13);
+  static constexpr Scalar k14 = static_cast<Scalar>(theory::k14);
+  static constexpr Scalar k15 = static_cast<Scalar>(theory::k15);
+  static constexpr Scalar k16 = static_cast<Scalar>(theory::k16);
+  static constexpr Scalar k17 = static_cast<Scalar>(theory::k17);
+  static constexpr Scalar k18 = static_cast<Scalar>(theory::k18);
+  static constexpr Scalar k19 = static_cast<Scalar>(theory::k19);
+  static constexpr Scalar k20 = static_cast<Scalar>(theory::k20);
+  static constexpr Scalar k21 = static_cast<Scalar>(theory::k21);
+  static constexpr Scalar k22 = static_cast<Scalar>(theory::k22);
+};
+
+}  // namespace theory
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_COEFFICIENTS_H_
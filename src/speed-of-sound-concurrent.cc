@@ -0,0 +1,91 @@
+#include "speed-of-sound-concurrent.h"
+
+#include "speed-of-sound-inl.h"
+
+namespace speedofsound {
+
+ConcurrentSpeedOfSound::ConcurrentSpeedOfSound() : sequence_(0) {
+  Publish(SpeedOfSound());
+}
+
+ConcurrentSpeedOfSound::ConcurrentSpeedOfSound(
+    const Environment& ambient_conitions)
+    : sequence_(0) {
+  Publish(SpeedOfSound(ambient_conitions));
+}
+
+auto ConcurrentSpeedOfSound::Compute(const Environment& ambient_conitions)
+    -> double {
+  const SpeedOfSound speed_of_sound(ambient_conitions);
+  Publish(speed_of_sound);
+  return speed_of_sound.GetInitSpeedOfSound();
+}
+
+auto ConcurrentSpeedOfSound::Publish(const SpeedOfSound& speed_of_sound)
+    -> void {
+  const auto environment = speed_of_sound.GetInitEnvironment();
+  const auto rate = speed_of_sound.GetInitEnvironmentRate();
+  const auto relaxed = std::memory_order_relaxed;
+  std::lock_guard<std::mutex> lock(writer_mutex_);
+  // The fence keeps the fields from being written before readers can see the
+  // odd sequence number
+  const auto sequence = sequence_.load(relaxed);
+  sequence_.store(sequence + 1, relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  speed_of_sound_.store(speed_of_sound.GetInitSpeedOfSound(), relaxed);
+  temperature_.store(environment.temperature_, relaxed);
+  humidity_.store(environment.humidity_, relaxed);
+  pressure_.store(environment.pressure_, relaxed);
+  co2_mole_fraction_.store(environment.co2_mole_fraction_, relaxed);
+  temperature_rate_.store(rate.temperature_rate_, relaxed);
+  humidity_rate_.store(rate.humidity_rate_, relaxed);
+  pressure_rate_.store(rate.pressure_rate_, relaxed);
+  co2_mole_fraction_rate_.store(rate.co2_mole_fraction_rate_, relaxed);
+  sequence_.store(sequence + 2, std::memory_order_release);
+}
+
+// The acquire fence orders the relaxed loads of the fields before the second
+// load of the sequence number, so an unchanged even number means that no
+// publication overlapped them. Inline, as the call would cost as much as
+// the approximation.
+inline auto ConcurrentSpeedOfSound::Load() const -> Point {
+  const auto relaxed = std::memory_order_relaxed;
+  for (;;) {
+    const auto sequence = sequence_.load(std::memory_order_acquire);
+    Point point;
+    point.speed_of_sound_ = speed_of_sound_.load(relaxed);
+    point.environment_.temperature_ = temperature_.load(relaxed);
+    point.environment_.humidity_ = humidity_.load(relaxed);
+    point.environment_.pressure_ = pressure_.load(relaxed);
+    point.environment_.co2_mole_fraction_ = co2_mole_fraction_.load(relaxed);
+    point.rate_.temperature_rate_ = temperature_rate_.load(relaxed);
+    point.rate_.humidity_rate_ = humidity_rate_.load(relaxed);
+    point.rate_.pressure_rate_ = pressure_rate_.load(relaxed);
+    point.rate_.co2_mole_fraction_rate_ =
+        co2_mole_fraction_rate_.load(relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if ((sequence & 1) == 0 && sequence_.load(relaxed) == sequence) {
+      return point;
+    }
+  }
+}
+
+auto ConcurrentSpeedOfSound::Approximate(
+    const Environment& ambient_conitions) const -> double {
+  const auto point = Load();
+  return internal::LinearApproximation(point.environment_,
+                                       point.speed_of_sound_, point.rate_,
+                                       ambient_conitions);
+}
+
+auto ConcurrentSpeedOfSound::GetSpeedOfSound() const -> SpeedOfSound {
+  const auto point = Load();
+  return SpeedOfSound(point.environment_, point.speed_of_sound_, point.rate_,
+                      EnvironmentCurvature(), ApproximationOrder::kLinear);
+}
+
+auto ConcurrentSpeedOfSound::GetPublishCount() const -> uint64_t {
+  return sequence_.load(std::memory_order_acquire) / 2;
+}
+
+}  // namespace speedofsound
@@ -0,0 +1,62 @@
+#ifndef SPEED_OF_SOUND_CONCURRENT_H_
+#define SPEED_OF_SOUND_CONCURRENT_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <mutex>
+
+#include "environment.h"
+#include "speed-of-sound.h"
+
+namespace speedofsound {
+
+// Linear approximation around a linearization point that a writer thread can
+// move while other threads keep approximating. The point is published through
+// a sequence lock: readers take no lock and write nothing shared, and retry
+// only if they overlap a publication, so they never see a torn point.
+class ConcurrentSpeedOfSound {
+ public:
+  ConcurrentSpeedOfSound();
+  explicit ConcurrentSpeedOfSound(const Environment& ambient_conitions);
+  // Computes a new linearization point outside the lock and publishes it.
+  // Writers are serialized with each other.
+  auto Compute(const Environment& ambient_conitions) -> double;
+  // Publishes the linear part of the linearization point of speed_of_sound
+  auto Publish(const SpeedOfSound& speed_of_sound) -> void;
+  // Safe from any number of threads
+  auto Approximate(const Environment& ambient_conitions) const -> double;
+  // A consistent copy of the current point, for EstimateError and the like
+  auto GetSpeedOfSound() const -> SpeedOfSound;
+  // Publications since construction, including the first
+  auto GetPublishCount() const -> uint64_t;
+
+ private:
+  class Point {
+   public:
+    double speed_of_sound_;
+    Environment environment_;
+    EnvironmentRate rate_;
+  };
+
+  auto Load() const -> Point;
+
+  // Odd while a publication is in progress
+  alignas(64) std::atomic<uint64_t> sequence_;
+  // The fields of Point, each an atomic so that a read overlapping a
+  // publication is not a data race
+  std::atomic<double> speed_of_sound_;
+  std::atomic<double> temperature_;
+  std::atomic<double> humidity_;
+  std::atomic<double> pressure_;
+  std::atomic<double> co2_mole_fraction_;
+  std::atomic<double> temperature_rate_;
+  std::atomic<double> humidity_rate_;
+  std::atomic<double> pressure_rate_;
+  std::atomic<double> co2_mole_fraction_rate_;
+  std::mutex writer_mutex_;
+};
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_CONCURRENT_H_
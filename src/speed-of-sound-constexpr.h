@@ -0,0 +1,349 @@
+#ifndef SPEED_OF_SOUND_CONSTEXPR_H_
+#define SPEED_OF_SOUND_CONSTEXPR_H_
+
+#include "speed-of-sound-coefficients.h"
+#include "speed-of-sound-theory.h"
+
+#include "environment.h"
+#include "speed-of-sound.h"
+
+namespace speedofsound {
+
+namespace theory {
+
+// constexpr versions of the theory functions, usable in constant expressions
+// under C++11. Sums are evaluated in the same order as in
+// speed-of-sound-theory-inl.h, so results differ from the run-time model only
+// through the exponential in Psv.
+namespace compile_time {
+
+constexpr auto T(const double t) -> double { return t + 273.15; }
+constexpr auto dT_dt() -> double { return 1.0; }
+
+namespace internal {
+
+constexpr double kLog2e = 1.4426950408889634;
+// ln(2) split so that k * kLn2Hi is exact for |k| < 2^20
+constexpr double kLn2Hi = 6.93147180369123816490e-01;
+constexpr double kLn2Lo = 1.90821492927058770002e-10;
+constexpr int kExpTaylorDegree = 14;
+
+constexpr auto Square(const double x) -> double { return x * x; }
+
+constexpr auto Pow2(const int k) -> double {
+  return k < 0 ? 1.0 / Pow2(-k)
+               : k == 0 ? 1.0
+                        : (k % 2 == 0 ? 1.0 : 2.0) * Square(Pow2(k / 2));
+}
+
+constexpr auto Round(const double x) -> int {
+  return x < 0.0 ? static_cast<int>(x - 0.5) : static_cast<int>(x + 0.5);
+}
+
+// 1 + r / n * (1 + r / (n + 1) * (...)), for |r| <= ln(2) / 2
+constexpr auto ExpTaylor(const double r, const int n) -> double {
+  return n > kExpTaylorDegree ? 1.0 : 1.0 + r / n * ExpTaylor(r, n + 1);
+}
+
+constexpr auto ExpReduced(const double x, const int k) -> double {
+  return Pow2(k) * ExpTaylor(x - k * kLn2Hi - k * kLn2Lo, 1);
+}
+
+constexpr auto PsvExponent(const double T) -> double {
+  return k19 * T * T + k20 * T + k21 + k22 / T;
+}
+
+constexpr auto dPsvExponent_dT(const double T) -> double {
+  return 2.0 * k19 * T + k20 - k22 / (T * T);
+}
+
+constexpr auto d2Psv_dt2(const double T, const double Psv,
+                         const double dexponent_dT) -> double {
+  return (dexponent_dT * dexponent_dT + (2.0 * k19 + 2.0 * k22 / (T * T * T))) *
+         Psv * (dT_dt() * dT_dt());
+}
+
+}  // namespace internal
+
+// Valid for |x| <= 700
+constexpr double kMaxExpRelativeError = 4.0e-16;
+constexpr auto Exp(const double x) -> double {
+  return internal::ExpReduced(x, internal::Round(x * internal::kLog2e));
+}
+
+constexpr auto F(const double p, const double t) -> double {
+  return k16 + k17 * p + k18 * t * t;
+}
+constexpr auto dF_dp() -> double { return k17; }
+constexpr auto dF_dt(const double t) -> double { return 2.0 * k18 * t; }
+
+constexpr auto Psv(const double T) -> double {
+  return Exp(internal::PsvExponent(T));
+}
+constexpr auto dPsv_dt(const double T) -> double {
+  return internal::dPsvExponent_dT(T) * Psv(T) * dT_dt();
+}
+
+constexpr auto Xw(const double h, const double F, const double Psv,
+                  const double p) -> double {
+  return h * F * Psv / p;
+}
+constexpr auto dXw_dh(const double F, const double Psv, const double p)
+    -> double {
+  return F * Psv / p;
+}
+constexpr auto dXw_dF(const double h, const double Psv, const double p)
+    -> double {
+  return h * Psv / p;
+}
+constexpr auto dXw_dPsv(const double h, const double F, const double p)
+    -> double {
+  return h * F / p;
+}
+constexpr auto dXw_dp(const double h, const double F, const double Psv,
+                      const double p) -> double {
+  return -h * F * Psv / (p * p) + h * dF_dp() * Psv / p;
+}
+
+constexpr auto C(const double t, const double p, const double Xw,
+                 const double xc) -> double {
+  return k00 + k01 * t + k02 * t * t + (k03 + k04 * t + k05 * t * t) * Xw +
+         (k06 + k07 * t + k08 * t * t) * p +
+         (k09 + k10 * t + k11 * t * t) * xc + k12 * Xw * Xw + k13 * p * p +
+         k14 * xc * xc + k15 * Xw * p * xc;
+}
+constexpr auto dC_dt(const double t, const double p, const double Xw,
+                     const double xc, const double dXw_dF, const double dF_dt,
+                     const double dXw_dPsv, const double dPsv_dt) -> double {
+  return k01 + 2.0 * k02 * t + (k04 + 2.0 * k05 * t) * Xw +
+         (k03 + k04 * t + k05 * t * t) * dXw_dPsv * dPsv_dt +
+         (k03 + k04 * t + k05 * t * t) * dXw_dF * dF_dt +
+         (k07 + 2.0 * k08 * t) * p + (k10 + 2.0 * k11 * t) * xc +
+         2.0 * k12 * Xw * dXw_dPsv * dPsv_dt + 2.0 * k12 * Xw * dXw_dF * dF_dt +
+         k15 * p * xc * dXw_dPsv * dPsv_dt + k15 * p * xc * dXw_dF * dF_dt;
+}
+constexpr auto dC_dXw(const double t, const double p, const double Xw,
+                      const double xc) -> double {
+  return k03 + k04 * t + k05 * t * t + 2.0 * k12 * Xw + k15 * xc * p;
+}
+constexpr auto dC_dxc(const double t, const double p, const double Xw,
+                      const double xc) -> double {
+  return k09 + k10 * t + k11 * t * t + 2.0 * k14 * xc + k15 * p * Xw;
+}
+constexpr auto dC_dp(const double t, const double p, const double Xw,
+                     const double xc, const double dXw_dp) -> double {
+  return (k03 + k04 * t + k05 * t * t) * dXw_dp +
+         (k06 + k07 * t + k08 * t * t) + 2.0 * k12 * Xw * dXw_dp +
+         2.0 * k13 * p + k15 * dXw_dp * p * xc + k15 * Xw * xc;
+}
+constexpr auto dC_dh(const double dC_dXw, const double dXw_dh) -> double {
+  return dC_dXw * dXw_dh;
+}
+
+constexpr auto d2F_dt2() -> double { return 2.0 * k18; }
+
+constexpr auto d2Psv_dt2(const double T, const double Psv) -> double {
+  return internal::d2Psv_dt2(T, Psv, internal::dPsvExponent_dT(T));
+}
+
+constexpr auto d2Xw_dt2(const double h, const double F, const double Psv,
+                        const double p, const double dF_dt,
+                        const double dPsv_dt, const double d2F_dt2,
+                        const double d2Psv_dt2) -> double {
+  return h * (d2F_dt2 * Psv + 2.0 * dF_dt * dPsv_dt + F * d2Psv_dt2) / p;
+}
+constexpr auto d2Xw_dtdh(const double F, const double Psv, const double p,
+                         const double dF_dt, const double dPsv_dt) -> double {
+  return (dF_dt * Psv + F * dPsv_dt) / p;
+}
+constexpr auto d2Xw_dtdp(const double h, const double F, const double Psv,
+                         const double p, const double dF_dt,
+                         const double dPsv_dt) -> double {
+  return h * dF_dp() * dPsv_dt / p -
+         h * (dF_dt * Psv + F * dPsv_dt) / (p * p);
+}
+constexpr auto d2Xw_dhdp(const double F, const double Psv, const double p)
+    -> double {
+  return dF_dp() * Psv / p - F * Psv / (p * p);
+}
+constexpr auto d2Xw_dp2(const double h, const double F, const double Psv,
+                        const double p) -> double {
+  return 2.0 * h * Psv * (F - dF_dp() * p) / (p * p * p);
+}
+
+constexpr auto d2C_dt2(const double t, const double p, const double Xw,
+                       const double xc, const double dXw_dt,
+                       const double d2Xw_dt2) -> double {
+  return 2.0 * k02 + 2.0 * k05 * Xw + 2.0 * k08 * p + 2.0 * k11 * xc +
+         2.0 * (k04 + 2.0 * k05 * t) * dXw_dt + 2.0 * k12 * dXw_dt * dXw_dt +
+         dC_dXw(t, p, Xw, xc) * d2Xw_dt2;
+}
+constexpr auto d2C_dtdh(const double t, const double p, const double Xw,
+                        const double xc, const double dXw_dt,
+                        const double dXw_dh, const double d2Xw_dtdh)
+    -> double {
+  return (k04 + 2.0 * k05 * t) * dXw_dh + 2.0 * k12 * dXw_dt * dXw_dh +
+         dC_dXw(t, p, Xw, xc) * d2Xw_dtdh;
+}
+constexpr auto d2C_dtdp(const double t, const double p, const double Xw,
+                        const double xc, const double dXw_dt,
+                        const double dXw_dp, const double d2Xw_dtdp)
+    -> double {
+  return k07 + 2.0 * k08 * t + (k04 + 2.0 * k05 * t) * dXw_dp +
+         k15 * xc * dXw_dt + 2.0 * k12 * dXw_dt * dXw_dp +
+         dC_dXw(t, p, Xw, xc) * d2Xw_dtdp;
+}
+constexpr auto d2C_dtdxc(const double t, const double p, const double dXw_dt)
+    -> double {
+  return k10 + 2.0 * k11 * t + k15 * p * dXw_dt;
+}
+constexpr auto d2C_dh2(const double dXw_dh) -> double {
+  return 2.0 * k12 * dXw_dh * dXw_dh;
+}
+constexpr auto d2C_dhdp(const double t, const double p, const double Xw,
+                        const double xc, const double dXw_dh,
+                        const double dXw_dp, const double d2Xw_dhdp)
+    -> double {
+  return 2.0 * k12 * dXw_dh * dXw_dp + k15 * xc * dXw_dh +
+         dC_dXw(t, p, Xw, xc) * d2Xw_dhdp;
+}
+constexpr auto d2C_dhdxc(const double p, const double dXw_dh) -> double {
+  return k15 * p * dXw_dh;
+}
+constexpr auto d2C_dp2(const double t, const double p, const double Xw,
+                       const double xc, const double dXw_dp,
+                       const double d2Xw_dp2) -> double {
+  return 2.0 * k13 + 2.0 * k15 * xc * dXw_dp + 2.0 * k12 * dXw_dp * dXw_dp +
+         dC_dXw(t, p, Xw, xc) * d2Xw_dp2;
+}
+constexpr auto d2C_dpdxc(const double p, const double Xw, const double dXw_dp)
+    -> double {
+  return k15 * Xw + k15 * p * dXw_dp;
+}
+constexpr auto d2C_dxc2() -> double { return 2.0 * k14; }
+
+}  // namespace compile_time
+
+}  // namespace theory
+
+// Environment-level counterparts of SpeedOfSound::Compute. Intermediate values
+// are passed down as arguments since C++11 constexpr functions cannot declare
+// local variables.
+namespace compile_time {
+
+namespace internal {
+
+namespace model = theory::compile_time;
+
+constexpr auto ComputeRate(const double t, const double h, const double p,
+                           const double xc, const double F, const double Psv,
+                           const double Xw) -> EnvironmentRate {
+  return EnvironmentRate(
+      model::dC_dt(t, p, Xw, xc, model::dXw_dF(h, Psv, p), model::dF_dt(t),
+                   model::dXw_dPsv(h, F, p), model::dPsv_dt(model::T(t))),
+      model::dC_dh(model::dC_dXw(t, p, Xw, xc), model::dXw_dh(F, Psv, p)),
+      model::dC_dp(t, p, Xw, xc, model::dXw_dp(h, F, Psv, p)),
+      model::dC_dxc(t, p, Xw, xc));
+}
+
+constexpr auto CurvatureFromXw(const double t, const double p,
+                               const double xc, const double Xw,
+                               const double dXw_dt, const double dXw_dh,
+                               const double dXw_dp, const double d2Xw_dt2,
+                               const double d2Xw_dtdh, const double d2Xw_dtdp,
+                               const double d2Xw_dhdp, const double d2Xw_dp2)
+    -> EnvironmentCurvature {
+  return EnvironmentCurvature(
+      model::d2C_dt2(t, p, Xw, xc, dXw_dt, d2Xw_dt2),
+      model::d2C_dtdh(t, p, Xw, xc, dXw_dt, dXw_dh, d2Xw_dtdh),
+      model::d2C_dtdp(t, p, Xw, xc, dXw_dt, dXw_dp, d2Xw_dtdp),
+      model::d2C_dtdxc(t, p, dXw_dt), model::d2C_dh2(dXw_dh),
+      model::d2C_dhdp(t, p, Xw, xc, dXw_dh, dXw_dp, d2Xw_dhdp),
+      model::d2C_dhdxc(p, dXw_dh),
+      model::d2C_dp2(t, p, Xw, xc, dXw_dp, d2Xw_dp2),
+      model::d2C_dpdxc(p, Xw, dXw_dp), model::d2C_dxc2());
+}
+
+constexpr auto ComputeCurvature(const double t, const double h,
+                                const double p, const double xc,
+                                const double T, const double F,
+                                const double Psv, const double dF_dt,
+                                const double dPsv_dt) -> EnvironmentCurvature {
+  return CurvatureFromXw(
+      t, p, xc, model::Xw(h, F, Psv, p),
+      model::dXw_dF(h, Psv, p) * dF_dt + model::dXw_dPsv(h, F, p) * dPsv_dt,
+      model::dXw_dh(F, Psv, p), model::dXw_dp(h, F, Psv, p),
+      model::d2Xw_dt2(h, F, Psv, p, dF_dt, dPsv_dt, model::d2F_dt2(),
+                      model::d2Psv_dt2(T, Psv)),
+      model::d2Xw_dtdh(F, Psv, p, dF_dt, dPsv_dt),
+      model::d2Xw_dtdp(h, F, Psv, p, dF_dt, dPsv_dt),
+      model::d2Xw_dhdp(F, Psv, p), model::d2Xw_dp2(h, F, Psv, p));
+}
+
+}  // namespace internal
+
+constexpr auto Compute(const Environment& ambient_conitions) -> double {
+  return theory::compile_time::C(
+      ambient_conitions.temperature_, ambient_conitions.pressure_,
+      theory::compile_time::Xw(
+          ambient_conitions.humidity_,
+          theory::compile_time::F(ambient_conitions.pressure_,
+                                  ambient_conitions.temperature_),
+          theory::compile_time::Psv(
+              theory::compile_time::T(ambient_conitions.temperature_)),
+          ambient_conitions.pressure_),
+      ambient_conitions.co2_mole_fraction_);
+}
+
+constexpr auto ComputeRate(const Environment& ambient_conitions)
+    -> EnvironmentRate {
+  return internal::ComputeRate(
+      ambient_conitions.temperature_, ambient_conitions.humidity_,
+      ambient_conitions.pressure_, ambient_conitions.co2_mole_fraction_,
+      theory::compile_time::F(ambient_conitions.pressure_,
+                              ambient_conitions.temperature_),
+      theory::compile_time::Psv(
+          theory::compile_time::T(ambient_conitions.temperature_)),
+      theory::compile_time::Xw(
+          ambient_conitions.humidity_,
+          theory::compile_time::F(ambient_conitions.pressure_,
+                                  ambient_conitions.temperature_),
+          theory::compile_time::Psv(
+              theory::compile_time::T(ambient_conitions.temperature_)),
+          ambient_conitions.pressure_));
+}
+
+constexpr auto ComputeCurvature(const Environment& ambient_conitions)
+    -> EnvironmentCurvature {
+  return internal::ComputeCurvature(
+      ambient_conitions.temperature_, ambient_conitions.humidity_,
+      ambient_conitions.pressure_, ambient_conitions.co2_mole_fraction_,
+      theory::compile_time::T(ambient_conitions.temperature_),
+      theory::compile_time::F(ambient_conitions.pressure_,
+                              ambient_conitions.temperature_),
+      theory::compile_time::Psv(
+          theory::compile_time::T(ambient_conitions.temperature_)),
+      theory::compile_time::dF_dt(ambient_conitions.temperature_),
+      theory::compile_time::dPsv_dt(
+          theory::compile_time::T(ambient_conitions.temperature_)));
+}
+
+// Equivalent to SpeedOfSound(ambient_conitions, approximation_order), e.g.
+// constexpr auto kSpeedOfSound = compile_time::Linearize(Environment());
+constexpr auto Linearize(
+    const Environment& ambient_conitions,
+    const ApproximationOrder approximation_order = ApproximationOrder::kLinear)
+    -> SpeedOfSound {
+  return SpeedOfSound(ambient_conitions, Compute(ambient_conitions),
+                      ComputeRate(ambient_conitions),
+                      approximation_order == ApproximationOrder::kQuadratic
+                          ? ComputeCurvature(ambient_conitions)
+                          : EnvironmentCurvature(),
+                      approximation_order);
+}
+
+}  // namespace compile_time
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_CONSTEXPR_H_
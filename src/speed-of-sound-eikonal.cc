@@ -0,0 +1,308 @@
+#include "speed-of-sound-eikonal.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+#include "environment.h"
+#include "speed-of-sound-parallel.h"
+
+namespace speedofsound {
+
+namespace {
+
+// Cells per block edge: 32 x 32 cells in two dimensions and 8 x 8 x 8 in
+// three keep the travel times and slowness of a block within 16 KiB
+const size_t kBlockShift2d = 5;
+const size_t kBlockShift3d = 3;
+
+// Rows of cells per task when converting between layouts
+const size_t kRowGrain = 64;
+
+const double kInfinity = std::numeric_limits<double>::infinity();
+
+// Cells of [begin, end) in ascending or descending order
+class Range {
+ public:
+  Range(const size_t begin, const size_t end, const bool descending)
+      : first_(descending ? end - 1 : begin),
+        count_(end - begin),
+        step_(descending ? -1 : 1) {}
+  auto At(const size_t i) const -> size_t {
+    return static_cast<size_t>(static_cast<ptrdiff_t>(first_) +
+                               step_ * static_cast<ptrdiff_t>(i));
+  }
+  size_t first_;
+  size_t count_;
+  ptrdiff_t step_;
+};
+
+}  // namespace
+
+GridShape::GridShape() : x_size_(0), y_size_(0), z_size_(0), spacing_(0.0) {}
+
+GridShape::GridShape(const size_t x_size, const size_t y_size,
+                     const size_t z_size, const double spacing)
+    : x_size_(x_size), y_size_(y_size), z_size_(z_size), spacing_(spacing) {}
+
+auto GridShape::Cells() const -> size_t {
+  return x_size_ * y_size_ * z_size_;
+}
+
+auto GridShape::Validate() const -> bool {
+  return x_size_ > 0 && y_size_ > 0 && z_size_ > 0 && spacing_ > 0.0 &&
+         isfinite(spacing_);
+}
+
+EikonalSolver::EikonalSolver(ThreadPool* pool)
+    : pool_(pool),
+      block_size_(0),
+      block_shift_(0),
+      block_cells_(0),
+      block_counts_(),
+      cell_strides_(),
+      block_strides_(),
+      iteration_count_(0) {}
+
+auto EikonalSolver::SetEnvironment(const GridShape& shape,
+                                   const EnvironmentArrays& ambient_conditions)
+    -> bool {
+  slowness_.clear();
+  planes_.clear();
+  if (!shape.Validate()) return false;
+  shape_ = shape;
+  block_shift_ = shape.z_size_ == 1 ? kBlockShift2d : kBlockShift3d;
+  block_size_ = static_cast<size_t>(1) << block_shift_;
+  const size_t sizes[3] = {shape.x_size_, shape.y_size_, shape.z_size_};
+  for (auto i = 0; i < 3; ++i) {
+    block_counts_[i] = (sizes[i] + block_size_ - 1) >> block_shift_;
+  }
+  block_cells_ = block_size_ * block_size_;
+  if (shape.z_size_ > 1) block_cells_ *= block_size_;
+  cell_strides_[0] = 1;
+  cell_strides_[1] = block_size_;
+  cell_strides_[2] = block_size_ * block_size_;
+  block_strides_[0] = block_cells_;
+  block_strides_[1] = block_counts_[0] * block_cells_;
+  block_strides_[2] = block_counts_[1] * block_strides_[1];
+  // Each of the 2^3 sweep directions visits the diagonal planes in its own
+  // order, so the planes are listed per direction
+  const auto plane_count =
+      block_counts_[0] + block_counts_[1] + block_counts_[2] - 2;
+  planes_.assign(8, std::vector<std::vector<Block>>(plane_count));
+  for (unsigned direction = 0; direction < 8; ++direction) {
+    for (size_t z = 0; z < block_counts_[2]; ++z) {
+      for (size_t y = 0; y < block_counts_[1]; ++y) {
+        for (size_t x = 0; x < block_counts_[0]; ++x) {
+          const auto plane =
+              ((direction & 1) ? block_counts_[0] - 1 - x : x) +
+              ((direction & 2) ? block_counts_[1] - 1 - y : y) +
+              ((direction & 4) ? block_counts_[2] - 1 - z : z);
+          planes_[direction][plane].push_back(Block{x, y, z});
+        }
+      }
+    }
+  }
+  std::vector<double> speed_of_sound(shape.Cells());
+  ParallelQuickComputeBatch(pool_, ambient_conditions, shape.Cells(),
+                            speed_of_sound.data());
+  slowness_.assign(
+      block_counts_[0] * block_counts_[1] * block_counts_[2] * block_cells_,
+      kInfinity);
+  std::atomic<bool> valid(true);
+  const auto rows = shape.y_size_ * shape.z_size_;
+  pool_->ParallelFor(rows, kRowGrain, [&](size_t begin, size_t end) {
+    for (auto row = begin; row < end; ++row) {
+      const auto y = row % shape_.y_size_;
+      const auto z = row / shape_.y_size_;
+      for (size_t x = 0; x < shape_.x_size_; ++x) {
+        const auto i = row * shape_.x_size_ + x;
+        const Environment environment(
+            ambient_conditions.temperature_[i],
+            ambient_conditions.humidity_[i], ambient_conditions.pressure_[i],
+            ambient_conditions.co2_mole_fraction_[i]);
+        if (!environment.ValidateEnvironment()) valid = false;
+        slowness_[Index(x, y, z)] = shape_.spacing_ / speed_of_sound[i];
+      }
+    }
+  });
+  if (!valid) {
+    slowness_.clear();
+    planes_.clear();
+  }
+  return valid;
+}
+
+auto EikonalSolver::GetShape() const -> GridShape { return shape_; }
+
+auto EikonalSolver::Solve(const size_t source_x, const size_t source_y,
+                          const size_t source_z, double* travel_time)
+    -> bool {
+  iteration_count_ = 0;
+  if (slowness_.empty() || source_x >= shape_.x_size_ ||
+      source_y >= shape_.y_size_ || source_z >= shape_.z_size_) {
+    return false;
+  }
+  travel_time_.assign(slowness_.size(), kInfinity);
+  travel_time_[Index(source_x, source_y, source_z)] = 0.0;
+  const auto directions = shape_.z_size_ == 1 ? 4u : 8u;
+  changed_sweep_.assign(
+      block_counts_[0] * block_counts_[1] * block_counts_[2], 0);
+  size_t sweep = 0;
+  auto changed = true;
+  while (changed && iteration_count_ < kMaxEikonalIterations) {
+    std::atomic<bool> any_changed(false);
+    for (unsigned direction = 0; direction < directions; ++direction) {
+      ++sweep;
+      for (const auto& plane : planes_[direction]) {
+        pool_->ParallelFor(plane.size(), 1, [&](size_t begin, size_t end) {
+          for (auto i = begin; i < end; ++i) {
+            // A block is settled once every direction has been swept
+            // without a change to it or to the blocks next to it
+            if (LastChange(plane[i]) + directions < sweep) continue;
+            if (Sweep(plane[i], direction)) {
+              changed_sweep_[BlockIndex(plane[i])] = sweep;
+              any_changed = true;
+            }
+          }
+        });
+      }
+    }
+    changed = any_changed;
+    ++iteration_count_;
+  }
+  const auto rows = shape_.y_size_ * shape_.z_size_;
+  pool_->ParallelFor(rows, kRowGrain, [&](size_t begin, size_t end) {
+    for (auto row = begin; row < end; ++row) {
+      const auto y = row % shape_.y_size_;
+      const auto z = row / shape_.y_size_;
+      for (size_t x = 0; x < shape_.x_size_; ++x) {
+        travel_time[row * shape_.x_size_ + x] = travel_time_[Index(x, y, z)];
+      }
+    }
+  });
+  return !changed;
+}
+
+auto EikonalSolver::GetIterationCount() const -> size_t {
+  return iteration_count_;
+}
+
+auto EikonalSolver::Index(const size_t x, const size_t y, const size_t z) const
+    -> size_t {
+  const auto mask = block_size_ - 1;
+  const auto block =
+      ((z >> block_shift_) * block_counts_[1] + (y >> block_shift_)) *
+          block_counts_[0] +
+      (x >> block_shift_);
+  const auto cell =
+      ((((z & mask) << block_shift_) + (y & mask)) << block_shift_) +
+      (x & mask);
+  return block * block_cells_ + cell;
+}
+
+auto EikonalSolver::BlockIndex(const Block& block) const -> size_t {
+  return (block.z_ * block_counts_[1] + block.y_) * block_counts_[0] +
+         block.x_;
+}
+
+// Blocks of the same plane do not share a face, so the sweeps running
+// alongside this one never write the entries read here
+auto EikonalSolver::LastChange(const Block& block) const -> size_t {
+  const size_t position[3] = {block.x_, block.y_, block.z_};
+  const auto index = BlockIndex(block);
+  const size_t strides[3] = {1, block_counts_[0],
+                             block_counts_[0] * block_counts_[1]};
+  auto last = changed_sweep_[index];
+  for (auto axis = 0; axis < 3; ++axis) {
+    if (position[axis] > 0) {
+      last = std::max(last, changed_sweep_[index - strides[axis]]);
+    }
+    if (position[axis] + 1 < block_counts_[axis]) {
+      last = std::max(last, changed_sweep_[index + strides[axis]]);
+    }
+  }
+  return last;
+}
+
+auto EikonalSolver::Sweep(const Block& block, const unsigned direction)
+    -> bool {
+  const auto x_begin = block.x_ << block_shift_;
+  const auto y_begin = block.y_ << block_shift_;
+  const auto z_begin = block.z_ << block_shift_;
+  const Range xs(x_begin, std::min(x_begin + block_size_, shape_.x_size_),
+                 (direction & 1) != 0);
+  const Range ys(y_begin, std::min(y_begin + block_size_, shape_.y_size_),
+                 (direction & 2) != 0);
+  const Range zs(z_begin, std::min(z_begin + block_size_, shape_.z_size_),
+                 (direction & 4) != 0);
+  auto changed = false;
+  for (size_t k = 0; k < zs.count_; ++k) {
+    const auto z = zs.At(k);
+    for (size_t j = 0; j < ys.count_; ++j) {
+      const auto y = ys.At(j);
+      // Cells of a row within a block are contiguous
+      const auto row = Index(x_begin, y, z);
+      for (size_t i = 0; i < xs.count_; ++i) {
+        const auto x = xs.At(i);
+        changed = Update(row + (x - x_begin), x, y, z) || changed;
+      }
+    }
+  }
+  return changed;
+}
+
+auto EikonalSolver::Neighbour(const size_t index, const size_t position,
+                              const size_t axis) const -> double {
+  const size_t sizes[3] = {shape_.x_size_, shape_.y_size_, shape_.z_size_};
+  const auto mask = block_size_ - 1;
+  const auto local = position & mask;
+  auto earlier = kInfinity;
+  if (position > 0) {
+    earlier = travel_time_[local > 0 ? index - cell_strides_[axis]
+                                     : index - block_strides_[axis] +
+                                           mask * cell_strides_[axis]];
+  }
+  if (position + 1 < sizes[axis]) {
+    earlier = std::min(
+        earlier, travel_time_[local < mask ? index + cell_strides_[axis]
+                                           : index + block_strides_[axis] -
+                                                 mask * cell_strides_[axis]]);
+  }
+  return earlier;
+}
+
+// Godunov upwind update: the smallest T consistent with the earlier arrivals
+// among the neighbours along each axis
+auto EikonalSolver::Update(const size_t index, const size_t x, const size_t y,
+                           const size_t z) -> bool {
+  // Sorted without branches, as the order changes from cell to cell
+  const auto x_time = Neighbour(index, x, 0);
+  const auto y_time = Neighbour(index, y, 1);
+  const auto z_time = Neighbour(index, z, 2);
+  const auto low = std::min(x_time, y_time);
+  const auto high = std::max(x_time, y_time);
+  const double a[3] = {std::min(low, z_time),
+                       std::min(high, std::max(low, z_time)),
+                       std::max(high, std::max(low, z_time))};
+  // Every candidate is later than the earliest neighbour
+  if (!(a[0] < travel_time_[index])) return false;
+  const auto f = slowness_[index];
+  auto t = a[0] + f;
+  if (t > a[1]) {
+    const auto d = a[0] - a[1];
+    t = 0.5 * (a[0] + a[1] + sqrt(fmax(0.0, 2.0 * f * f - d * d)));
+    if (t > a[2]) {
+      const auto sum = a[0] + a[1] + a[2];
+      const auto squares = a[0] * a[0] + a[1] * a[1] + a[2] * a[2];
+      t = (sum + sqrt(fmax(0.0, sum * sum - 3.0 * (squares - f * f)))) / 3.0;
+    }
+  }
+  if (!(t < travel_time_[index])) return false;
+  travel_time_[index] = t;
+  return true;
+}
+
+}  // namespace speedofsound
@@ -0,0 +1,96 @@
+#ifndef SPEED_OF_SOUND_EIKONAL_H_
+#define SPEED_OF_SOUND_EIKONAL_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "speed-of-sound-batch.h"
+#include "thread-pool.h"
+
+namespace speedofsound {
+
+// Regular grid of cells, spacing (m) apart. Two-dimensional grids have a
+// z size of one. Cell arrays are stored with x varying fastest, then y.
+class GridShape {
+ public:
+  GridShape();
+  GridShape(const size_t x_size, const size_t y_size, const size_t z_size,
+            const double spacing);
+  auto Cells() const -> size_t;
+  auto Validate() const -> bool;
+  size_t x_size_;
+  size_t y_size_;
+  size_t z_size_;
+  double spacing_;
+};
+
+// Full sets of sweeps after which Solve gives up
+const size_t kMaxEikonalIterations = 64;
+
+// First-arrival travel times over a grid where every cell has its own
+// environment, from the eikonal equation |grad T| = 1 / c. The first-order
+// upwind scheme is solved by fast sweeping. Cells are stored in cubic blocks
+// so that a sweep stays within the cache. Blocks on the same diagonal plane
+// do not share a face, so each plane of blocks is swept in parallel. Blocks
+// whose neighbourhood has settled are skipped.
+class EikonalSolver {
+ public:
+  explicit EikonalSolver(ThreadPool* pool);
+  // Speed of sound of every cell with ParallelQuickComputeBatch. False if
+  // the shape or an environment is invalid.
+  auto SetEnvironment(const GridShape& shape,
+                      const EnvironmentArrays& ambient_conditions) -> bool;
+  auto GetShape() const -> GridShape;
+  // Travel time (s) from the source cell to every cell. False without an
+  // environment, for a source outside the grid, or if the sweeps do not
+  // settle within kMaxEikonalIterations.
+  auto Solve(const size_t source_x, const size_t source_y,
+             const size_t source_z, double* travel_time) -> bool;
+  // Full sets of sweeps taken by the last Solve, including the one that
+  // found nothing left to change
+  auto GetIterationCount() const -> size_t;
+
+ private:
+  class Block {
+   public:
+    size_t x_;
+    size_t y_;
+    size_t z_;
+  };
+
+  auto Index(const size_t x, const size_t y, const size_t z) const -> size_t;
+  auto BlockIndex(const Block& block) const -> size_t;
+  // Latest sweep that changed the block or a block sharing a face with it
+  auto LastChange(const Block& block) const -> size_t;
+  auto Sweep(const Block& block, const unsigned direction) -> bool;
+  // Earlier of the two neighbours of the cell at index along axis
+  auto Neighbour(const size_t index, const size_t position,
+                 const size_t axis) const -> double;
+  auto Update(const size_t index, const size_t x, const size_t y,
+              const size_t z) -> bool;
+
+  ThreadPool* pool_;
+  GridShape shape_;
+  size_t block_size_;
+  size_t block_shift_;
+  size_t block_cells_;
+  size_t block_counts_[3];
+  // Distance in the blocked arrays between neighbouring cells of a block,
+  // and between neighbouring blocks, along each axis
+  size_t cell_strides_[3];
+  size_t block_strides_[3];
+  // Blocks of each sweep direction by their diagonal plane, x + y + z in
+  // block coordinates mirrored along the descending axes
+  std::vector<std::vector<std::vector<Block>>> planes_;
+  // Spacing over speed of sound, in blocked order
+  std::vector<double> slowness_;
+  std::vector<double> travel_time_;
+  // Last sweep that changed each block, by BlockIndex
+  std::vector<size_t> changed_sweep_;
+  size_t iteration_count_;
+};
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_EIKONAL_H_
@@ -0,0 +1,232 @@
+#include "speed-of-sound-fixed.h"
+
+#include <math.h>
+
+namespace speedofsound {
+
+namespace {
+
+// Valid range in fixed point, with the maxima rounded down
+const int32_t kMinFixedTemperature = 0;
+const int32_t kMaxFixedTemperature = 1966080;
+const int32_t kMinFixedHumidity = 0;
+const int32_t kMaxFixedHumidity = 65536;
+const int32_t kMinFixedPressure = 75000;
+const int32_t kMaxFixedPressure = 102000;
+const int32_t kMinFixedCO2MoleFraction = 0;
+const int32_t kMaxFixedCO2MoleFraction = 42949672;
+
+// Psv (Pa, 18 fraction bits) as a polynomial in w = t - 15 (t in degrees
+// Celsius with 16 fraction bits), interpolated at the Chebyshev nodes. Within
+// 1.1e-7 of Psv relative over the valid range. Coefficient n is scaled by
+// 2^(20 n), so that Horner's rule shifts by 20 at each step.
+const int32_t kPsv0 = 447046922;
+const int32_t kPsv1 = 460603359;
+const int32_t kPsv2 = 208359805;
+const int32_t kPsv3 = 53379513;
+const int32_t kPsv4 = 8218821;
+const int32_t kPsv5 = 709360;
+const int32_t kPsv6 = 20643;
+const int32_t kPsvCenter = 983040;
+
+// F = k16 + k17 p + k18 t^2, with 30 fraction bits; k17 and k18 have 60 and
+// 44 fraction bits
+const int32_t kF16 = 1074407544;
+const int64_t kF17 = 36201735245;
+const int32_t kF18 = 9851624;
+
+// The factors of 1, Xw, p and xc in C as quadratics in t, in Horner form
+// with the fraction bits given
+class Quadratic {
+ public:
+  int64_t a0_;
+  int64_t a1_;
+  int32_t a2_;
+};
+const Quadratic kC0 = {1423791966546, 2590101503, -2267743};    // 32 bits
+const Quadratic kCXw = {863555771, 2509660, -13120};            // 24 bits
+const Quadratic kCp = {-13114482115, 2687748258, -21112875};    // 56 bits
+const Quadratic kCxc = {-22873199985, -61344213, 15865};        // 28 bits
+
+// k12, k14 and k15 with 32 fraction bits, k13 with 62
+const int64_t kC12 = -12176872234;
+const int32_t kC13 = -991512;
+const int64_t kC14 = 125326123495;
+const int32_t kC15 = 2087354;
+
+// x / 2^bits rounded to nearest, ties up. Right shifts of negative values are
+// arithmetic on the compilers the library targets (GCC and Clang, including
+// avr-gcc).
+inline auto Shift(const int64_t x, const int bits) -> int64_t {
+  return (x + (static_cast<int64_t>(1) << (bits - 1))) >> bits;
+}
+
+// Quadratic in t, with 16 fraction bits
+inline auto Evaluate(const Quadratic& q, const int32_t t) -> int64_t {
+  const auto inner = q.a1_ + Shift(static_cast<int64_t>(q.a2_) * t, 16);
+  return q.a0_ + Shift(inner * t, 16);
+}
+
+inline auto FixedPsv(const int32_t t) -> int32_t {
+  const int64_t w = t - kPsvCenter;
+  int64_t psv = kPsv6;
+  psv = kPsv5 + Shift(psv * w, 20);
+  psv = kPsv4 + Shift(psv * w, 20);
+  psv = kPsv3 + Shift(psv * w, 20);
+  psv = kPsv2 + Shift(psv * w, 20);
+  psv = kPsv1 + Shift(psv * w, 20);
+  return static_cast<int32_t>(kPsv0 + Shift(psv * w, 20));
+}
+
+// Round half away from zero, for the conversions from floating point
+auto Round(const double x) -> int64_t {
+  return static_cast<int64_t>(x < 0.0 ? x - 0.5 : x + 0.5);
+}
+
+auto ToFixed(const double x, const int bits) -> int64_t {
+  return Round(ldexp(x, bits));
+}
+
+}  // namespace
+
+auto FixedEnvironment::ValidateEnvironment() const -> bool {
+  return temperature_ >= kMinFixedTemperature &&
+         temperature_ <= kMaxFixedTemperature &&
+         humidity_ >= kMinFixedHumidity && humidity_ <= kMaxFixedHumidity &&
+         pressure_ >= kMinFixedPressure && pressure_ <= kMaxFixedPressure &&
+         co2_mole_fraction_ >= kMinFixedCO2MoleFraction &&
+         co2_mole_fraction_ <= kMaxFixedCO2MoleFraction;
+}
+
+auto ToFixedEnvironment(const Environment& ambient_conitions)
+    -> FixedEnvironment {
+  return FixedEnvironment(
+      static_cast<int32_t>(
+          ToFixed(ambient_conitions.temperature_, kFixedTemperatureBits)),
+      static_cast<int32_t>(
+          ToFixed(ambient_conitions.humidity_, kFixedHumidityBits)),
+      static_cast<int32_t>(Round(ambient_conitions.pressure_)),
+      static_cast<int32_t>(ToFixed(ambient_conitions.co2_mole_fraction_,
+                                   kFixedCO2MoleFractionBits)));
+}
+
+auto ToEnvironment(const FixedEnvironment& ambient_conitions) -> Environment {
+  return Environment(
+      ldexp(ambient_conitions.temperature_, -kFixedTemperatureBits),
+      ldexp(ambient_conitions.humidity_, -kFixedHumidityBits),
+      ambient_conitions.pressure_,
+      ldexp(ambient_conitions.co2_mole_fraction_,
+            -kFixedCO2MoleFractionBits));
+}
+
+auto FixedToSpeedOfSound(const int32_t speed_of_sound) -> double {
+  return ldexp(speed_of_sound, -kFixedSpeedOfSoundBits);
+}
+
+// Intermediates and their fraction bits: Psv 18, F 30, Xw 32 and C 32. The
+// comments give the largest magnitudes over the valid range. Psv reaches
+// 1.12e9 at 30 degrees Celsius and F is just over 2^30, so F Psv fits in 62
+// bits and F_psv and the numerator in 31.
+auto FixedQuickCompute(const FixedEnvironment& ambient_conitions)
+    -> int32_t {
+  const auto t = ambient_conitions.temperature_;
+  const int64_t p = ambient_conitions.pressure_;
+  const int64_t xc = ambient_conitions.co2_mole_fraction_;
+  const auto psv = FixedPsv(t);                            // < 2^31
+  const auto t2 = Shift(static_cast<int64_t>(t) * t, 16);  // < 2^26
+  const auto F = kF16 + Shift(kF17 * p + kF18 * t2, 30);   // < 2^31
+  const auto F_psv = Shift(F * psv, 30);                   // < 2^31
+  // h F Psv / p, with the remainder of a first 32-bit division carried into
+  // a second one for 14 more fraction bits
+  const auto numerator = static_cast<uint32_t>(
+      Shift(F_psv * ambient_conitions.humidity_, 16));     // < 2^31
+  const auto divisor = static_cast<uint32_t>(p);
+  const auto quotient = numerator / divisor;               // < 2^14
+  const auto remainder = numerator % divisor;              // < 2^17
+  const int64_t Xw = (static_cast<int64_t>(quotient) << 14) +
+                     (remainder << 14) / divisor;          // < 2^28
+  auto C = Evaluate(kC0, t);                               // < 2^41
+  C += Shift(Evaluate(kCXw, t) * Xw, 24);
+  C += Shift(Evaluate(kCp, t) * p, 24);
+  C += Shift(Evaluate(kCxc, t) * xc, 28);
+  C += Shift(kC12 * Shift(Xw * Xw, 32), 32);
+  C += Shift(kC13 * (p * p), 30);
+  C += Shift(kC14 * Shift(xc * xc, 32), 32);
+  C += Shift(kC15 * (Shift(Xw * xc, 32) * p), 32);
+  return static_cast<int32_t>(Shift(C, 32 - kFixedSpeedOfSoundBits));
+}
+
+FixedSpeedOfSound::FixedSpeedOfSound()
+    : FixedSpeedOfSound(SpeedOfSound()) {}
+
+// The rounded linearization point moves the constant term, so that the
+// linear function itself only changes by the rounding of the rates
+FixedSpeedOfSound::FixedSpeedOfSound(const SpeedOfSound& speed_of_sound)
+    : init_environment_(
+          ToFixedEnvironment(speed_of_sound.GetInitEnvironment())) {
+  const auto rate = speed_of_sound.GetInitEnvironmentRate();
+  const auto offset = speed_of_sound.GetInitEnvironment();
+  const auto rounded = ToEnvironment(init_environment_);
+  auto init_speed_of_sound = speed_of_sound.GetInitSpeedOfSound();
+  init_speed_of_sound +=
+      (rounded.temperature_ - offset.temperature_) * rate.temperature_rate_;
+  init_speed_of_sound +=
+      (rounded.humidity_ - offset.humidity_) * rate.humidity_rate_;
+  init_speed_of_sound +=
+      (rounded.pressure_ - offset.pressure_) * rate.pressure_rate_;
+  init_speed_of_sound += (rounded.co2_mole_fraction_ -
+                          offset.co2_mole_fraction_) *
+                         rate.co2_mole_fraction_rate_;
+  init_speed_of_sound_ = ToFixed(init_speed_of_sound, 32);
+  init_environment_rate_ = FixedEnvironmentRate(
+      static_cast<int32_t>(
+          ToFixed(rate.temperature_rate_, kFixedTemperatureRateBits)),
+      static_cast<int32_t>(
+          ToFixed(rate.humidity_rate_, kFixedHumidityRateBits)),
+      static_cast<int32_t>(
+          ToFixed(rate.pressure_rate_, kFixedPressureRateBits)),
+      static_cast<int32_t>(ToFixed(rate.co2_mole_fraction_rate_,
+                                   kFixedCO2MoleFractionRateBits)));
+}
+
+auto FixedSpeedOfSound::GetInitSpeedOfSound() const -> int64_t {
+  return init_speed_of_sound_;
+}
+
+auto FixedSpeedOfSound::GetInitEnvironment() const -> FixedEnvironment {
+  return init_environment_;
+}
+
+auto FixedSpeedOfSound::GetInitEnvironmentRate() const
+    -> FixedEnvironmentRate {
+  return init_environment_rate_;
+}
+
+// Each term is brought to 32 fraction bits before the sum is rounded
+auto FixedSpeedOfSound::Approximate(const FixedEnvironment& ambient_conitions)
+    const -> int32_t {
+  const auto& x0 = init_environment_;
+  const auto& rate = init_environment_rate_;
+  auto approx_speed_of_sound = init_speed_of_sound_;
+  approx_speed_of_sound += Shift(
+      static_cast<int64_t>(ambient_conitions.temperature_ - x0.temperature_) *
+          rate.temperature_rate_,
+      kFixedTemperatureBits + kFixedTemperatureRateBits - 32);
+  approx_speed_of_sound += Shift(
+      static_cast<int64_t>(ambient_conitions.humidity_ - x0.humidity_) *
+          rate.humidity_rate_,
+      kFixedHumidityBits + kFixedHumidityRateBits - 32);
+  approx_speed_of_sound += Shift(
+      static_cast<int64_t>(ambient_conitions.pressure_ - x0.pressure_) *
+          rate.pressure_rate_,
+      kFixedPressureRateBits - 32);
+  approx_speed_of_sound +=
+      Shift(static_cast<int64_t>(ambient_conitions.co2_mole_fraction_ -
+                                 x0.co2_mole_fraction_) *
+                rate.co2_mole_fraction_rate_,
+            kFixedCO2MoleFractionBits + kFixedCO2MoleFractionRateBits - 32);
+  return static_cast<int32_t>(
+      Shift(approx_speed_of_sound, 32 - kFixedSpeedOfSoundBits));
+}
+
+}  // namespace speedofsound
@@ -0,0 +1,119 @@
+#ifndef SPEED_OF_SOUND_FIXED_H_
+#define SPEED_OF_SOUND_FIXED_H_
+
+#include <stdint.h>
+
+#include "environment.h"
+#include "speed-of-sound.h"
+
+namespace speedofsound {
+
+// Fraction bits of the fixed-point (Q-format) quantities. Pressure is in
+// whole pascals.
+constexpr int kFixedTemperatureBits = 16;          // degrees Celsius
+constexpr int kFixedHumidityBits = 16;             // fraction
+constexpr int kFixedCO2MoleFractionBits = 32;      // mole fraction
+constexpr int kFixedSpeedOfSoundBits = 16;         // m/s
+constexpr int kFixedTemperatureRateBits = 30;      // m/s per degree Celsius
+constexpr int kFixedHumidityRateBits = 28;         // m/s
+constexpr int kFixedPressureRateBits = 44;         // m/s per pascal
+constexpr int kFixedCO2MoleFractionRateBits = 24;  // m/s
+
+// FixedQuickCompute is within kFixedMaxError (m/s) of QuickCompute at the
+// same environment over the valid range. This is one unit of the result:
+// half of it is the final rounding and the rest the fixed-point arithmetic,
+// mostly the polynomial standing in for Psv.
+constexpr double kFixedMaxError = 1.0 / 65536.0;
+
+class FixedEnvironment {
+ public:
+  // The standard environment, rounded
+  constexpr FixedEnvironment()
+      : temperature_(1310720), humidity_(32768), pressure_(101325),
+        co2_mole_fraction_(1348620) {}
+  constexpr FixedEnvironment(const int32_t temperature, const int32_t humidity,
+                             const int32_t pressure,
+                             const int32_t co2_mole_fraction)
+      : temperature_(temperature),
+        humidity_(humidity),
+        pressure_(pressure),
+        co2_mole_fraction_(co2_mole_fraction) {}
+  // The fixed-point engine is only defined over the valid range, which
+  // also keeps its intermediates from overflowing
+  auto ValidateEnvironment() const -> bool;
+  int32_t temperature_;
+  int32_t humidity_;
+  int32_t pressure_;
+  int32_t co2_mole_fraction_;
+};
+
+// Nearest fixed-point environment. Uses floating point, so it is meant for
+// setting up rather than for the hot path.
+auto ToFixedEnvironment(const Environment& ambient_conitions)
+    -> FixedEnvironment;
+// Exact
+auto ToEnvironment(const FixedEnvironment& ambient_conitions) -> Environment;
+auto FixedToSpeedOfSound(const int32_t speed_of_sound) -> double;
+
+// QuickCompute in integer arithmetic only, in kFixedSpeedOfSoundBits
+// fraction bits, for valid environments. Psv is a degree 6 polynomial in
+// temperature, and Xw is two 32-bit divisions; the rest are multiplies in
+// 64-bit integers, several of them with both operands wider than 32 bits.
+// Results are the same on every target.
+auto FixedQuickCompute(const FixedEnvironment& ambient_conitions) -> int32_t;
+
+// Partial derivatives in kFixed*RateBits fraction bits
+class FixedEnvironmentRate {
+ public:
+  constexpr FixedEnvironmentRate()
+      : temperature_rate_(0),
+        humidity_rate_(0),
+        pressure_rate_(0),
+        co2_mole_fraction_rate_(0) {}
+  constexpr FixedEnvironmentRate(const int32_t temperature_rate,
+                                 const int32_t humidity_rate,
+                                 const int32_t pressure_rate,
+                                 const int32_t co2_mole_fraction_rate)
+      : temperature_rate_(temperature_rate),
+        humidity_rate_(humidity_rate),
+        pressure_rate_(pressure_rate),
+        co2_mole_fraction_rate_(co2_mole_fraction_rate) {}
+  int32_t temperature_rate_;
+  int32_t humidity_rate_;
+  int32_t pressure_rate_;
+  int32_t co2_mole_fraction_rate_;
+};
+
+// SpeedOfSound::Approximate in integer arithmetic, for linearization points
+// computed once at start-up or on a host. Approximate is within
+// kFixedMaxError of the double linearization it was converted from, for
+// valid environments.
+class FixedSpeedOfSound {
+ public:
+  // Linearized at the standard environment
+  FixedSpeedOfSound();
+  // Converts the linear terms of speed_of_sound; uses floating point
+  explicit FixedSpeedOfSound(const SpeedOfSound& speed_of_sound);
+  // init_speed_of_sound has 32 fraction bits, so that rounding it does not
+  // add to the error of the result
+  constexpr FixedSpeedOfSound(const FixedEnvironment& init_environment,
+                              const int64_t init_speed_of_sound,
+                              const FixedEnvironmentRate& init_environment_rate)
+      : init_speed_of_sound_(init_speed_of_sound),
+        init_environment_(init_environment),
+        init_environment_rate_(init_environment_rate) {}
+  auto GetInitSpeedOfSound() const -> int64_t;
+  auto GetInitEnvironment() const -> FixedEnvironment;
+  auto GetInitEnvironmentRate() const -> FixedEnvironmentRate;
+  auto Approximate(const FixedEnvironment& ambient_conitions) const
+      -> int32_t;
+
+ private:
+  int64_t init_speed_of_sound_;
+  FixedEnvironment init_environment_;
+  FixedEnvironmentRate init_environment_rate_;
+};
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_FIXED_H_
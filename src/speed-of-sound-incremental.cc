@@ -0,0 +1,145 @@
+#include "speed-of-sound-incremental.h"
+
+#include "speed-of-sound-inl.h"
+#include "speed-of-sound-theory-inl.h"
+
+namespace speedofsound {
+
+namespace {
+
+const uint8_t kAllInputs = 15;
+
+}  // namespace
+
+IncrementalSpeedOfSound::IncrementalSpeedOfSound()
+    : IncrementalSpeedOfSound(Environment()) {}
+
+IncrementalSpeedOfSound::IncrementalSpeedOfSound(
+    const Environment& ambient_conitions)
+    : environment_(ambient_conitions),
+      stale_value_(kAllInputs),
+      stale_rate_(kAllInputs),
+      T_(0.0),
+      Psv_(0.0),
+      F_(0.0),
+      Xw_(0.0),
+      C_(0.0),
+      dPsv_dt_(0.0),
+      dF_dt_(0.0),
+      dXw_dF_(0.0),
+      dXw_dPsv_(0.0),
+      dXw_dp_(0.0),
+      dXw_dh_(0.0),
+      psv_evaluation_count_(0) {}
+
+auto IncrementalSpeedOfSound::GetEnvironment() const -> Environment {
+  return environment_;
+}
+
+auto IncrementalSpeedOfSound::SetEnvironment(
+    const Environment& ambient_conitions) -> void {
+  SetTemperature(ambient_conitions.temperature_);
+  SetHumidity(ambient_conitions.humidity_);
+  SetPressure(ambient_conitions.pressure_);
+  SetCO2MoleFraction(ambient_conitions.co2_mole_fraction_);
+}
+
+auto IncrementalSpeedOfSound::SetTemperature(const double temperature)
+    -> void {
+  Set(kTemperature, temperature, &environment_.temperature_);
+}
+
+auto IncrementalSpeedOfSound::SetHumidity(const double humidity) -> void {
+  Set(kHumidity, humidity, &environment_.humidity_);
+}
+
+auto IncrementalSpeedOfSound::SetPressure(const double pressure) -> void {
+  Set(kPressure, pressure, &environment_.pressure_);
+}
+
+auto IncrementalSpeedOfSound::SetCO2MoleFraction(
+    const double co2_mole_fraction) -> void {
+  Set(kCO2MoleFraction, co2_mole_fraction, &environment_.co2_mole_fraction_);
+}
+
+auto IncrementalSpeedOfSound::GetSpeedOfSound() -> double {
+  if (stale_value_ == 0) return C_;
+  const auto t = environment_.temperature_;
+  const auto h = environment_.humidity_;
+  const auto p = environment_.pressure_;
+  const auto xc = environment_.co2_mole_fraction_;
+  if (stale_value_ & kTemperature) {
+    T_ = theory::T(t);
+    Psv_ = theory::FastPsv(T_);
+    ++psv_evaluation_count_;
+  }
+  if (stale_value_ & (kTemperature | kPressure)) {
+    F_ = theory::F(p, t);
+  }
+  if (stale_value_ & (kTemperature | kHumidity | kPressure)) {
+    Xw_ = theory::Xw(h, F_, Psv_, p);
+  }
+  C_ = theory::C(t, p, Xw_, xc);
+  stale_value_ = 0;
+  return C_;
+}
+
+auto IncrementalSpeedOfSound::GetEnvironmentRate() -> EnvironmentRate {
+  UpdateRate();
+  return rate_;
+}
+
+auto IncrementalSpeedOfSound::Approximate(
+    const Environment& ambient_conitions) -> double {
+  UpdateRate();
+  return internal::LinearApproximation(environment_, C_, rate_,
+                                       ambient_conitions);
+}
+
+auto IncrementalSpeedOfSound::GetLinearization() -> SpeedOfSound {
+  UpdateRate();
+  return SpeedOfSound(environment_, C_, rate_, EnvironmentCurvature(),
+                      ApproximationOrder::kLinear);
+}
+
+auto IncrementalSpeedOfSound::GetPsvEvaluationCount() const
+    -> unsigned long {
+  return psv_evaluation_count_;
+}
+
+// Equal values leave the dependents current
+auto IncrementalSpeedOfSound::Set(const Input input, const double value,
+                                  double* field) -> void {
+  if (value == *field) return;
+  *field = value;
+  stale_value_ |= input;
+  stale_rate_ |= input;
+}
+
+auto IncrementalSpeedOfSound::UpdateRate() -> void {
+  GetSpeedOfSound();
+  if (stale_rate_ == 0) return;
+  const auto t = environment_.temperature_;
+  const auto h = environment_.humidity_;
+  const auto p = environment_.pressure_;
+  const auto xc = environment_.co2_mole_fraction_;
+  if (stale_rate_ & kTemperature) {
+    dPsv_dt_ = theory::dPsv_dt(T_, Psv_);
+    dF_dt_ = theory::dF_dt(t);
+  }
+  if (stale_rate_ & (kTemperature | kHumidity | kPressure)) {
+    dXw_dF_ = theory::dXw_dF(h, Psv_, p);
+    dXw_dPsv_ = theory::dXw_dPsv(h, F_, p);
+    dXw_dp_ = theory::dXw_dp(h, F_, Psv_, p);
+    dXw_dh_ = theory::dXw_dh(F_, Psv_, p);
+  }
+  const auto dC_dXw = theory::dC_dXw(t, p, Xw_, xc);
+  rate_.temperature_rate_ =
+      theory::dC_dt(t, p, Xw_, xc, dXw_dF_, dF_dt_, dXw_dPsv_, dPsv_dt_);
+  rate_.humidity_rate_ = theory::dC_dh(dC_dXw, dXw_dh_);
+  rate_.pressure_rate_ = theory::dC_dp(t, p, Xw_, xc, dXw_dp_);
+  rate_.co2_mole_fraction_rate_ = theory::dC_dxc(t, p, Xw_, xc);
+  stale_rate_ = 0;
+}
+
+}  // namespace speedofsound
@@ -0,0 +1,75 @@
+#ifndef SPEED_OF_SOUND_INCREMENTAL_H_
+#define SPEED_OF_SOUND_INCREMENTAL_H_
+
+#include <stdint.h>
+
+#include "environment.h"
+#include "speed-of-sound.h"
+
+namespace speedofsound {
+
+// Compute for inputs that change one at a time. The intermediates of the
+// model are kept with the inputs they depend on, and setting an input marks
+// only those as stale:
+//   t:          T, Psv, dPsv_dt, dF_dt
+//   t, p:       F
+//   t, h, p:    Xw and its partial derivatives
+//   all inputs: C, dC_dXw and the rate
+// GetSpeedOfSound evaluates the stale part of the value, and the derivatives
+// wait until the rate is needed by GetEnvironmentRate or Approximate. Results
+// are identical to SpeedOfSound::Compute and ComputeRate.
+class IncrementalSpeedOfSound {
+ public:
+  IncrementalSpeedOfSound();
+  explicit IncrementalSpeedOfSound(const Environment& ambient_conitions);
+  auto GetEnvironment() const -> Environment;
+  // Marks only the inputs that differ from the current ones
+  auto SetEnvironment(const Environment& ambient_conitions) -> void;
+  auto SetTemperature(const double temperature) -> void;
+  auto SetHumidity(const double humidity) -> void;
+  auto SetPressure(const double pressure) -> void;
+  auto SetCO2MoleFraction(const double co2_mole_fraction) -> void;
+  // At the current environment
+  auto GetSpeedOfSound() -> double;
+  auto GetEnvironmentRate() -> EnvironmentRate;
+  // Linear approximation around the current environment
+  auto Approximate(const Environment& ambient_conitions) -> double;
+  // The current environment as the linearization point of a SpeedOfSound
+  auto GetLinearization() -> SpeedOfSound;
+  // Evaluations of Psv, for checking which updates skip it
+  auto GetPsvEvaluationCount() const -> unsigned long;
+
+ private:
+  // Bits of the stale masks
+  enum Input : uint8_t {
+    kTemperature = 1,
+    kHumidity = 2,
+    kPressure = 4,
+    kCO2MoleFraction = 8
+  };
+
+  auto Set(const Input input, const double value, double* field) -> void;
+  auto UpdateRate() -> void;
+
+  Environment environment_;
+  // Inputs changed since the value and since the rate were last updated
+  uint8_t stale_value_;
+  uint8_t stale_rate_;
+  double T_;
+  double Psv_;
+  double F_;
+  double Xw_;
+  double C_;
+  double dPsv_dt_;
+  double dF_dt_;
+  double dXw_dF_;
+  double dXw_dPsv_;
+  double dXw_dp_;
+  double dXw_dh_;
+  EnvironmentRate rate_;
+  unsigned long psv_evaluation_count_;
+};
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_INCREMENTAL_H_
@@ -0,0 +1,282 @@
+#ifndef SPEED_OF_SOUND_INL_H_
+#define SPEED_OF_SOUND_INL_H_
+
+#include "speed-of-sound.h"
+
+#include <math.h>
+
+#include "environment.h"
+#include "speed-of-sound-instrumentation.h"
+#include "speed-of-sound-theory-inl.h"
+
+namespace speedofsound {
+
+namespace internal {
+
+// Shared by ComputeRate and its batch form, which evaluates Psv and dPsv_dt
+// for many environments at once
+template <typename Scalar>
+auto ComputeRate(const BasicEnvironment<Scalar>& ambient_conitions,
+                 const Scalar Psv, const Scalar dPsv_dt,
+                 BasicEnvironmentRate<Scalar>* rate) -> Scalar {
+  const auto t = ambient_conitions.temperature_;
+  const auto h = ambient_conitions.humidity_;
+  const auto p = ambient_conitions.pressure_;
+  const auto xc = ambient_conitions.co2_mole_fraction_;
+  const auto F = theory::F(p, t);
+  const auto Xw = theory::Xw(h, F, Psv, p);
+  const auto C = theory::C(t, p, Xw, xc);
+  const auto dF_dt = theory::dF_dt(t);
+  const auto dXw_dF = theory::dXw_dF(h, Psv, p);
+  const auto dXw_dPsv = theory::dXw_dPsv(h, F, p);
+  const auto dXw_dp = theory::dXw_dp(h, F, Psv, p);
+  const auto dXw_dh = theory::dXw_dh(F, Psv, p);
+  const auto dC_dXw = theory::dC_dXw(t, p, Xw, xc);
+  rate->temperature_rate_ =
+      theory::dC_dt(t, p, Xw, xc, dXw_dF, dF_dt, dXw_dPsv, dPsv_dt);
+  rate->humidity_rate_ = theory::dC_dh(dC_dXw, dXw_dh);
+  rate->pressure_rate_ = theory::dC_dp(t, p, Xw, xc, dXw_dp);
+  rate->co2_mole_fraction_rate_ = theory::dC_dxc(t, p, Xw, xc);
+  return C;
+}
+
+template <typename Scalar>
+auto QuickCompute(const BasicEnvironment<Scalar>& ambient_conitions)
+    -> Scalar {
+  const auto t = ambient_conitions.temperature_;
+  const auto h = ambient_conitions.humidity_;
+  const auto p = ambient_conitions.pressure_;
+  const auto xc = ambient_conitions.co2_mole_fraction_;
+  const auto T = theory::T(t);
+  const auto F = theory::F(p, t);
+  const auto Psv = theory::FastPsv(T);
+  const auto Xw = theory::Xw(h, F, Psv, p);
+  return theory::C(t, p, Xw, xc);
+}
+
+// First-order Taylor expansion about a linearization point, shared by every
+// class that keeps one
+template <typename Scalar>
+auto LinearApproximation(const BasicEnvironment<Scalar>& init_environment,
+                         const Scalar init_speed_of_sound,
+                         const BasicEnvironmentRate<Scalar>& rate,
+                         const BasicEnvironment<Scalar>& ambient_conitions)
+    -> Scalar {
+  auto approx_speed_of_sound = init_speed_of_sound;
+  approx_speed_of_sound +=
+      (ambient_conitions.temperature_ - init_environment.temperature_) *
+      rate.temperature_rate_;
+  approx_speed_of_sound +=
+      (ambient_conitions.humidity_ - init_environment.humidity_) *
+      rate.humidity_rate_;
+  approx_speed_of_sound +=
+      (ambient_conitions.pressure_ - init_environment.pressure_) *
+      rate.pressure_rate_;
+  approx_speed_of_sound += (ambient_conitions.co2_mole_fraction_ -
+                            init_environment.co2_mole_fraction_) *
+                           rate.co2_mole_fraction_rate_;
+  return approx_speed_of_sound;
+}
+
+}  // namespace internal
+
+template <typename Scalar>
+BasicSpeedOfSound<Scalar>::BasicSpeedOfSound()
+    : approximation_order_(ApproximationOrder::kLinear) {
+  Compute(init_environment_);
+}
+
+template <typename Scalar>
+BasicSpeedOfSound<Scalar>::BasicSpeedOfSound(
+    const BasicEnvironment<Scalar>& ambient_conitions)
+    : approximation_order_(ApproximationOrder::kLinear) {
+  Compute(ambient_conitions);
+}
+
+template <typename Scalar>
+BasicSpeedOfSound<Scalar>::BasicSpeedOfSound(
+    const BasicEnvironment<Scalar>& ambient_conitions,
+    const ApproximationOrder approximation_order)
+    : approximation_order_(approximation_order) {
+  Compute(ambient_conitions);
+}
+
+template <typename Scalar>
+auto BasicSpeedOfSound<Scalar>::GetApproximationOrder() const
+    -> ApproximationOrder {
+  return approximation_order_;
+}
+
+template <typename Scalar>
+auto BasicSpeedOfSound<Scalar>::GetInitSpeedOfSound() const -> Scalar {
+  return init_speed_of_sound_;
+}
+
+template <typename Scalar>
+auto BasicSpeedOfSound<Scalar>::GetInitEnvironment() const
+    -> BasicEnvironment<Scalar> {
+  return init_environment_;
+}
+
+template <typename Scalar>
+auto BasicSpeedOfSound<Scalar>::GetInitEnvironmentRate() const
+    -> BasicEnvironmentRate<Scalar> {
+  return init_environment_rate_;
+}
+
+template <typename Scalar>
+auto BasicSpeedOfSound<Scalar>::GetInitEnvironmentCurvature() const
+    -> BasicEnvironmentCurvature<Scalar> {
+  return init_environment_curvature_;
+}
+
+template <typename Scalar>
+auto BasicSpeedOfSound<Scalar>::Compute(
+    const BasicEnvironment<Scalar>& ambient_conitions) -> Scalar {
+  SPEED_OF_SOUND_PROBE(kCompute, Compute(ambient_conitions));
+  const auto T = theory::T(ambient_conitions.temperature_);
+  Scalar dPsv_dt = 0;
+  const auto Psv = theory::FastPsvAndDerivative(T, &dPsv_dt);
+  init_speed_of_sound_ = internal::ComputeRate(ambient_conitions, Psv, dPsv_dt,
+                                               &init_environment_rate_);
+  init_environment_ = ambient_conitions;
+  if (approximation_order_ == ApproximationOrder::kQuadratic) {
+    ComputeCurvature(ambient_conitions);
+  }
+  return init_speed_of_sound_;
+}
+
+template <typename Scalar>
+auto BasicSpeedOfSound<Scalar>::ComputeRate(
+    const BasicEnvironment<Scalar>& ambient_conitions,
+    BasicEnvironmentRate<Scalar>* rate) const -> Scalar {
+  SPEED_OF_SOUND_PROBE(kComputeRate, ComputeRate(ambient_conitions, rate));
+  const auto T = theory::T(ambient_conitions.temperature_);
+  Scalar dPsv_dt = 0;
+  const auto Psv = theory::FastPsvAndDerivative(T, &dPsv_dt);
+  return internal::ComputeRate(ambient_conitions, Psv, dPsv_dt, rate);
+}
+
+template <typename Scalar>
+auto BasicSpeedOfSound<Scalar>::QuickCompute(
+    const BasicEnvironment<Scalar>& ambient_conitions) const -> Scalar {
+  SPEED_OF_SOUND_PROBE(kQuickCompute, QuickCompute(ambient_conitions));
+  return internal::QuickCompute(ambient_conitions);
+}
+
+template <typename Scalar>
+auto BasicSpeedOfSound<Scalar>::Approximate(
+    const BasicEnvironment<Scalar>& ambient_conitions) const -> Scalar {
+#ifdef SPEED_OF_SOUND_INSTRUMENTATION
+  // Drift and error are checked outside the timed call
+  if (instrumentation::Count(instrumentation::Probe::kApproximate)) {
+    return RecordApproximation(
+        ambient_conitions,
+        instrumentation::Time(instrumentation::Probe::kApproximate,
+                              [&] { return Approximate(ambient_conitions); }));
+  }
+#endif
+  auto approx_speed_of_sound = internal::LinearApproximation(
+      init_environment_, init_speed_of_sound_, init_environment_rate_,
+      ambient_conitions);
+  if (approximation_order_ == ApproximationOrder::kQuadratic) {
+    approx_speed_of_sound += ApproximateCurvature(ambient_conitions);
+  }
+  return approx_speed_of_sound;
+}
+
+#ifdef SPEED_OF_SOUND_INSTRUMENTATION
+template <typename Scalar>
+auto BasicSpeedOfSound<Scalar>::RecordApproximation(
+    const BasicEnvironment<Scalar>& ambient_conitions,
+    const Scalar approx_speed_of_sound) const -> Scalar {
+  const double drift[] = {
+      fabs(static_cast<double>(ambient_conitions.temperature_ -
+                               init_environment_.temperature_)) /
+          (theory::kMaxTemperature - theory::kMinTemperature),
+      fabs(static_cast<double>(ambient_conitions.humidity_ -
+                               init_environment_.humidity_)) /
+          (theory::kMaxHumidity - theory::kMinHumidity),
+      fabs(static_cast<double>(ambient_conitions.pressure_ -
+                               init_environment_.pressure_)) /
+          (theory::kMaxPressure - theory::kMinPressure),
+      fabs(static_cast<double>(ambient_conitions.co2_mole_fraction_ -
+                               init_environment_.co2_mole_fraction_)) /
+          (theory::kMaxCO2MoleFraction - theory::kMinCO2MoleFraction)};
+  instrumentation::RecordDrift(
+      fmax(fmax(drift[0], drift[1]), fmax(drift[2], drift[3])));
+  instrumentation::RecordApproximationError(fabs(static_cast<double>(
+      approx_speed_of_sound - internal::QuickCompute(ambient_conitions))));
+  return approx_speed_of_sound;
+}
+#endif
+
+template <typename Scalar>
+auto BasicSpeedOfSound<Scalar>::ApproximateCurvature(
+    const BasicEnvironment<Scalar>& ambient_conitions) const -> Scalar {
+  const auto& H = init_environment_curvature_;
+  const auto dt =
+      ambient_conitions.temperature_ - init_environment_.temperature_;
+  const auto dh = ambient_conitions.humidity_ - init_environment_.humidity_;
+  const auto dp = ambient_conitions.pressure_ - init_environment_.pressure_;
+  const auto dxc = ambient_conitions.co2_mole_fraction_ -
+                   init_environment_.co2_mole_fraction_;
+  auto speed_of_sound_curvature = H.temperature_temperature_ * dt * dt;
+  speed_of_sound_curvature += H.humidity_humidity_ * dh * dh;
+  speed_of_sound_curvature += H.pressure_pressure_ * dp * dp;
+  speed_of_sound_curvature +=
+      H.co2_mole_fraction_co2_mole_fraction_ * dxc * dxc;
+  speed_of_sound_curvature *= static_cast<Scalar>(0.5);
+  speed_of_sound_curvature += H.temperature_humidity_ * dt * dh;
+  speed_of_sound_curvature += H.temperature_pressure_ * dt * dp;
+  speed_of_sound_curvature += H.temperature_co2_mole_fraction_ * dt * dxc;
+  speed_of_sound_curvature += H.humidity_pressure_ * dh * dp;
+  speed_of_sound_curvature += H.humidity_co2_mole_fraction_ * dh * dxc;
+  speed_of_sound_curvature += H.pressure_co2_mole_fraction_ * dp * dxc;
+  return speed_of_sound_curvature;
+}
+
+template <typename Scalar>
+auto BasicSpeedOfSound<Scalar>::ComputeCurvature(
+    const BasicEnvironment<Scalar>& ambient_conitions) -> void {
+  const auto t = ambient_conitions.temperature_;
+  const auto h = ambient_conitions.humidity_;
+  const auto p = ambient_conitions.pressure_;
+  const auto xc = ambient_conitions.co2_mole_fraction_;
+  const auto T = theory::T(t);
+  const auto F = theory::F(p, t);
+  Scalar dPsv_dt = 0;
+  const auto Psv = theory::FastPsvAndDerivative(T, &dPsv_dt);
+  const auto Xw = theory::Xw(h, F, Psv, p);
+  const auto dF_dt = theory::dF_dt(t);
+  const auto d2F_dt2 = theory::d2F_dt2<Scalar>();
+  const auto d2Psv_dt2 = theory::d2Psv_dt2(T, Psv);
+  const auto dXw_dt = theory::dXw_dF(h, Psv, p) * dF_dt +
+                      theory::dXw_dPsv(h, F, p) * dPsv_dt;
+  const auto dXw_dh = theory::dXw_dh(F, Psv, p);
+  const auto dXw_dp = theory::dXw_dp(h, F, Psv, p);
+  const auto d2Xw_dt2 =
+      theory::d2Xw_dt2(h, F, Psv, p, dF_dt, dPsv_dt, d2F_dt2, d2Psv_dt2);
+  const auto d2Xw_dtdh = theory::d2Xw_dtdh(F, Psv, p, dF_dt, dPsv_dt);
+  const auto d2Xw_dtdp = theory::d2Xw_dtdp(h, F, Psv, p, dF_dt, dPsv_dt);
+  const auto d2Xw_dhdp = theory::d2Xw_dhdp(F, Psv, p);
+  const auto d2Xw_dp2 = theory::d2Xw_dp2(h, F, Psv, p);
+  auto& H = init_environment_curvature_;
+  H.temperature_temperature_ = theory::d2C_dt2(t, p, Xw, xc, dXw_dt, d2Xw_dt2);
+  H.temperature_humidity_ =
+      theory::d2C_dtdh(t, p, Xw, xc, dXw_dt, dXw_dh, d2Xw_dtdh);
+  H.temperature_pressure_ =
+      theory::d2C_dtdp(t, p, Xw, xc, dXw_dt, dXw_dp, d2Xw_dtdp);
+  H.temperature_co2_mole_fraction_ = theory::d2C_dtdxc(t, p, dXw_dt);
+  H.humidity_humidity_ = theory::d2C_dh2(dXw_dh);
+  H.humidity_pressure_ =
+      theory::d2C_dhdp(t, p, Xw, xc, dXw_dh, dXw_dp, d2Xw_dhdp);
+  H.humidity_co2_mole_fraction_ = theory::d2C_dhdxc(p, dXw_dh);
+  H.pressure_pressure_ = theory::d2C_dp2(t, p, Xw, xc, dXw_dp, d2Xw_dp2);
+  H.pressure_co2_mole_fraction_ = theory::d2C_dpdxc(p, Xw, dXw_dp);
+  H.co2_mole_fraction_co2_mole_fraction_ = theory::d2C_dxc2<Scalar>();
+}
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_INL_H_
@@ -0,0 +1,235 @@
+#include "speed-of-sound-instrumentation.h"
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include <mutex>
+
+namespace speedofsound {
+
+namespace instrumentation {
+
+__thread ThreadCounters thread_counters;
+
+namespace {
+
+const char* const kProbeNames[kProbeCount] = {"compute", "compute_rate",
+                                              "quick_compute", "approximate"};
+
+// Guards the list of live threads and the totals below
+std::mutex mutex;
+ThreadCounters* threads = nullptr;
+// Counters of threads that have exited
+Snapshot retired;
+Snapshot baseline;
+
+auto Load(const std::atomic<uint64_t>& counter) -> uint64_t {
+  return counter.load(std::memory_order_relaxed);
+}
+
+auto Add(const ThreadCounters& counters, Snapshot* snapshot) -> void {
+  for (size_t i = 0; i < kProbeCount; ++i) {
+    snapshot->calls_[i] += Load(counters.calls_[i]);
+    snapshot->samples_[i] += Load(counters.samples_[i]);
+    snapshot->sampled_cycles_[i] += Load(counters.sampled_cycles_[i]);
+  }
+  snapshot->invalid_environments_ += Load(counters.invalid_environments_);
+  for (size_t i = 0; i < kHistogramBuckets; ++i) {
+    snapshot->drift_[i] += Load(counters.drift_[i]);
+    snapshot->approximation_error_[i] +=
+        Load(counters.approximation_error_[i]);
+  }
+}
+
+// All threads since the start of the process
+auto Total() -> Snapshot {
+  auto total = retired;
+  for (auto counters = threads; counters != nullptr;
+       counters = counters->next_) {
+    Add(*counters, &total);
+  }
+  return total;
+}
+
+// Adds the counters of the thread to the list, and folds them into the
+// retired totals when the thread exits
+class Registration {
+ public:
+  Registration() {
+    std::lock_guard<std::mutex> lock(mutex);
+    thread_counters.next_ = threads;
+    threads = &thread_counters;
+  }
+  ~Registration() {
+    std::lock_guard<std::mutex> lock(mutex);
+    Add(thread_counters, &retired);
+    auto link = &threads;
+    while (*link != &thread_counters) link = &(*link)->next_;
+    *link = thread_counters.next_;
+  }
+};
+
+auto RegisterThread() -> void { thread_local Registration registration; }
+
+// Time stamp counter on x86 and the virtual counter on ARMv8; zero elsewhere,
+// where samples count calls without timing them
+auto ReadCycleCounter() -> uint64_t {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  uint64_t ticks;
+  asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+  return ticks;
+#else
+  return 0;
+#endif
+}
+
+auto Increment(std::atomic<uint64_t>* counter) -> void {
+  counter->store(counter->load(std::memory_order_relaxed) + 1,
+                 std::memory_order_relaxed);
+}
+
+auto Append(char** text, size_t* size, const char* format, ...) -> bool {
+  va_list arguments;
+  va_start(arguments, format);
+  const auto length = vsnprintf(*text, *size, format, arguments);
+  va_end(arguments);
+  if (length < 0 || static_cast<size_t>(length) >= *size) return false;
+  *text += length;
+  *size -= length;
+  return true;
+}
+
+auto AppendHistogram(char** text, size_t* size, const char* name,
+                     const uint64_t* buckets) -> bool {
+  if (!Append(text, size, ",\"%s\":[", name)) return false;
+  for (size_t i = 0; i < kHistogramBuckets; ++i) {
+    if (!Append(text, size, i > 0 ? ",%llu" : "%llu",
+                static_cast<unsigned long long>(buckets[i]))) {
+      return false;
+    }
+  }
+  return Append(text, size, "]");
+}
+
+}  // namespace
+
+Snapshot::Snapshot()
+    : calls_(),
+      samples_(),
+      sampled_cycles_(),
+      invalid_environments_(0),
+      drift_(),
+      approximation_error_() {}
+
+auto Snapshot::Calls(const Probe probe) const -> uint64_t {
+  return calls_[static_cast<size_t>(probe)];
+}
+
+auto Snapshot::MeanCycles(const Probe probe) const -> double {
+  const auto i = static_cast<size_t>(probe);
+  return samples_[i] > 0
+             ? static_cast<double>(sampled_cycles_[i]) / samples_[i]
+             : 0.0;
+}
+
+auto TakeSnapshot() -> Snapshot {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto snapshot = Total();
+  for (size_t i = 0; i < kProbeCount; ++i) {
+    snapshot.calls_[i] -= baseline.calls_[i];
+    snapshot.samples_[i] -= baseline.samples_[i];
+    snapshot.sampled_cycles_[i] -= baseline.sampled_cycles_[i];
+  }
+  snapshot.invalid_environments_ -= baseline.invalid_environments_;
+  for (size_t i = 0; i < kHistogramBuckets; ++i) {
+    snapshot.drift_[i] -= baseline.drift_[i];
+    snapshot.approximation_error_[i] -= baseline.approximation_error_[i];
+  }
+  return snapshot;
+}
+
+auto ResetInstrumentation() -> void {
+  std::lock_guard<std::mutex> lock(mutex);
+  baseline = Total();
+}
+
+auto FormatJson(const Snapshot& snapshot, char* text, const size_t size)
+    -> bool {
+  auto remaining = size;
+  if (!Append(&text, &remaining, "{\"invalid_environments\":%llu",
+              static_cast<unsigned long long>(
+                  snapshot.invalid_environments_))) {
+    return false;
+  }
+  for (size_t i = 0; i < kProbeCount; ++i) {
+    if (!Append(&text, &remaining,
+                ",\"%s\":{\"calls\":%llu,\"samples\":%llu,"
+                "\"sampled_cycles\":%llu}",
+                kProbeNames[i],
+                static_cast<unsigned long long>(snapshot.calls_[i]),
+                static_cast<unsigned long long>(snapshot.samples_[i]),
+                static_cast<unsigned long long>(
+                    snapshot.sampled_cycles_[i]))) {
+      return false;
+    }
+  }
+  return AppendHistogram(&text, &remaining, "drift", snapshot.drift_) &&
+         AppendHistogram(&text, &remaining, "approximation_error",
+                         snapshot.approximation_error_) &&
+         Append(&text, &remaining, "}");
+}
+
+auto HistogramBucket(const double value) -> size_t {
+  if (!(value >= ldexp(1.0, kHistogramMinExponent))) return 0;
+  int exponent;
+  frexp(value, &exponent);
+  // value is in [2^(exponent - 1), 2^exponent)
+  const auto bucket = exponent - kHistogramMinExponent;
+  return bucket < static_cast<int>(kHistogramBuckets)
+             ? static_cast<size_t>(bucket)
+             : kHistogramBuckets - 1;
+}
+
+auto RecordDrift(const double drift) -> void {
+  RegisterThread();
+  Increment(&thread_counters.drift_[HistogramBucket(drift)]);
+}
+
+auto RecordApproximationError(const double error) -> void {
+  RegisterThread();
+  Increment(&thread_counters.approximation_error_[HistogramBucket(error)]);
+}
+
+auto CountInvalidEnvironment() -> void {
+  RegisterThread();
+  Increment(&thread_counters.invalid_environments_);
+}
+
+auto StartSample() -> uint64_t {
+  RegisterThread();
+  return ReadCycleCounter();
+}
+
+auto FinishSample(const Probe probe, const uint64_t start) -> void {
+  const auto cycles = ReadCycleCounter() - start;
+  const auto i = static_cast<size_t>(probe);
+  auto& sampled_cycles = thread_counters.sampled_cycles_[i];
+  sampled_cycles.store(
+      sampled_cycles.load(std::memory_order_relaxed) + cycles,
+      std::memory_order_relaxed);
+  Increment(&thread_counters.samples_[i]);
+  auto& calls = thread_counters.calls_[i];
+  calls.store(calls.load(std::memory_order_relaxed) - 1,
+              std::memory_order_relaxed);
+}
+
+}  // namespace instrumentation
+
+}  // namespace speedofsound
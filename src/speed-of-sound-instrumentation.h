@@ -0,0 +1,139 @@
+#ifndef SPEED_OF_SOUND_INSTRUMENTATION_H_
+#define SPEED_OF_SOUND_INSTRUMENTATION_H_
+
+// Call counters, histograms and cycle samples for the hot paths, compiled in
+// only with SPEED_OF_SOUND_INSTRUMENTATION defined (the ENABLE_INSTRUMENTATION
+// CMake option). Without it the probes below expand to no-op statements and
+// this header declares nothing else.
+#ifdef SPEED_OF_SOUND_INSTRUMENTATION
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+namespace speedofsound {
+
+namespace instrumentation {
+
+enum class Probe { kCompute, kComputeRate, kQuickCompute, kApproximate };
+const size_t kProbeCount = 4;
+
+// One call in kSamplePeriod per probe and thread is timed, and for
+// Approximate also checked for drift and error. A power of two.
+const uint64_t kSamplePeriod = 1024;
+
+// Bucket 0 holds values below 2^kHistogramMinExponent, including zero. Bucket
+// i holds [2^(kHistogramMinExponent + i - 1), 2^(kHistogramMinExponent + i))
+// and the last bucket everything above.
+const int kHistogramMinExponent = -18;
+const size_t kHistogramBuckets = 21;
+
+// Counters of one thread. Only the owning thread writes them, so increments
+// are plain loads and stores; atomics only make snapshots from other threads
+// well defined. Zero-initialized as thread-local storage.
+class ThreadCounters {
+ public:
+  std::atomic<uint64_t> calls_[kProbeCount];
+  std::atomic<uint64_t> samples_[kProbeCount];
+  std::atomic<uint64_t> sampled_cycles_[kProbeCount];
+  std::atomic<uint64_t> invalid_environments_;
+  std::atomic<uint64_t> drift_[kHistogramBuckets];
+  std::atomic<uint64_t> approximation_error_[kHistogramBuckets];
+  ThreadCounters* next_;
+};
+
+// Totals over all threads, including threads that have exited, since the
+// last ResetInstrumentation
+class Snapshot {
+ public:
+  Snapshot();
+  auto Calls(const Probe probe) const -> uint64_t;
+  // Mean cycle counter ticks over the sampled calls; zero without samples
+  auto MeanCycles(const Probe probe) const -> double;
+  uint64_t calls_[kProbeCount];
+  uint64_t samples_[kProbeCount];
+  uint64_t sampled_cycles_[kProbeCount];
+  uint64_t invalid_environments_;
+  // Largest difference of a sampled environment from the linearization point
+  // of Approximate, each parameter divided by the width of its valid range
+  uint64_t drift_[kHistogramBuckets];
+  // |Approximate - QuickCompute| (m/s) of the sampled calls
+  uint64_t approximation_error_[kHistogramBuckets];
+};
+
+auto TakeSnapshot() -> Snapshot;
+// Later snapshots count from here. Threads keep writing their own counters,
+// so this moves a baseline rather than clearing them.
+auto ResetInstrumentation() -> void;
+// The snapshot as a JSON object, NUL-terminated. False if it does not fit in
+// size characters.
+auto FormatJson(const Snapshot& snapshot, char* text, const size_t size)
+    -> bool;
+
+auto HistogramBucket(const double value) -> size_t;
+auto RecordDrift(const double drift) -> void;
+auto RecordApproximationError(const double error) -> void;
+auto CountInvalidEnvironment() -> void;
+
+// Counters of the calling thread. __thread rather than thread_local, so that
+// the hot path is a single access relative to the thread pointer without a
+// check for dynamic initialization. A thread is added to the snapshots by
+// its first sampled call.
+extern __thread ThreadCounters thread_counters;
+
+// Counts a call; true for every kSamplePeriod-th call of the probe on the
+// thread, which is then made again through Time
+inline auto Count(const Probe probe) -> bool {
+  auto& calls = thread_counters.calls_[static_cast<size_t>(probe)];
+  const auto count = calls.load(std::memory_order_relaxed);
+  calls.store(count + 1, std::memory_order_relaxed);
+  return (count & (kSamplePeriod - 1)) == 0;
+}
+
+// Registers the thread and reads the cycle counter
+auto StartSample() -> uint64_t;
+// Adds the cycles since start and takes back the count of the call made
+// again by Time
+auto FinishSample(const Probe probe, const uint64_t start) -> void;
+
+// Out of line, so that the probed functions make no calls on their common
+// path and need no stack frame for them
+template <typename Function>
+__attribute__((noinline)) auto Time(const Probe probe,
+                                    const Function& function)
+    -> decltype(function()) {
+  const auto start = StartSample();
+  const auto result = function();
+  FinishSample(probe, start);
+  return result;
+}
+
+}  // namespace instrumentation
+
+}  // namespace speedofsound
+
+// Counts the call. A sampled call returns call, the probed function called
+// again with the same arguments, timed by Time.
+#define SPEED_OF_SOUND_PROBE(probe, call)                                  \
+  do {                                                                     \
+    if (::speedofsound::instrumentation::Count(                            \
+            ::speedofsound::instrumentation::Probe::probe)) {              \
+      return ::speedofsound::instrumentation::Time(                        \
+          ::speedofsound::instrumentation::Probe::probe,                   \
+          [&] { return call; });                                           \
+    }                                                                      \
+  } while (0)
+#define SPEED_OF_SOUND_COUNT_INVALID_ENVIRONMENT()               \
+  do {                                                          \
+    ::speedofsound::instrumentation::CountInvalidEnvironment(); \
+  } while (0)
+
+#else
+
+#define SPEED_OF_SOUND_PROBE(probe, call) ((void)0)
+#define SPEED_OF_SOUND_COUNT_INVALID_ENVIRONMENT() ((void)0)
+
+#endif  // SPEED_OF_SOUND_INSTRUMENTATION
+
+#endif  // SPEED_OF_SOUND_INSTRUMENTATION_H_
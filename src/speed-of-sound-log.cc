@@ -0,0 +1,334 @@
+#include "speed-of-sound-log.h"
+
+#include <fcntl.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "environment.h"
+#include "speed-of-sound-adaptive.h"
+#include "speed-of-sound-batch.h"
+
+namespace speedofsound {
+
+namespace {
+
+const size_t kFieldCount = 4;
+const size_t kMaxCsvLength = 32;
+const size_t kMaxFieldLength = 63;
+
+// Integers up to 10^15 and powers of ten up to 10^22 are exact doubles
+const int kMaxFastDigits = 15;
+const int kMaxFastExponent = 22;
+const double kPowersOfTen[kMaxFastExponent + 1] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+auto IsSpace(const char c) -> bool { return c == ' ' || c == '\t'; }
+
+auto IsDigit(const char c) -> bool { return c >= '0' && c <= '9'; }
+
+// Plain decimals with few digits, as sensors log them. Dividing the exact
+// digits by an exact power of ten rounds correctly, so the result equals
+// strtod's; anything else is left to strtod.
+auto ParseDecimal(const char* begin, const char* end, double* value) -> bool {
+  auto negative = false;
+  if (begin < end && (*begin == '-' || *begin == '+')) {
+    negative = *begin++ == '-';
+  }
+  uint64_t mantissa = 0;
+  auto digits = 0, significant_digits = 0, fraction_digits = 0;
+  auto fraction = false;
+  for (; begin < end; ++begin) {
+    if (*begin == '.' && !fraction) {
+      fraction = true;
+      continue;
+    }
+    if (!IsDigit(*begin)) return false;
+    mantissa = mantissa * 10 + static_cast<uint64_t>(*begin - '0');
+    ++digits;
+    if (mantissa != 0) ++significant_digits;
+    if (fraction) ++fraction_digits;
+  }
+  if (digits == 0 || significant_digits > kMaxFastDigits ||
+      fraction_digits > kMaxFastExponent) {
+    return false;
+  }
+  *value = static_cast<double>(mantissa) / kPowersOfTen[fraction_digits];
+  if (negative) *value = -*value;
+  return true;
+}
+
+// Parses a number spanning all of [begin, end) apart from surrounding spaces.
+// strtod needs a terminated string, and the mapping is not terminated.
+auto ParseField(const char* begin, const char* end, double* value) -> bool {
+  while (begin < end && IsSpace(*begin)) ++begin;
+  while (end > begin && IsSpace(end[-1])) --end;
+  const auto length = static_cast<size_t>(end - begin);
+  if (ParseDecimal(begin, end, value)) return true;
+  if (length == 0 || length > kMaxFieldLength) return false;
+  char field[kMaxFieldLength + 1];
+  memcpy(field, begin, length);
+  field[length] = '\0';
+  char* field_end = nullptr;
+  *value = strtod(field, &field_end);
+  return field_end == field + length;
+}
+
+// snprintf takes several hundred nanoseconds per value, which would dominate
+// CSV output. Values beyond kMaxFixedValue or NaN fall back to it.
+const double kMaxFixedValue = 1.0e9;
+
+auto FormatFixed(const double value, char* text) -> size_t {
+  if (!(fabs(value) < kMaxFixedValue)) {
+    return static_cast<size_t>(
+        snprintf(text, kMaxCsvLength, "%.17g\n", value));
+  }
+  const auto scale = kPowersOfTen[kLogCsvDecimals];
+  const auto scaled = static_cast<uint64_t>(fabs(value) * scale + 0.5);
+  auto integer = scaled / static_cast<uint64_t>(scale);
+  auto decimals = scaled % static_cast<uint64_t>(scale);
+  char digits[kMaxCsvLength];
+  size_t count = 0;
+  for (auto i = 0; i < kLogCsvDecimals; ++i, decimals /= 10) {
+    digits[count++] = static_cast<char>('0' + decimals % 10);
+  }
+  digits[count++] = '.';
+  do {
+    digits[count++] = static_cast<char>('0' + integer % 10);
+    integer /= 10;
+  } while (integer > 0);
+  if (value < 0.0 && scaled > 0) digits[count++] = '-';
+  for (size_t i = 0; i < count; ++i) text[i] = digits[count - 1 - i];
+  text[count] = '\n';
+  return count + 1;
+}
+
+auto ParseRecord(const char* begin, const char* end, double* fields) -> bool {
+  for (size_t i = 0; i < kFieldCount; ++i) {
+    const auto separator = i + 1 < kFieldCount
+                               ? static_cast<const char*>(
+                                     memchr(begin, ',', end - begin))
+                               : end;
+    if (separator == nullptr || !ParseField(begin, separator, &fields[i])) {
+      return false;
+    }
+    begin = separator + 1;
+  }
+  return true;
+}
+
+// A header names the fields, so none of them is a number
+auto IsHeader(const char* begin, const char* end) -> bool {
+  while (true) {
+    const auto separator =
+        static_cast<const char*>(memchr(begin, ',', end - begin));
+    const auto field_end = separator != nullptr ? separator : end;
+    double value;
+    if (ParseField(begin, field_end, &value)) return false;
+    if (separator == nullptr) return true;
+    begin = separator + 1;
+  }
+}
+
+}  // namespace
+
+LogReader::LogReader()
+    : format_(LogFormat::kCsv),
+      mapping_(nullptr),
+      size_(0),
+      position_(0),
+      released_(0),
+      line_(0),
+      error_(false) {}
+
+LogReader::~LogReader() { Reset(); }
+
+auto LogReader::Open(const char* path, const LogFormat format) -> bool {
+  Reset();
+  const auto fd = open(path, O_RDONLY);
+  if (fd < 0) return false;
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    close(fd);
+    return false;
+  }
+  const auto size = static_cast<size_t>(file_stat.st_size);
+  if (format == LogFormat::kBinary &&
+      size % (kFieldCount * sizeof(double)) != 0) {
+    close(fd);
+    return false;
+  }
+  format_ = format;
+  if (size == 0) {
+    close(fd);
+    return true;
+  }
+  auto mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) return false;
+  madvise(mapping, size, MADV_SEQUENTIAL);
+  mapping_ = static_cast<const char*>(mapping);
+  size_ = size;
+  return true;
+}
+
+auto LogReader::GetSize() const -> size_t { return size_; }
+
+auto LogReader::Read(const size_t capacity, double* temperature,
+                     double* humidity, double* pressure,
+                     double* co2_mole_fraction) -> size_t {
+  if (error_) return 0;
+  const auto count =
+      format_ == LogFormat::kCsv
+          ? ReadCsv(capacity, temperature, humidity, pressure,
+                    co2_mole_fraction)
+          : ReadBinary(capacity, temperature, humidity, pressure,
+                       co2_mole_fraction);
+  Release();
+  return count;
+}
+
+auto LogReader::HasError() const -> bool { return error_; }
+
+auto LogReader::GetErrorLine() const -> size_t { return error_ ? line_ : 0; }
+
+auto LogReader::ReadCsv(const size_t capacity, double* temperature,
+                        double* humidity, double* pressure,
+                        double* co2_mole_fraction) -> size_t {
+  size_t count = 0;
+  while (count < capacity && position_ < size_) {
+    const auto begin = mapping_ + position_;
+    const auto newline =
+        static_cast<const char*>(memchr(begin, '\n', size_ - position_));
+    auto end = newline != nullptr ? newline : mapping_ + size_;
+    position_ = static_cast<size_t>(end - mapping_) + (newline != nullptr);
+    ++line_;
+    if (end > begin && end[-1] == '\r') --end;
+    auto first = begin;
+    while (first < end && IsSpace(*first)) ++first;
+    if (first == end || *first == '#') continue;
+    double fields[kFieldCount];
+    if (!ParseRecord(begin, end, fields)) {
+      if (line_ == 1 && IsHeader(begin, end)) continue;
+      error_ = true;
+      return count;
+    }
+    temperature[count] = fields[0];
+    humidity[count] = fields[1];
+    pressure[count] = fields[2];
+    co2_mole_fraction[count] = fields[3];
+    ++count;
+  }
+  return count;
+}
+
+auto LogReader::ReadBinary(const size_t capacity, double* temperature,
+                           double* humidity, double* pressure,
+                           double* co2_mole_fraction) -> size_t {
+  const auto record_size = kFieldCount * sizeof(double);
+  const auto remaining = (size_ - position_) / record_size;
+  const auto count = remaining < capacity ? remaining : capacity;
+  for (size_t i = 0; i < count; ++i) {
+    // The mapping gives no alignment guarantee for the records
+    double fields[kFieldCount];
+    memcpy(fields, mapping_ + position_ + i * record_size, record_size);
+    temperature[i] = fields[0];
+    humidity[i] = fields[1];
+    pressure[i] = fields[2];
+    co2_mole_fraction[i] = fields[3];
+  }
+  position_ += count * record_size;
+  line_ += count;
+  return count;
+}
+
+auto LogReader::Release() -> void {
+  const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const auto end = position_ / page_size * page_size;
+  if (end <= released_) return;
+  madvise(const_cast<char*>(mapping_) + released_, end - released_,
+          MADV_DONTNEED);
+  released_ = end;
+}
+
+auto LogReader::Reset() -> void {
+  if (mapping_ != nullptr) munmap(const_cast<char*>(mapping_), size_);
+  format_ = LogFormat::kCsv;
+  mapping_ = nullptr;
+  size_ = 0;
+  position_ = 0;
+  released_ = 0;
+  line_ = 0;
+  error_ = false;
+}
+
+LogWriter::LogWriter(FILE* file, const LogFormat format)
+    : file_(file), format_(format), used_(0), bytes_written_(0) {}
+
+auto LogWriter::Write(const double* speed_of_sound, const size_t count)
+    -> bool {
+  for (size_t i = 0; i < count; ++i) {
+    if (used_ + kMaxCsvLength > kBufferSize && !Flush()) return false;
+    if (format_ == LogFormat::kBinary) {
+      memcpy(buffer_ + used_, &speed_of_sound[i], sizeof(double));
+      used_ += sizeof(double);
+    } else {
+      used_ += FormatFixed(speed_of_sound[i], buffer_ + used_);
+    }
+  }
+  return true;
+}
+
+auto LogWriter::Flush() -> bool {
+  const auto written = fwrite(buffer_, 1, used_, file_);
+  const auto ok = written == used_;
+  bytes_written_ += written;
+  used_ = 0;
+  return ok;
+}
+
+auto LogWriter::GetBytesWritten() const -> size_t { return bytes_written_; }
+
+LogStatistics::LogStatistics()
+    : records_(0), invalid_records_(0), bytes_read_(0), bytes_written_(0) {}
+
+auto ProcessLog(LogReader* reader, LogWriter* writer, const LogEngine engine,
+                const double tolerance, LogStatistics* statistics) -> bool {
+  double temperature[kLogBlockSize], humidity[kLogBlockSize],
+      pressure[kLogBlockSize], co2_mole_fraction[kLogBlockSize],
+      speed_of_sound[kLogBlockSize];
+  const EnvironmentArrays ambient_conditions(temperature, humidity, pressure,
+                                             co2_mole_fraction);
+  AdaptiveSpeedOfSound adaptive_speed_of_sound(tolerance);
+  *statistics = LogStatistics();
+  size_t count;
+  while ((count = reader->Read(kLogBlockSize, temperature, humidity,
+                               pressure, co2_mole_fraction)) > 0) {
+    if (engine == LogEngine::kQuickCompute) {
+      QuickComputeBatch(ambient_conditions, count, speed_of_sound);
+    }
+    for (size_t i = 0; i < count; ++i) {
+      const Environment environment(temperature[i], humidity[i], pressure[i],
+                                    co2_mole_fraction[i]);
+      if (!environment.ValidateEnvironment()) {
+        speed_of_sound[i] = NAN;
+        ++statistics->invalid_records_;
+      } else if (engine == LogEngine::kApproximate) {
+        speed_of_sound[i] = adaptive_speed_of_sound.Approximate(environment);
+      }
+    }
+    if (!writer->Write(speed_of_sound, count)) return false;
+    statistics->records_ += count;
+  }
+  const auto ok = writer->Flush() && !reader->HasError();
+  statistics->bytes_read_ = reader->GetSize();
+  statistics->bytes_written_ = writer->GetBytesWritten();
+  return ok;
+}
+
+}  // namespace speedofsound
@@ -0,0 +1,102 @@
+#ifndef SPEED_OF_SOUND_LOG_H_
+#define SPEED_OF_SOUND_LOG_H_
+
+#include <stddef.h>
+#include <stdio.h>
+
+namespace speedofsound {
+
+// CSV logs hold one "temperature,humidity,pressure,co2_mole_fraction" record
+// per line; blank lines, lines starting with '#' and a header on the first
+// line, whose fields are not numbers, are skipped. Binary logs hold packed
+// records of four native-endian doubles in the same order, like an array of
+// Environment.
+enum class LogFormat { kCsv, kBinary };
+
+// kApproximate uses AdaptiveSpeedOfSound, so that the error stays within a
+// tolerance however far the log wanders from the first record
+enum class LogEngine { kQuickCompute, kApproximate };
+
+// Decimal places of CSV output, i.e. within 5e-10 m/s
+const int kLogCsvDecimals = 9;
+
+// Records per block; input and output buffers are bounded by this size
+const size_t kLogBlockSize = 1024;
+
+// Reads records from a memory-mapped log. Pages are released once they have
+// been read, so resident memory stays bounded for logs of any size.
+class LogReader {
+ public:
+  LogReader();
+  LogReader(const LogReader&) = delete;
+  auto operator=(const LogReader&) -> LogReader& = delete;
+  ~LogReader();
+  auto Open(const char* path, const LogFormat format) -> bool;
+  // Size of the log in bytes
+  auto GetSize() const -> size_t;
+  // Reads up to capacity records into the arrays and returns how many were
+  // read; zero at the end of the log or after a malformed record
+  auto Read(const size_t capacity, double* temperature, double* humidity,
+            double* pressure, double* co2_mole_fraction) -> size_t;
+  auto HasError() const -> bool;
+  // Line of the malformed CSV record
+  auto GetErrorLine() const -> size_t;
+
+ private:
+  auto ReadCsv(const size_t capacity, double* temperature, double* humidity,
+               double* pressure, double* co2_mole_fraction) -> size_t;
+  auto ReadBinary(const size_t capacity, double* temperature,
+                  double* humidity, double* pressure,
+                  double* co2_mole_fraction) -> size_t;
+  auto Release() -> void;
+  auto Reset() -> void;
+
+  LogFormat format_;
+  const char* mapping_;
+  size_t size_;
+  size_t position_;
+  size_t released_;
+  size_t line_;
+  bool error_;
+};
+
+// Buffers speed of sound values and writes them as CSV lines with
+// kLogCsvDecimals decimal places or as packed native-endian doubles
+class LogWriter {
+ public:
+  LogWriter(FILE* file, const LogFormat format);
+  LogWriter(const LogWriter&) = delete;
+  auto operator=(const LogWriter&) -> LogWriter& = delete;
+  auto Write(const double* speed_of_sound, const size_t count) -> bool;
+  auto Flush() -> bool;
+  // Bytes the file accepted so far
+  auto GetBytesWritten() const -> size_t;
+
+ private:
+  static const size_t kBufferSize = 1 << 16;
+
+  FILE* file_;
+  LogFormat format_;
+  size_t used_;
+  size_t bytes_written_;
+  char buffer_[kBufferSize];
+};
+
+class LogStatistics {
+ public:
+  LogStatistics();
+  size_t records_;
+  // Records outside the valid environment range, written as NaN
+  size_t invalid_records_;
+  size_t bytes_read_;
+  size_t bytes_written_;
+};
+
+// Streams every record of reader through the engine into writer, one block
+// at a time. tolerance (m/s) applies to LogEngine::kApproximate only.
+auto ProcessLog(LogReader* reader, LogWriter* writer, const LogEngine engine,
+                const double tolerance, LogStatistics* statistics) -> bool;
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_LOG_H_
@@ -0,0 +1,359 @@
+#include "speed-of-sound-lookup-table.h"
+
+#include <fcntl.h>
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "speed-of-sound-theory.h"
+#include "speed-of-sound.h"
+
+namespace speedofsound {
+
+namespace {
+
+const char kFileMagic[8] = {'S', 'O', 'S', 'L', 'U', 'T', '\0', '\0'};
+const uint32_t kByteOrderMark = 0x01020304;
+
+class FileHeader {
+ public:
+  char magic_[8];
+  uint32_t version_;
+  uint32_t byte_order_;
+  uint64_t points_[4];
+  double min_[4];
+  double max_[4];
+  double max_interpolation_error_;
+};
+
+auto GridValue(const double min, const double max, const size_t points,
+               const double index) -> double {
+  return min + (max - min) * index / static_cast<double>(points - 1);
+}
+
+auto Lerp(const double a, const double b, const double fraction) -> double {
+  return a + (b - a) * fraction;
+}
+
+// Each axis of a mapped table must lie within the valid range of the model,
+// which also rules out NaN, infinities and empty or reversed axes
+auto ValidateAxes(const FileHeader& header) -> bool {
+  const double valid_min[4] = {theory::kMinTemperature, theory::kMinHumidity,
+                               theory::kMinPressure,
+                               theory::kMinCO2MoleFraction};
+  const double valid_max[4] = {theory::kMaxTemperature, theory::kMaxHumidity,
+                               theory::kMaxPressure,
+                               theory::kMaxCO2MoleFraction};
+  for (size_t axis = 0; axis < 4; ++axis) {
+    const auto min = header.min_[axis];
+    const auto max = header.max_[axis];
+    if (!(isfinite(min) && isfinite(max) && min < max &&
+          min >= valid_min[axis] && max <= valid_max[axis])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Bytes of the values of a table with the points of header, false if a
+// point count does not fit the cell indices or the size overflows
+auto ValuesSize(const FileHeader& header, size_t* size) -> bool {
+  size_t count = 1;
+  for (size_t axis = 0; axis < 4; ++axis) {
+    const auto points = header.points_[axis];
+    if (points < 2 || points > static_cast<uint64_t>(INT_MAX) ||
+        count > SIZE_MAX / sizeof(double) / points) {
+      return false;
+    }
+    count *= static_cast<size_t>(points);
+  }
+  *size = count * sizeof(double);
+  return true;
+}
+
+}  // namespace
+
+LookupTableResolution::LookupTableResolution()
+    : temperature_points_(121),
+      humidity_points_(11),
+      pressure_points_(11),
+      co2_mole_fraction_points_(3) {}
+
+LookupTableResolution::LookupTableResolution(
+    const size_t temperature_points, const size_t humidity_points,
+    const size_t pressure_points, const size_t co2_mole_fraction_points)
+    : temperature_points_(temperature_points),
+      humidity_points_(humidity_points),
+      pressure_points_(pressure_points),
+      co2_mole_fraction_points_(co2_mole_fraction_points) {}
+
+auto LookupTableResolution::Points() const -> size_t {
+  return temperature_points_ * humidity_points_ * pressure_points_ *
+         co2_mole_fraction_points_;
+}
+
+auto LookupTableResolution::Validate() const -> bool {
+  return temperature_points_ >= 2 && humidity_points_ >= 2 &&
+         pressure_points_ >= 2 && co2_mole_fraction_points_ >= 2;
+}
+
+LookupTable::LookupTable()
+    : max_interpolation_error_(0.0),
+      origin_(),
+      scale_(),
+      max_position_(),
+      last_cell_(),
+      stride_(),
+      values_(nullptr),
+      mapping_(nullptr),
+      mapping_size_(0) {}
+
+LookupTable::~LookupTable() { Reset(); }
+
+auto LookupTable::Build(const LookupTableResolution& resolution) -> bool {
+  if (!resolution.Validate()) return false;
+  Reset();
+  resolution_ = resolution;
+  min_environment_.temperature_ = theory::kMinTemperature;
+  min_environment_.humidity_ = theory::kMinHumidity;
+  min_environment_.pressure_ = theory::kMinPressure;
+  min_environment_.co2_mole_fraction_ = theory::kMinCO2MoleFraction;
+  max_environment_.temperature_ = theory::kMaxTemperature;
+  max_environment_.humidity_ = theory::kMaxHumidity;
+  max_environment_.pressure_ = theory::kMaxPressure;
+  max_environment_.co2_mole_fraction_ = theory::kMaxCO2MoleFraction;
+  UpdateAxes();
+  owned_values_.resize(resolution_.Points());
+  const SpeedOfSound speed_of_sound;
+  Environment environment;
+  for (size_t t = 0; t < resolution_.temperature_points_; ++t) {
+    environment.temperature_ =
+        GridValue(min_environment_.temperature_, max_environment_.temperature_,
+                  resolution_.temperature_points_, t);
+    for (size_t h = 0; h < resolution_.humidity_points_; ++h) {
+      environment.humidity_ =
+          GridValue(min_environment_.humidity_, max_environment_.humidity_,
+                    resolution_.humidity_points_, h);
+      for (size_t p = 0; p < resolution_.pressure_points_; ++p) {
+        environment.pressure_ =
+            GridValue(min_environment_.pressure_, max_environment_.pressure_,
+                      resolution_.pressure_points_, p);
+        for (size_t xc = 0; xc < resolution_.co2_mole_fraction_points_; ++xc) {
+          environment.co2_mole_fraction_ =
+              GridValue(min_environment_.co2_mole_fraction_,
+                        max_environment_.co2_mole_fraction_,
+                        resolution_.co2_mole_fraction_points_, xc);
+          owned_values_[Index(t, h, p, xc)] =
+              speed_of_sound.QuickCompute(environment);
+        }
+      }
+    }
+  }
+  values_ = owned_values_.data();
+  max_interpolation_error_ = ComputeMaxInterpolationError();
+  return true;
+}
+
+auto LookupTable::Save(const char* path) const -> bool {
+  if (!IsValid()) return false;
+  FileHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic_, kFileMagic, sizeof(kFileMagic));
+  header.version_ = kFileVersion;
+  header.byte_order_ = kByteOrderMark;
+  header.points_[0] = resolution_.temperature_points_;
+  header.points_[1] = resolution_.humidity_points_;
+  header.points_[2] = resolution_.pressure_points_;
+  header.points_[3] = resolution_.co2_mole_fraction_points_;
+  header.min_[0] = min_environment_.temperature_;
+  header.min_[1] = min_environment_.humidity_;
+  header.min_[2] = min_environment_.pressure_;
+  header.min_[3] = min_environment_.co2_mole_fraction_;
+  header.max_[0] = max_environment_.temperature_;
+  header.max_[1] = max_environment_.humidity_;
+  header.max_[2] = max_environment_.pressure_;
+  header.max_[3] = max_environment_.co2_mole_fraction_;
+  header.max_interpolation_error_ = max_interpolation_error_;
+  const auto count = resolution_.Points();
+  auto file = fopen(path, "wb");
+  if (file == nullptr) return false;
+  auto ok = fwrite(&header, sizeof(header), 1, file) == 1;
+  ok = ok && fwrite(values_, sizeof(double), count, file) == count;
+  ok = fclose(file) == 0 && ok;
+  return ok;
+}
+
+auto LookupTable::Map(const char* path) -> bool {
+  Reset();
+  const auto fd = open(path, O_RDONLY);
+  if (fd < 0) return false;
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 ||
+      static_cast<size_t>(file_stat.st_size) < sizeof(FileHeader)) {
+    close(fd);
+    return false;
+  }
+  const auto size = static_cast<size_t>(file_stat.st_size);
+  auto mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) return false;
+  FileHeader header;
+  memcpy(&header, mapping, sizeof(header));
+  size_t values_size = 0;
+  if (memcmp(header.magic_, kFileMagic, sizeof(kFileMagic)) != 0 ||
+      header.version_ != kFileVersion ||
+      header.byte_order_ != kByteOrderMark ||
+      !ValuesSize(header, &values_size) ||
+      size - sizeof(header) != values_size || !ValidateAxes(header)) {
+    munmap(mapping, size);
+    return false;
+  }
+  const LookupTableResolution resolution(
+      static_cast<size_t>(header.points_[0]),
+      static_cast<size_t>(header.points_[1]),
+      static_cast<size_t>(header.points_[2]),
+      static_cast<size_t>(header.points_[3]));
+  resolution_ = resolution;
+  min_environment_.temperature_ = header.min_[0];
+  min_environment_.humidity_ = header.min_[1];
+  min_environment_.pressure_ = header.min_[2];
+  min_environment_.co2_mole_fraction_ = header.min_[3];
+  max_environment_.temperature_ = header.max_[0];
+  max_environment_.humidity_ = header.max_[1];
+  max_environment_.pressure_ = header.max_[2];
+  max_environment_.co2_mole_fraction_ = header.max_[3];
+  max_interpolation_error_ = header.max_interpolation_error_;
+  UpdateAxes();
+  mapping_ = mapping;
+  mapping_size_ = size;
+  values_ = reinterpret_cast<const double*>(static_cast<const char*>(mapping) +
+                                            sizeof(header));
+  return true;
+}
+
+auto LookupTable::IsValid() const -> bool { return values_ != nullptr; }
+
+auto LookupTable::GetResolution() const -> LookupTableResolution {
+  return resolution_;
+}
+
+auto LookupTable::GetMaxInterpolationError() const -> double {
+  return max_interpolation_error_;
+}
+
+auto LookupTable::Interpolate(const Environment& ambient_conditions) const
+    -> double {
+  if (!IsValid()) return NAN;
+  const double x[4] = {ambient_conditions.temperature_,
+                       ambient_conditions.humidity_,
+                       ambient_conditions.pressure_,
+                       ambient_conditions.co2_mole_fraction_};
+  size_t offset = 0;
+  double fraction[4];
+  for (size_t axis = 0; axis < 4; ++axis) {
+    auto u = (x[axis] - origin_[axis]) * scale_[axis];
+    // NaN would fail both comparisons below and index out of the table
+    if (isnan(u)) return NAN;
+    u = u < 0.0 ? 0.0 : u > max_position_[axis] ? max_position_[axis] : u;
+    auto index = static_cast<int>(u);
+    index = index > last_cell_[axis] ? last_cell_[axis] : index;
+    fraction[axis] = u - index;
+    offset += index * stride_[axis];
+  }
+  // Collapse the cell one axis at a time, innermost (contiguous) axis first
+  double corners[8];
+  for (size_t corner = 0; corner < 8; ++corner) {
+    const auto base = values_ + offset + (corner >> 2) * stride_[0] +
+                      ((corner >> 1) & 1) * stride_[1] +
+                      (corner & 1) * stride_[2];
+    corners[corner] = Lerp(base[0], base[1], fraction[3]);
+  }
+  for (size_t corner = 0; corner < 4; ++corner) {
+    corners[corner] =
+        Lerp(corners[2 * corner], corners[2 * corner + 1], fraction[2]);
+  }
+  for (size_t corner = 0; corner < 2; ++corner) {
+    corners[corner] =
+        Lerp(corners[2 * corner], corners[2 * corner + 1], fraction[1]);
+  }
+  return Lerp(corners[0], corners[1], fraction[0]);
+}
+
+auto LookupTable::UpdateAxes() -> void {
+  const double min[4] = {
+      min_environment_.temperature_, min_environment_.humidity_,
+      min_environment_.pressure_, min_environment_.co2_mole_fraction_};
+  const double max[4] = {
+      max_environment_.temperature_, max_environment_.humidity_,
+      max_environment_.pressure_, max_environment_.co2_mole_fraction_};
+  const size_t points[4] = {
+      resolution_.temperature_points_, resolution_.humidity_points_,
+      resolution_.pressure_points_, resolution_.co2_mole_fraction_points_};
+  size_t stride = 1;
+  for (size_t axis = 4; axis-- > 0;) {
+    origin_[axis] = min[axis];
+    scale_[axis] =
+        static_cast<double>(points[axis] - 1) / (max[axis] - min[axis]);
+    max_position_[axis] = static_cast<double>(points[axis] - 1);
+    last_cell_[axis] = static_cast<int>(points[axis] - 2);
+    stride_[axis] = stride;
+    stride *= points[axis];
+  }
+}
+
+auto LookupTable::Reset() -> void {
+  if (mapping_ != nullptr) munmap(mapping_, mapping_size_);
+  mapping_ = nullptr;
+  mapping_size_ = 0;
+  owned_values_.clear();
+  owned_values_.shrink_to_fit();
+  values_ = nullptr;
+  max_interpolation_error_ = 0.0;
+}
+
+// Interpolation error is largest midway between grid points along the axes
+// with curvature but may peak on a grid line along the others, so every
+// combination of grid and midpoint coordinates is sampled.
+auto LookupTable::ComputeMaxInterpolationError() const -> double {
+  const SpeedOfSound speed_of_sound;
+  Environment environment;
+  auto max_error = 0.0;
+  for (size_t t = 0; t < 2 * resolution_.temperature_points_ - 1; ++t) {
+    environment.temperature_ =
+        GridValue(min_environment_.temperature_, max_environment_.temperature_,
+                  resolution_.temperature_points_, t / 2.0);
+    for (size_t h = 0; h < 2 * resolution_.humidity_points_ - 1; ++h) {
+      environment.humidity_ =
+          GridValue(min_environment_.humidity_, max_environment_.humidity_,
+                    resolution_.humidity_points_, h / 2.0);
+      for (size_t p = 0; p < 2 * resolution_.pressure_points_ - 1; ++p) {
+        environment.pressure_ =
+            GridValue(min_environment_.pressure_, max_environment_.pressure_,
+                      resolution_.pressure_points_, p / 2.0);
+        for (size_t xc = 0; xc < 2 * resolution_.co2_mole_fraction_points_ - 1;
+             ++xc) {
+          environment.co2_mole_fraction_ =
+              GridValue(min_environment_.co2_mole_fraction_,
+                        max_environment_.co2_mole_fraction_,
+                        resolution_.co2_mole_fraction_points_, xc / 2.0);
+          auto error = Interpolate(environment) -
+                       speed_of_sound.QuickCompute(environment);
+          error = error < 0.0 ? -error : error;
+          max_error = error > max_error ? error : max_error;
+        }
+      }
+    }
+  }
+  return max_error;
+}
+
+auto LookupTable::Index(const size_t t, const size_t h, const size_t p,
+                        const size_t xc) const -> size_t {
+  return t * stride_[0] + h * stride_[1] + p * stride_[2] + xc * stride_[3];
+}
+
+}  // namespace speedofsound
@@ -0,0 +1,74 @@
+#ifndef SPEED_OF_SOUND_LOOKUP_TABLE_H_
+#define SPEED_OF_SOUND_LOOKUP_TABLE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "environment.h"
+
+namespace speedofsound {
+
+class LookupTableResolution {
+ public:
+  LookupTableResolution();
+  LookupTableResolution(const size_t temperature_points,
+                        const size_t humidity_points,
+                        const size_t pressure_points,
+                        const size_t co2_mole_fraction_points);
+  auto Points() const -> size_t;
+  auto Validate() const -> bool;
+  size_t temperature_points_;
+  size_t humidity_points_;
+  size_t pressure_points_;
+  size_t co2_mole_fraction_points_;
+};
+
+// Grid of QuickCompute results over the valid environment range, answered by
+// multilinear interpolation. Tables can be saved and memory-mapped so that
+// several processes share one copy.
+class LookupTable {
+ public:
+  static const uint32_t kFileVersion = 1;
+
+  LookupTable();
+  LookupTable(const LookupTable&) = delete;
+  auto operator=(const LookupTable&) -> LookupTable& = delete;
+  ~LookupTable();
+  auto Build(const LookupTableResolution& resolution) -> bool;
+  auto Save(const char* path) const -> bool;
+  auto Map(const char* path) -> bool;
+  auto IsValid() const -> bool;
+  auto GetResolution() const -> LookupTableResolution;
+  // Largest absolute difference from QuickCompute (m/s), sampled at the grid
+  // midpoints when the table was built
+  auto GetMaxInterpolationError() const -> double;
+  // NaN if the table is not valid or an input is NaN
+  auto Interpolate(const Environment& ambient_conditions) const -> double;
+
+ private:
+  auto UpdateAxes() -> void;
+  auto Reset() -> void;
+  auto ComputeMaxInterpolationError() const -> double;
+  auto Index(const size_t t, const size_t h, const size_t p,
+             const size_t xc) const -> size_t;
+
+  LookupTableResolution resolution_;
+  Environment min_environment_;
+  Environment max_environment_;
+  double max_interpolation_error_;
+  double origin_[4];
+  double scale_[4];
+  double max_position_[4];
+  int last_cell_[4];
+  size_t stride_[4];
+  std::vector<double> owned_values_;
+  const double* values_;
+  void* mapping_;
+  size_t mapping_size_;
+};
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_LOOKUP_TABLE_H_
@@ -0,0 +1,254 @@
+#include "speed-of-sound-memo.h"
+
+#include <math.h>
+#include <string.h>
+
+namespace speedofsound {
+
+namespace {
+
+const double kMaxSteps = 2147483647.0;
+const double kRoundingShift = 6755399441055744.0;
+const uint64_t kByteOnes = 0x0101010101010101ULL;
+
+auto Tag(const uint64_t hash) -> uint64_t { return hash >> 57 | 0x80; }
+
+auto RoundUpToPowerOfTwo(const size_t value) -> size_t {
+  size_t power = 1;
+  while (power < value) power *= 2;
+  return power;
+}
+
+auto IsStep(const double step) -> bool {
+  return step > 0.0 && isfinite(step);
+}
+
+}  // namespace
+
+const size_t MemoizedSpeedOfSound::kWays;
+
+Quantization::Quantization()
+    : temperature_step_(0.01),
+      humidity_step_(0.001),
+      pressure_step_(1.0),
+      co2_mole_fraction_step_(1.0e-6) {}
+
+Quantization::Quantization(const double temperature_step,
+                           const double humidity_step,
+                           const double pressure_step,
+                           const double co2_mole_fraction_step)
+    : temperature_step_(temperature_step),
+      humidity_step_(humidity_step),
+      pressure_step_(pressure_step),
+      co2_mole_fraction_step_(co2_mole_fraction_step) {}
+
+auto Quantization::Validate() const -> bool {
+  return IsStep(temperature_step_) && IsStep(humidity_step_) &&
+         IsStep(pressure_step_) && IsStep(co2_mole_fraction_step_);
+}
+
+MemoStatistics::MemoStatistics() : hits_(0), misses_(0), evictions_(0) {}
+
+auto MemoStatistics::HitRate() const -> double {
+  const auto lookups = hits_ + misses_;
+  return lookups > 0 ? static_cast<double>(hits_) / lookups : 0.0;
+}
+
+MemoizedSpeedOfSound::MemoizedSpeedOfSound(const size_t capacity,
+                                           const Quantization& quantization)
+    : quantization_(quantization),
+      inverse_step_{1.0 / quantization.temperature_step_,
+                    1.0 / quantization.humidity_step_,
+                    1.0 / quantization.pressure_step_,
+                    1.0 / quantization.co2_mole_fraction_step_},
+      sets_(RoundUpToPowerOfTwo((capacity + kWays - 1) / kWays)),
+      set_mask_(sets_.size() - 1) {
+  Clear();
+}
+
+auto MemoizedSpeedOfSound::IsValid() const -> bool {
+  return quantization_.Validate();
+}
+
+auto MemoizedSpeedOfSound::GetCapacity() const -> size_t {
+  return sets_.size() * kWays;
+}
+
+auto MemoizedSpeedOfSound::GetStatistics() const -> MemoStatistics {
+  return statistics_;
+}
+
+auto MemoizedSpeedOfSound::ResetStatistics() -> void {
+  statistics_ = MemoStatistics();
+}
+
+auto MemoizedSpeedOfSound::Clear() -> void {
+  for (auto& set : sets_) {
+    set.tags_ = 0;
+    set.referenced_ = 0;
+    set.hand_ = 0;
+  }
+}
+
+auto MemoizedSpeedOfSound::QuickCompute(const Environment& ambient_conitions)
+    -> double {
+  Key key;
+  if (!Quantize(ambient_conitions, &key)) {
+    ++statistics_.misses_;
+    return speed_of_sound_.QuickCompute(ambient_conitions);
+  }
+  return Lookup(key, Hash(key));
+}
+
+auto MemoizedSpeedOfSound::Quantize(const Environment& ambient_conitions,
+                                    Key* key) const -> bool {
+  const double x[4] = {ambient_conitions.temperature_,
+                       ambient_conitions.humidity_,
+                       ambient_conitions.pressure_,
+                       ambient_conitions.co2_mole_fraction_};
+  auto in_range = true;
+  for (size_t axis = 0; axis < 4; ++axis) {
+    const auto position = x[axis] * inverse_step_[axis];
+    // Also false for NaN
+    in_range &= fabs(position) < kMaxSteps;
+    // Adding 1.5 * 2^52 rounds to the nearest integer and leaves it in the
+    // low bits of the mantissa, without a conversion instruction
+    const auto shifted = position + kRoundingShift;
+    uint64_t bits;
+    memcpy(&bits, &shifted, sizeof(bits));
+    key->steps_[axis] = static_cast<int32_t>(static_cast<uint32_t>(bits));
+  }
+  return in_range;
+}
+
+inline auto MemoizedSpeedOfSound::Lookup(const Key& key,
+                                          const uint64_t hash) -> double {
+  auto& set = sets_[hash & set_mask_];
+  // Bytes of tags_ equal to the tag, plus possibly bytes above one that is;
+  // the keys rule out the false matches
+  const auto differences = set.tags_ ^ (Tag(hash) * kByteOnes);
+  auto matches = (differences - kByteOnes) & ~differences & (kByteOnes << 7);
+  while (matches != 0) {
+    const auto way = __builtin_ctzll(matches) / 8;
+    const auto& steps = set.keys_[way].steps_;
+    if (steps[0] == key.steps_[0] && steps[1] == key.steps_[1] &&
+        steps[2] == key.steps_[2] && steps[3] == key.steps_[3]) {
+      set.referenced_ |= 1 << way;
+      ++statistics_.hits_;
+      return set.values_[way];
+    }
+    matches &= matches - 1;
+  }
+  return Insert(key, hash, &set);
+}
+
+// Out of line, so that the hits inline into QuickCompute
+__attribute__((noinline)) auto MemoizedSpeedOfSound::Insert(
+    const Key& key, const uint64_t hash, Set* set) -> double {
+  ++statistics_.misses_;
+  // An empty way if there is one, otherwise the first way at or after the
+  // hand that has not been referenced since the hand last passed it
+  size_t way = 0;
+  while (way < kWays && (set->tags_ >> 8 * way & 0xff) != 0) ++way;
+  if (way == kWays) {
+    while (set->referenced_ >> set->hand_ & 1) {
+      set->referenced_ &= ~(1 << set->hand_);
+      set->hand_ = (set->hand_ + 1) % kWays;
+    }
+    way = set->hand_;
+    set->hand_ = (set->hand_ + 1) % kWays;
+    ++statistics_.evictions_;
+  }
+  const Environment environment(
+      key.steps_[0] * quantization_.temperature_step_,
+      key.steps_[1] * quantization_.humidity_step_,
+      key.steps_[2] * quantization_.pressure_step_,
+      key.steps_[3] * quantization_.co2_mole_fraction_step_);
+  set->keys_[way] = key;
+  set->values_[way] = speed_of_sound_.QuickCompute(environment);
+  set->tags_ &= ~(uint64_t(0xff) << 8 * way);
+  set->tags_ |= Tag(hash) << 8 * way;
+  set->referenced_ &= ~(1 << way);
+  return set->values_[way];
+}
+
+// Independent multiplies folded with a shift, so that neighbouring readings
+// spread over the sets and, through the high bits, over the shards
+inline auto MemoizedSpeedOfSound::Hash(const Key& key) -> uint64_t {
+  auto hash = static_cast<uint32_t>(key.steps_[0]) * 0x9e3779b97f4a7c15ULL;
+  hash ^= static_cast<uint32_t>(key.steps_[1]) * 0xc2b2ae3d27d4eb4fULL;
+  hash ^= static_cast<uint32_t>(key.steps_[2]) * 0x165667b19e3779f9ULL;
+  hash ^= static_cast<uint32_t>(key.steps_[3]) * 0xd6e8feb86659fd93ULL;
+  return hash ^ hash >> 29;
+}
+
+ShardedMemoizedSpeedOfSound::Shard::Shard(const size_t capacity,
+                                          const Quantization& quantization)
+    : memo_(capacity, quantization) {}
+
+ShardedMemoizedSpeedOfSound::ShardedMemoizedSpeedOfSound(
+    const size_t shard_count, const size_t capacity,
+    const Quantization& quantization)
+    : shard_mask_(RoundUpToPowerOfTwo(shard_count) - 1) {
+  const auto shards = shard_mask_ + 1;
+  for (size_t i = 0; i < shards; ++i) {
+    shards_.emplace_back(
+        new Shard((capacity + shards - 1) / shards, quantization));
+  }
+}
+
+auto ShardedMemoizedSpeedOfSound::IsValid() const -> bool {
+  return shards_[0]->memo_.IsValid();
+}
+
+auto ShardedMemoizedSpeedOfSound::GetShardCount() const -> size_t {
+  return shards_.size();
+}
+
+auto ShardedMemoizedSpeedOfSound::GetCapacity() const -> size_t {
+  return shards_.size() * shards_[0]->memo_.GetCapacity();
+}
+
+auto ShardedMemoizedSpeedOfSound::GetStatistics() const -> MemoStatistics {
+  MemoStatistics total;
+  for (const auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard->mutex_);
+    const auto statistics = shard->memo_.GetStatistics();
+    total.hits_ += statistics.hits_;
+    total.misses_ += statistics.misses_;
+    total.evictions_ += statistics.evictions_;
+  }
+  return total;
+}
+
+auto ShardedMemoizedSpeedOfSound::ResetStatistics() -> void {
+  for (const auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard->mutex_);
+    shard->memo_.ResetStatistics();
+  }
+}
+
+auto ShardedMemoizedSpeedOfSound::Clear() -> void {
+  for (const auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard->mutex_);
+    shard->memo_.Clear();
+  }
+}
+
+// Quantizes and hashes outside the lock; the high bits of the hash pick the
+// shard and the low bits the set within it
+auto ShardedMemoizedSpeedOfSound::QuickCompute(
+    const Environment& ambient_conitions) -> double {
+  auto& first = *shards_[0];
+  MemoizedSpeedOfSound::Key key;
+  if (!first.memo_.Quantize(ambient_conitions, &key)) {
+    std::lock_guard<std::mutex> lock(first.mutex_);
+    return first.memo_.QuickCompute(ambient_conitions);
+  }
+  const auto hash = MemoizedSpeedOfSound::Hash(key);
+  auto& shard = *shards_[(hash >> 32) & shard_mask_];
+  std::lock_guard<std::mutex> lock(shard.mutex_);
+  return shard.memo_.Lookup(key, hash);
+}
+
+}  // namespace speedofsound
@@ -0,0 +1,130 @@
+#ifndef SPEED_OF_SOUND_MEMO_H_
+#define SPEED_OF_SOUND_MEMO_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "environment.h"
+#include "speed-of-sound.h"
+
+namespace speedofsound {
+
+// Steps that environments are rounded to before the cache looks them up,
+// e.g. the resolution of the sensors. Defaults to 0.01 °C, 0.001, 1 Pa and
+// 1e-6.
+class Quantization {
+ public:
+  Quantization();
+  Quantization(const double temperature_step, const double humidity_step,
+               const double pressure_step, const double co2_mole_fraction_step);
+  auto Validate() const -> bool;
+  double temperature_step_;
+  double humidity_step_;
+  double pressure_step_;
+  double co2_mole_fraction_step_;
+};
+
+class MemoStatistics {
+ public:
+  MemoStatistics();
+  // Zero before the first lookup
+  auto HitRate() const -> double;
+  uint64_t hits_;
+  uint64_t misses_;
+  uint64_t evictions_;
+};
+
+// QuickCompute memoized on the quantized environment, so that repeated
+// readings skip the evaluation. Results are QuickCompute at the nearest point
+// of the quantization grid, whether or not they hit. The cache holds a fixed
+// number of entries in sets of kWays, each set evicting with the CLOCK
+// (second chance) policy. Environments too large to quantize are computed
+// without caching and count as misses. Not thread-safe; see
+// ShardedMemoizedSpeedOfSound.
+class MemoizedSpeedOfSound {
+ public:
+  static const size_t kWays = 8;
+
+  // Capacity (entries) is rounded up to a power of two sets of kWays.
+  // False from IsValid if the quantization is not.
+  MemoizedSpeedOfSound(const size_t capacity,
+                       const Quantization& quantization = Quantization());
+  auto IsValid() const -> bool;
+  auto GetCapacity() const -> size_t;
+  auto GetStatistics() const -> MemoStatistics;
+  auto ResetStatistics() -> void;
+  auto Clear() -> void;
+  auto QuickCompute(const Environment& ambient_conitions) -> double;
+
+ private:
+  friend class ShardedMemoizedSpeedOfSound;
+
+  class Key {
+   public:
+    int32_t steps_[4];
+  };
+  // Byte i of tags_ is zero for an empty way i and otherwise the top bits of
+  // the hash of its key with the high bit set, so that a lookup compares all
+  // tags at once and then at most a few keys
+  class Set {
+   public:
+    uint64_t tags_;
+    uint8_t referenced_;
+    uint8_t hand_;
+    Key keys_[kWays];
+    double values_[kWays];
+  };
+
+  // False if a step count does not fit a Key
+  auto Quantize(const Environment& ambient_conitions, Key* key) const -> bool;
+  auto Lookup(const Key& key, const uint64_t hash) -> double;
+  auto Insert(const Key& key, const uint64_t hash, Set* set) -> double;
+  static auto Hash(const Key& key) -> uint64_t;
+
+  SpeedOfSound speed_of_sound_;
+  Quantization quantization_;
+  double inverse_step_[4];
+  std::vector<Set> sets_;
+  size_t set_mask_;
+  MemoStatistics statistics_;
+};
+
+// MemoizedSpeedOfSound split into shards with a mutex each, so that threads
+// looking up different environments rarely wait for each other
+class ShardedMemoizedSpeedOfSound {
+ public:
+  // Shard count is rounded up to a power of two and capacity split evenly
+  ShardedMemoizedSpeedOfSound(
+      const size_t shard_count, const size_t capacity,
+      const Quantization& quantization = Quantization());
+  auto IsValid() const -> bool;
+  auto GetShardCount() const -> size_t;
+  auto GetCapacity() const -> size_t;
+  // Totals over the shards
+  auto GetStatistics() const -> MemoStatistics;
+  auto ResetStatistics() -> void;
+  auto Clear() -> void;
+  // Safe from any number of threads
+  auto QuickCompute(const Environment& ambient_conitions) -> double;
+
+ private:
+  // Padded to a cache line so that shards do not share one
+  class Shard {
+   public:
+    Shard(const size_t capacity, const Quantization& quantization);
+    std::mutex mutex_;
+    MemoizedSpeedOfSound memo_;
+    char padding_[64];
+  };
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+  size_t shard_mask_;
+};
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_MEMO_H_
@@ -0,0 +1,49 @@
+#include "speed-of-sound-parallel.h"
+
+#include <math.h>
+
+#include <atomic>
+
+namespace speedofsound {
+
+auto ParallelQuickComputeBatch(ThreadPool* pool,
+                               const EnvironmentArrays& ambient_conditions,
+                               const size_t count, double* speed_of_sound,
+                               const BatchKernel kernel) -> bool {
+  if (!BatchKernelSupported(kernel)) return false;
+  const auto selected_kernel =
+      kernel == BatchKernel::kAuto ? BestBatchKernel() : kernel;
+  pool->ParallelFor(count, kParallelGrain, [&](size_t begin, size_t end) {
+    const EnvironmentArrays range(
+        ambient_conditions.temperature_ + begin,
+        ambient_conditions.humidity_ + begin,
+        ambient_conditions.pressure_ + begin,
+        ambient_conditions.co2_mole_fraction_ + begin);
+    QuickComputeBatch(range, end - begin, speed_of_sound + begin,
+                      selected_kernel);
+  });
+  return true;
+}
+
+auto ParallelTravelTime(ThreadPool* pool,
+                        const TravelTimeIntegrator& integrator,
+                        const PathSample* samples, const size_t* offsets,
+                        const size_t path_count, double* travel_time)
+    -> bool {
+  std::atomic<bool> ok(true);
+  pool->ParallelFor(
+      path_count, kParallelPathGrain, [&](size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          if (offsets[i + 1] < offsets[i] ||
+              !integrator.Integrate(samples + offsets[i],
+                                    offsets[i + 1] - offsets[i],
+                                    &travel_time[i])) {
+            travel_time[i] = NAN;
+            ok = false;
+          }
+        }
+      });
+  return ok;
+}
+
+}  // namespace speedofsound
@@ -0,0 +1,38 @@
+#ifndef SPEED_OF_SOUND_PARALLEL_H_
+#define SPEED_OF_SOUND_PARALLEL_H_
+
+#include <stddef.h>
+
+#include "speed-of-sound-batch.h"
+#include "speed-of-sound-path.h"
+#include "thread-pool.h"
+
+namespace speedofsound {
+
+// Environments per task, large enough to amortize claiming work and small
+// enough for the inputs of a task to stay in the L2 cache
+const size_t kParallelGrain = 4096;
+
+// Paths per task
+const size_t kParallelPathGrain = 16;
+
+// QuickComputeBatch split over the threads of pool. Every environment is
+// evaluated by the same kernel, so results are bit-identical to
+// QuickComputeBatch.
+auto ParallelQuickComputeBatch(ThreadPool* pool,
+                               const EnvironmentArrays& ambient_conditions,
+                               const size_t count, double* speed_of_sound,
+                               const BatchKernel kernel = BatchKernel::kAuto)
+    -> bool;
+
+// Travel times of path_count paths stored back to back: path i holds
+// samples[offsets[i]] up to samples[offsets[i + 1]]. Paths that cannot be
+// integrated get NaN and make the result false.
+auto ParallelTravelTime(ThreadPool* pool,
+                        const TravelTimeIntegrator& integrator,
+                        const PathSample* samples, const size_t* offsets,
+                        const size_t path_count, double* travel_time) -> bool;
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_PARALLEL_H_
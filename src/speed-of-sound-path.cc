@@ -0,0 +1,130 @@
+#include "speed-of-sound-path.h"
+
+#include <math.h>
+
+namespace speedofsound {
+
+namespace {
+
+// Largest deviation from the chord of a cubic with the given slopes at the
+// ends of [0, 1], relative to the slope of the chord: max u (1 - u)^2 = 4/27
+const double kCubicDeviation = 4.0 / 27.0;
+
+// Error ratio of the corrected trapezoid rule between a panel and its halves
+const double kRichardsonFactor = 15.0;
+
+// The integral of 1 / c over [0, 1] by the trapezoid rule corrected with the
+// derivatives of 1 / c at the ends, exact when 1 / c is cubic. slope is the
+// derivative of c over the panel.
+auto CorrectedTrapezoid(const double c0, const double c1, const double slope0,
+                        const double slope1) -> double {
+  const auto f0 = 1.0 / c0;
+  const auto f1 = 1.0 / c1;
+  return 0.5 * (f0 + f1) + (slope1 * f1 * f1 - slope0 * f0 * f0) / 12.0;
+}
+
+auto Lerp(const Environment& a, const Environment& b, const double fraction)
+    -> Environment {
+  return Environment(
+      a.temperature_ + (b.temperature_ - a.temperature_) * fraction,
+      a.humidity_ + (b.humidity_ - a.humidity_) * fraction,
+      a.pressure_ + (b.pressure_ - a.pressure_) * fraction,
+      a.co2_mole_fraction_ +
+          (b.co2_mole_fraction_ - a.co2_mole_fraction_) * fraction);
+}
+
+// Directional derivative of c along the change from a to b
+auto Slope(const EnvironmentRate& rate, const Environment& a,
+           const Environment& b) -> double {
+  return rate.temperature_rate_ * (b.temperature_ - a.temperature_) +
+         rate.humidity_rate_ * (b.humidity_ - a.humidity_) +
+         rate.pressure_rate_ * (b.pressure_ - a.pressure_) +
+         rate.co2_mole_fraction_rate_ *
+             (b.co2_mole_fraction_ - a.co2_mole_fraction_);
+}
+
+}  // namespace
+
+TravelTimeIntegrator::TravelTimeIntegrator(const double tolerance)
+    : tolerance_(tolerance) {}
+
+auto TravelTimeIntegrator::GetTolerance() const -> double {
+  return tolerance_;
+}
+
+auto TravelTimeIntegrator::Integrate(const PathSample* samples,
+                                     const size_t count,
+                                     double* travel_time) const -> bool {
+  // Also false for a NaN tolerance, which no panel could meet
+  if (count < 2 || !(tolerance_ > 0.0)) return false;
+  for (size_t i = 0; i < count; ++i) {
+    if (!samples[i].environment_.ValidateEnvironment()) return false;
+    if (i > 0 && !(samples[i].distance_ >= samples[i - 1].distance_)) {
+      return false;
+    }
+  }
+  const auto path_length = samples[count - 1].distance_ - samples[0].distance_;
+  auto begin = Evaluate(samples[0].environment_);
+  auto time = 0.0;
+  for (size_t i = 1; i < count; ++i) {
+    const auto length = samples[i].distance_ - samples[i - 1].distance_;
+    const auto end = Evaluate(samples[i].environment_);
+    // The tolerance is shared in proportion to length
+    if (length > 0.0) {
+      time += IntegratePanel(begin, end, length,
+                             tolerance_ * length / path_length, 0);
+    }
+    begin = end;
+  }
+  *travel_time = time;
+  return true;
+}
+
+auto TravelTimeIntegrator::Evaluate(const Environment& ambient_conditions)
+    const -> Node {
+  Node node;
+  node.environment_ = ambient_conditions;
+  node.speed_of_sound_ =
+      speed_of_sound_.ComputeRate(ambient_conditions, &node.rate_);
+  return node;
+}
+
+auto TravelTimeIntegrator::IntegratePanel(const Node& begin, const Node& end,
+                                          const double length,
+                                          const double tolerance,
+                                          const int depth) const -> double {
+  const auto c0 = begin.speed_of_sound_;
+  const auto c1 = end.speed_of_sound_;
+  const auto slope0 = Slope(begin.rate_, begin.environment_, end.environment_);
+  const auto slope1 = Slope(end.rate_, begin.environment_, end.environment_);
+  const auto whole = length * CorrectedTrapezoid(c0, c1, slope0, slope1);
+  // Where c stays close to the chord, as Approximate would have it, the end
+  // points suffice
+  const auto chord_slope = c1 - c0;
+  const auto deviation =
+      kCubicDeviation *
+      (fabs(slope0 - chord_slope) + fabs(slope1 - chord_slope));
+  const auto slowest = fmin(c0, c1) - deviation;
+  if (length * deviation / (slowest * slowest) <= tolerance ||
+      depth == kMaxPathDepth) {
+    return whole;
+  }
+  const auto middle =
+      Evaluate(Lerp(begin.environment_, end.environment_, 0.5));
+  const auto c = middle.speed_of_sound_;
+  const auto slope =
+      0.5 * Slope(middle.rate_, begin.environment_, end.environment_);
+  const auto halves =
+      0.5 * length *
+      (CorrectedTrapezoid(c0, c, 0.5 * slope0, slope) +
+       CorrectedTrapezoid(c, c1, slope, 0.5 * slope1));
+  if (fabs(halves - whole) <= kRichardsonFactor * tolerance) {
+    return halves + (halves - whole) / kRichardsonFactor;
+  }
+  return IntegratePanel(begin, middle, 0.5 * length, 0.5 * tolerance,
+                        depth + 1) +
+         IntegratePanel(middle, end, 0.5 * length, 0.5 * tolerance,
+                        depth + 1);
+}
+
+}  // namespace speedofsound
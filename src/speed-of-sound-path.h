@@ -0,0 +1,61 @@
+#ifndef SPEED_OF_SOUND_PATH_H_
+#define SPEED_OF_SOUND_PATH_H_
+
+#include <stddef.h>
+
+#include "environment.h"
+#include "speed-of-sound.h"
+
+namespace speedofsound {
+
+// Point of an acoustic path: its distance from the start of the path (m) and
+// the environment measured there. Between samples the environment varies
+// linearly with distance.
+class PathSample {
+ public:
+  constexpr PathSample() : distance_(0.0), environment_() {}
+  constexpr PathSample(const double distance, const Environment& environment)
+      : distance_(distance), environment_(environment) {}
+  double distance_;
+  Environment environment_;
+};
+
+// Panels are halved at most this many times
+const int kMaxPathDepth = 20;
+
+// Integrates the travel time, the integral of ds / c, along a sampled path.
+// ComputeRate gives c and its gradient at the ends of each panel, and with
+// them the trapezoid rule corrected by the derivatives of 1 / c. Where the
+// gradients show that c stays close to linear the panel is done; otherwise it
+// is compared with its two halves and halved again until the estimated error
+// of the path is within the tolerance (s).
+class TravelTimeIntegrator {
+ public:
+  explicit TravelTimeIntegrator(const double tolerance);
+  auto GetTolerance() const -> double;
+  // False if the tolerance is not positive, there are fewer than two
+  // samples, a distance decreases or an environment is outside the valid
+  // range
+  auto Integrate(const PathSample* samples, const size_t count,
+                 double* travel_time) const -> bool;
+
+ private:
+  class Node {
+   public:
+    Environment environment_;
+    double speed_of_sound_;
+    EnvironmentRate rate_;
+  };
+
+  auto Evaluate(const Environment& ambient_conditions) const -> Node;
+  auto IntegratePanel(const Node& begin, const Node& end, const double length,
+                      const double tolerance, const int depth) const
+      -> double;
+
+  SpeedOfSound speed_of_sound_;
+  double tolerance_;
+};
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_PATH_H_
@@ -0,0 +1,64 @@
+#include "speed-of-sound-ranging.h"
+
+#include "speed-of-sound-inl.h"
+
+namespace speedofsound {
+
+namespace {
+
+auto PathFraction(const EchoPath path) -> double {
+  return path == EchoPath::kRoundTrip ? 0.5 : 1.0;
+}
+
+}  // namespace
+
+EchoRanging::EchoRanging() : EchoRanging(Environment()) {}
+
+EchoRanging::EchoRanging(const Environment& ambient_conditions,
+                         const EchoPath path)
+    : speed_of_sound_(ambient_conditions),
+      path_(path),
+      path_fraction_(PathFraction(path)),
+      distance_per_second_(speed_of_sound_.GetInitSpeedOfSound() *
+                           path_fraction_) {}
+
+auto EchoRanging::Update(const Environment& ambient_conditions) -> void {
+  distance_per_second_ =
+      speed_of_sound_.Compute(ambient_conditions) * path_fraction_;
+}
+
+auto EchoRanging::GetSpeedOfSound() const -> const SpeedOfSound& {
+  return speed_of_sound_;
+}
+
+auto EchoRanging::GetPath() const -> EchoPath { return path_; }
+
+auto EchoRanging::Distance(const double* echo_time, const size_t count,
+                           double* distance) const -> void {
+  const auto distance_per_second = distance_per_second_;
+  for (size_t i = 0; i < count; ++i) {
+    distance[i] = echo_time[i] * distance_per_second;
+  }
+}
+
+auto EchoRanging::Distance(const EnvironmentArrays& ambient_conditions,
+                           const double* echo_time, const size_t count,
+                           double* distance) const -> void {
+  // Locals keep the loop free of loads that could alias the output, so the
+  // compiler vectorizes it
+  const auto c0 = speed_of_sound_.GetInitSpeedOfSound();
+  const auto init = speed_of_sound_.GetInitEnvironment();
+  const auto rate = speed_of_sound_.GetInitEnvironmentRate();
+  const auto path_fraction = path_fraction_;
+  const auto t = ambient_conditions.temperature_;
+  const auto h = ambient_conditions.humidity_;
+  const auto p = ambient_conditions.pressure_;
+  const auto xc = ambient_conditions.co2_mole_fraction_;
+  for (size_t i = 0; i < count; ++i) {
+    const Environment environment(t[i], h[i], p[i], xc[i]);
+    const auto c = internal::LinearApproximation(init, c0, rate, environment);
+    distance[i] = echo_time[i] * c * path_fraction;
+  }
+}
+
+}  // namespace speedofsound
@@ -0,0 +1,44 @@
+#ifndef SPEED_OF_SOUND_RANGING_H_
+#define SPEED_OF_SOUND_RANGING_H_
+
+#include <stddef.h>
+
+#include "environment.h"
+#include "speed-of-sound-batch.h"
+#include "speed-of-sound.h"
+
+namespace speedofsound {
+
+// A round trip goes to the target and back, so the distance is half the path
+enum class EchoPath { kOneWay, kRoundTrip };
+
+// Converts echo times (s) into distances (m). Update calls Compute once per
+// environmental update, and every block of echoes until the next update
+// reuses that linearization point.
+class EchoRanging {
+ public:
+  EchoRanging();
+  explicit EchoRanging(const Environment& ambient_conditions,
+                       const EchoPath path = EchoPath::kRoundTrip);
+  auto Update(const Environment& ambient_conditions) -> void;
+  auto GetSpeedOfSound() const -> const SpeedOfSound&;
+  auto GetPath() const -> EchoPath;
+  // Every echo heard in the environment of the last update
+  auto Distance(const double* echo_time, const size_t count,
+                double* distance) const -> void;
+  // Echo i heard in environment i, each equal to converting echo_time[i] with
+  // SpeedOfSound::Approximate (linear) about the last update
+  auto Distance(const EnvironmentArrays& ambient_conditions,
+                const double* echo_time, const size_t count,
+                double* distance) const -> void;
+
+ private:
+  SpeedOfSound speed_of_sound_;
+  EchoPath path_;
+  double path_fraction_;
+  double distance_per_second_;
+};
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_RANGING_H_
@@ -0,0 +1,374 @@
+#ifndef SPEED_OF_SOUND_THEORY_INL_H_
+#define SPEED_OF_SOUND_THEORY_INL_H_
+
+#include "speed-of-sound-theory.h"
+
+#include "speed-of-sound-coefficients.h"
+
+// Using math.h instead of cmath because cmath is often not available on
+// embedded compilers
+#include <math.h>
+
+namespace speedofsound {
+
+namespace theory {
+
+namespace internal {
+
+// exp(m / 32) for m = kExpTableOffset, ..., covering the Psv exponent in (and
+// somewhat beyond) the valid temperature range. avr-gcc copies constant data
+// into SRAM, where the table would take 388 of the 2048 bytes of an
+// ATmega328P, so AVR has no table and uses libm.
+constexpr int kExpTableOffset = 192;
+constexpr int kExpTableSize = 97;
+#ifndef __AVR__
+extern const double kExpTable[kExpTableSize];
+#endif
+
+template <typename Scalar>
+auto PsvExponent(const Scalar T) -> Scalar {
+  using K = Coefficients<Scalar>;
+  auto exponent = K::k19 * T * T;
+  exponent += K::k20 * T;
+  exponent += K::k21;
+  exponent += K::k22 / T;
+  return exponent;
+}
+
+// x - m / 32 is exact, leaving |r| <= 1/64 for a degree 6 Taylor polynomial
+// evaluated in powers of r * r to shorten the dependency chain. The table only
+// carries double precision, so wider types use libm instead, as do x outside
+// the table and NaN, which fails both comparisons.
+template <typename Scalar>
+auto FastExp(const Scalar x) -> Scalar {
+#ifdef __AVR__
+  return exp(x);
+#else
+  const auto scaled = x * 32 + static_cast<Scalar>(0.5);
+  if (sizeof(Scalar) > sizeof(double) || !(scaled >= kExpTableOffset) ||
+      !(scaled < kExpTableOffset + kExpTableSize)) {
+    return exp(x);
+  }
+  const auto m = static_cast<int>(scaled) - kExpTableOffset;
+  const auto r = x - static_cast<Scalar>(m + kExpTableOffset) / 32;
+  const auto r2 = r * r;
+  auto exp_r = (static_cast<Scalar>(1.0 / 24.0) +
+                r * static_cast<Scalar>(1.0 / 120.0)) +
+               r2 * static_cast<Scalar>(1.0 / 720.0);
+  exp_r =
+      (static_cast<Scalar>(1.0 / 2.0) + r * static_cast<Scalar>(1.0 / 6.0)) +
+      r2 * exp_r;
+  exp_r = (1 + r) + r2 * exp_r;
+  return static_cast<Scalar>(kExpTable[m]) * exp_r;
+#endif
+}
+
+}  // namespace internal
+
+template <typename Scalar>
+auto T(const Scalar t) -> Scalar {
+  return t + static_cast<Scalar>(273.15);
+}
+
+template <typename Scalar>
+auto dT_dt() -> Scalar {
+  return 1;
+}
+
+template <typename Scalar>
+auto F(const Scalar p, const Scalar t) -> Scalar {
+  using K = Coefficients<Scalar>;
+  return K::k16 + K::k17 * p + K::k18 * t * t;
+}
+
+template <typename Scalar>
+auto dF_dp() -> Scalar {
+  return Coefficients<Scalar>::k17;
+}
+
+template <typename Scalar>
+auto dF_dt(const Scalar t) -> Scalar {
+  return 2 * Coefficients<Scalar>::k18 * t;
+}
+
+template <typename Scalar>
+auto Psv(const Scalar T) -> Scalar {
+  return exp(internal::PsvExponent(T));
+}
+
+template <typename Scalar>
+auto dPsv_dt(const Scalar T) -> Scalar {
+  using K = Coefficients<Scalar>;
+  auto dPsv_dt = 2 * K::k19 * T + K::k20 - K::k22 / (T * T);
+  dPsv_dt *= Psv(T);
+  dPsv_dt *= dT_dt<Scalar>();
+  return dPsv_dt;
+}
+
+template <typename Scalar>
+auto FastPsv(const Scalar T) -> Scalar {
+  return internal::FastExp(internal::PsvExponent(T));
+}
+
+template <typename Scalar>
+auto dPsv_dt(const Scalar T, const Scalar Psv) -> Scalar {
+  using K = Coefficients<Scalar>;
+  auto dPsv_dt = 2 * K::k19 * T + K::k20 - K::k22 / (T * T);
+  dPsv_dt *= Psv;
+  dPsv_dt *= dT_dt<Scalar>();
+  return dPsv_dt;
+}
+
+template <typename Scalar>
+auto FastPsvAndDerivative(const Scalar T, Scalar* dPsv_dt) -> Scalar {
+  const auto Psv = FastPsv(T);
+  *dPsv_dt = theory::dPsv_dt(T, Psv);
+  return Psv;
+}
+
+template <typename Scalar>
+auto Xw(const Scalar h, const Scalar F, const Scalar Psv, const Scalar p)
+    -> Scalar {
+  return h * F * Psv / p;
+}
+
+template <typename Scalar>
+auto dXw_dh(const Scalar F, const Scalar Psv, const Scalar p) -> Scalar {
+  return F * Psv / p;
+}
+
+template <typename Scalar>
+auto dXw_dF(const Scalar h, const Scalar Psv, const Scalar p) -> Scalar {
+  return h * Psv / p;
+}
+
+template <typename Scalar>
+auto dXw_dPsv(const Scalar h, const Scalar F, const Scalar p) -> Scalar {
+  return h * F / p;
+}
+
+template <typename Scalar>
+auto dXw_dp(const Scalar h, const Scalar F, const Scalar Psv, const Scalar p)
+    -> Scalar {
+  auto dXw_dp = -h * F * Psv / (p * p);
+  dXw_dp += h * dF_dp<Scalar>() * Psv / p;
+  return dXw_dp;
+}
+
+template <typename Scalar>
+auto C(const Scalar t, const Scalar p, const Scalar Xw, const Scalar xc)
+    -> Scalar {
+  using K = Coefficients<Scalar>;
+  auto C = K::k00 + K::k01 * t + K::k02 * t * t;
+  C += (K::k03 + K::k04 * t + K::k05 * t * t) * Xw;
+  C += (K::k06 + K::k07 * t + K::k08 * t * t) * p;
+  C += (K::k09 + K::k10 * t + K::k11 * t * t) * xc;
+  C += K::k12 * Xw * Xw;
+  C += K::k13 * p * p;
+  C += K::k14 * xc * xc;
+  C += K::k15 * Xw * p * xc;
+  return C;
+}
+
+template <typename Scalar>
+auto dC_dt(const Scalar t, const Scalar p, const Scalar Xw, const Scalar xc,
+           const Scalar dXw_dF, const Scalar dF_dt, const Scalar dXw_dPsv,
+           const Scalar dPsv_dt) -> Scalar {
+  using K = Coefficients<Scalar>;
+  auto dC_dt = K::k01 + 2 * K::k02 * t;
+  dC_dt += (K::k04 + 2 * K::k05 * t) * Xw;
+  dC_dt += (K::k03 + K::k04 * t + K::k05 * t * t) * dXw_dPsv * dPsv_dt;
+  dC_dt += (K::k03 + K::k04 * t + K::k05 * t * t) * dXw_dF * dF_dt;
+  dC_dt += (K::k07 + 2 * K::k08 * t) * p;
+  dC_dt += (K::k10 + 2 * K::k11 * t) * xc;
+  dC_dt += 2 * K::k12 * Xw * dXw_dPsv * dPsv_dt;
+  dC_dt += 2 * K::k12 * Xw * dXw_dF * dF_dt;
+  dC_dt += K::k15 * p * xc * dXw_dPsv * dPsv_dt;
+  dC_dt += K::k15 * p * xc * dXw_dF * dF_dt;
+  return dC_dt;
+}
+
+template <typename Scalar>
+auto dC_dXw(const Scalar t, const Scalar p, const Scalar Xw, const Scalar xc)
+    -> Scalar {
+  using K = Coefficients<Scalar>;
+  auto dC_dXw = K::k03 + K::k04 * t + K::k05 * t * t;
+  dC_dXw += 2 * K::k12 * Xw;
+  dC_dXw += K::k15 * xc * p;
+  return dC_dXw;
+}
+
+template <typename Scalar>
+auto dC_dp(const Scalar t, const Scalar p, const Scalar Xw, const Scalar xc,
+           const Scalar dXw_dp) -> Scalar {
+  using K = Coefficients<Scalar>;
+  auto dC_dp = (K::k03 + K::k04 * t + K::k05 * t * t) * dXw_dp;
+  dC_dp += K::k06 + K::k07 * t + K::k08 * t * t;
+  dC_dp += 2 * K::k12 * Xw * dXw_dp;
+  dC_dp += 2 * K::k13 * p;
+  dC_dp += K::k15 * dXw_dp * p * xc;
+  dC_dp += K::k15 * Xw * xc;
+  return dC_dp;
+}
+
+template <typename Scalar>
+auto dC_dxc(const Scalar t, const Scalar p, const Scalar Xw, const Scalar xc)
+    -> Scalar {
+  using K = Coefficients<Scalar>;
+  auto dC_dxc = K::k09 + K::k10 * t + K::k11 * t * t;
+  dC_dxc += 2 * K::k14 * xc;
+  dC_dxc += K::k15 * p * Xw;
+  return dC_dxc;
+}
+
+template <typename Scalar>
+auto dC_dh(const Scalar dC_dXw, const Scalar dXw_dh) -> Scalar {
+  return dC_dXw * dXw_dh;
+}
+
+template <typename Scalar>
+auto d2F_dt2() -> Scalar {
+  return 2 * Coefficients<Scalar>::k18;
+}
+
+template <typename Scalar>
+auto d2Psv_dt2(const Scalar T, const Scalar Psv) -> Scalar {
+  using K = Coefficients<Scalar>;
+  const auto dexponent_dT = 2 * K::k19 * T + K::k20 - K::k22 / (T * T);
+  auto d2Psv_dt2 = dexponent_dT * dexponent_dT;
+  d2Psv_dt2 += 2 * K::k19 + 2 * K::k22 / (T * T * T);
+  d2Psv_dt2 *= Psv;
+  d2Psv_dt2 *= dT_dt<Scalar>() * dT_dt<Scalar>();
+  return d2Psv_dt2;
+}
+
+template <typename Scalar>
+auto d2Xw_dt2(const Scalar h, const Scalar F, const Scalar Psv, const Scalar p,
+              const Scalar dF_dt, const Scalar dPsv_dt, const Scalar d2F_dt2,
+              const Scalar d2Psv_dt2) -> Scalar {
+  auto d2Xw_dt2 = d2F_dt2 * Psv;
+  d2Xw_dt2 += 2 * dF_dt * dPsv_dt;
+  d2Xw_dt2 += F * d2Psv_dt2;
+  return h * d2Xw_dt2 / p;
+}
+
+template <typename Scalar>
+auto d2Xw_dtdh(const Scalar F, const Scalar Psv, const Scalar p,
+               const Scalar dF_dt, const Scalar dPsv_dt) -> Scalar {
+  return (dF_dt * Psv + F * dPsv_dt) / p;
+}
+
+template <typename Scalar>
+auto d2Xw_dtdp(const Scalar h, const Scalar F, const Scalar Psv,
+               const Scalar p, const Scalar dF_dt, const Scalar dPsv_dt)
+    -> Scalar {
+  auto d2Xw_dtdp = h * dF_dp<Scalar>() * dPsv_dt / p;
+  d2Xw_dtdp -= h * (dF_dt * Psv + F * dPsv_dt) / (p * p);
+  return d2Xw_dtdp;
+}
+
+template <typename Scalar>
+auto d2Xw_dhdp(const Scalar F, const Scalar Psv, const Scalar p) -> Scalar {
+  return dF_dp<Scalar>() * Psv / p - F * Psv / (p * p);
+}
+
+template <typename Scalar>
+auto d2Xw_dp2(const Scalar h, const Scalar F, const Scalar Psv, const Scalar p)
+    -> Scalar {
+  return 2 * h * Psv * (F - dF_dp<Scalar>() * p) / (p * p * p);
+}
+
+template <typename Scalar>
+auto d2C_dt2(const Scalar t, const Scalar p, const Scalar Xw, const Scalar xc,
+             const Scalar dXw_dt, const Scalar d2Xw_dt2) -> Scalar {
+  using K = Coefficients<Scalar>;
+  auto d2C_dt2 = 2 * K::k02;
+  d2C_dt2 += 2 * K::k05 * Xw;
+  d2C_dt2 += 2 * K::k08 * p;
+  d2C_dt2 += 2 * K::k11 * xc;
+  d2C_dt2 += 2 * (K::k04 + 2 * K::k05 * t) * dXw_dt;
+  d2C_dt2 += 2 * K::k12 * dXw_dt * dXw_dt;
+  d2C_dt2 += dC_dXw(t, p, Xw, xc) * d2Xw_dt2;
+  return d2C_dt2;
+}
+
+template <typename Scalar>
+auto d2C_dtdh(const Scalar t, const Scalar p, const Scalar Xw,
+              const Scalar xc, const Scalar dXw_dt, const Scalar dXw_dh,
+              const Scalar d2Xw_dtdh) -> Scalar {
+  using K = Coefficients<Scalar>;
+  auto d2C_dtdh = (K::k04 + 2 * K::k05 * t) * dXw_dh;
+  d2C_dtdh += 2 * K::k12 * dXw_dt * dXw_dh;
+  d2C_dtdh += dC_dXw(t, p, Xw, xc) * d2Xw_dtdh;
+  return d2C_dtdh;
+}
+
+template <typename Scalar>
+auto d2C_dtdp(const Scalar t, const Scalar p, const Scalar Xw,
+              const Scalar xc, const Scalar dXw_dt, const Scalar dXw_dp,
+              const Scalar d2Xw_dtdp) -> Scalar {
+  using K = Coefficients<Scalar>;
+  auto d2C_dtdp = K::k07 + 2 * K::k08 * t;
+  d2C_dtdp += (K::k04 + 2 * K::k05 * t) * dXw_dp;
+  d2C_dtdp += K::k15 * xc * dXw_dt;
+  d2C_dtdp += 2 * K::k12 * dXw_dt * dXw_dp;
+  d2C_dtdp += dC_dXw(t, p, Xw, xc) * d2Xw_dtdp;
+  return d2C_dtdp;
+}
+
+template <typename Scalar>
+auto d2C_dtdxc(const Scalar t, const Scalar p, const Scalar dXw_dt)
+    -> Scalar {
+  using K = Coefficients<Scalar>;
+  return K::k10 + 2 * K::k11 * t + K::k15 * p * dXw_dt;
+}
+
+template <typename Scalar>
+auto d2C_dh2(const Scalar dXw_dh) -> Scalar {
+  return 2 * Coefficients<Scalar>::k12 * dXw_dh * dXw_dh;
+}
+
+template <typename Scalar>
+auto d2C_dhdp(const Scalar t, const Scalar p, const Scalar Xw,
+              const Scalar xc, const Scalar dXw_dh, const Scalar dXw_dp,
+              const Scalar d2Xw_dhdp) -> Scalar {
+  using K = Coefficients<Scalar>;
+  auto d2C_dhdp = 2 * K::k12 * dXw_dh * dXw_dp;
+  d2C_dhdp += K::k15 * xc * dXw_dh;
+  d2C_dhdp += dC_dXw(t, p, Xw, xc) * d2Xw_dhdp;
+  return d2C_dhdp;
+}
+
+template <typename Scalar>
+auto d2C_dhdxc(const Scalar p, const Scalar dXw_dh) -> Scalar {
+  return Coefficients<Scalar>::k15 * p * dXw_dh;
+}
+
+template <typename Scalar>
+auto d2C_dp2(const Scalar t, const Scalar p, const Scalar Xw, const Scalar xc,
+             const Scalar dXw_dp, const Scalar d2Xw_dp2) -> Scalar {
+  using K = Coefficients<Scalar>;
+  auto d2C_dp2 = 2 * K::k13;
+  d2C_dp2 += 2 * K::k15 * xc * dXw_dp;
+  d2C_dp2 += 2 * K::k12 * dXw_dp * dXw_dp;
+  d2C_dp2 += dC_dXw(t, p, Xw, xc) * d2Xw_dp2;
+  return d2C_dp2;
+}
+
+template <typename Scalar>
+auto d2C_dpdxc(const Scalar p, const Scalar Xw, const Scalar dXw_dp)
+    -> Scalar {
+  using K = Coefficients<Scalar>;
+  return K::k15 * Xw + K::k15 * p * dXw_dp;
+}
+
+template <typename Scalar>
+auto d2C_dxc2() -> Scalar {
+  return 2 * Coefficients<Scalar>::k14;
+}
+
+}  // namespace theory
+
+}  // namespace speedofsound
+
+#endif  // SPEED_OF_SOUND_THEORY_INL_H_
@@ -1,151 +1,107 @@
 #include "speed-of-sound-theory.h"
 
-// Using math.h instead of cmath because cmath is often not available on
-// embedded compilers
-#include <math.h>
+#include "speed-of-sound-theory-inl.h"
 
 namespace speedofsound {
 
 namespace theory {
 
-namespace {
-
-const double k00 = 3.315024000e+02;
-const double k01 = 6.030550000e-01;
-const double k02 = -5.280000000e-04;
-const double k03 = 5.147193500e+01;
-const double k04 = 1.495874000e-01;
-const double k05 = -7.820000000e-04;
-const double k06 = -1.820000000e-07;
-const double k07 = 3.730000000e-08;
-const double k08 = -2.930000000e-10;
-const double k09 = -8.520931000e+01;
-const double k10 = -2.285250000e-01;
-const double k11 = 5.910000000e-05;
-const double k12 = -2.835149000e+00;
-const double k13 = -2.150000000e-13;
-const double k14 = 2.917976200e+01;
-const double k15 = 4.860000000e-04;
-const double k16 = 1.000620000e+00;
-const double k17 = 3.140000000e-08;
-const double k18 = 5.600000000e-07;
-const double k19 = 1.281180500e-05;
-const double k20 = -1.950987400e-02;
-const double k21 = 3.404926034e+01;
-const double k22 = -6.353631100e+03;
-
-}  // namespace
-
-auto T(const double t) -> double { return t + 273.15; }
-
-auto dT_dt() -> double { return 1.0; }
-
-auto F(const double p, const double t) -> double {
-  return k16 + k17 * p + k18 * t * t;
-}
-
-auto dF_dp() -> double { return k17; }
-
-auto dF_dt(const double t) -> double { return 2.0 * k18 * t; }
-
-auto Psv(const double T) -> double {
-  auto Psv = k19 * T * T;
-  Psv += k20 * T;
-  Psv += k21;
-  Psv += k22 / T;
-  return exp(Psv);
-}
-
-auto dPsv_dt(const double T) -> double {
-  auto dPsv_dt = 2.0 * k19 * T + k20 - k22 / (T * T);
-  dPsv_dt *= Psv(T);
-  dPsv_dt *= dT_dt();
-  return dPsv_dt;
-}
-
-auto Xw(const double h, const double F, const double Psv, const double p)
-    -> double {
-  return h * F * Psv / p;
-}
-
-auto dXw_dh(const double F, const double Psv, const double p) -> double {
-  return F * Psv / p;
-}
-
-auto dXw_dF(const double h, const double Psv, const double p) -> double {
-  return h * Psv / p;
-}
-
-auto dXw_dPsv(const double h, const double F, const double p) -> double {
-  return h * F / p;
-}
-
-auto dXw_dp(const double h, const double F, const double Psv, const double p)
-    -> double {
-  auto dXw_dp = -h * F * Psv / (p * p);
-  dXw_dp += h * dF_dp() * Psv / p;
-  return dXw_dp;
-}
-
-auto C(const double t, const double p, const double Xw, const double xc)
-    -> double {
-  auto C = k00 + k01 * t + k02 * t * t;
-  C += (k03 + k04 * t + k05 * t * t) * Xw;
-  C += (k06 + k07 * t + k08 * t * t) * p;
-  C += (k09 + k10 * t + k11 * t * t) * xc;
-  C += k12 * Xw * Xw;
-  C += k13 * p * p;
-  C += k14 * xc * xc;
-  C += k15 * Xw * p * xc;
-  return C;
-}
-
-auto dC_dt(const double t, const double p, const double Xw, const double xc,
-           const double dXw_dF, const double dF_dt, const double dXw_dPsv,
-           const double dPsv_dt) -> double {
-  auto dC_dt = k01 + 2.0 * k02 * t;
-  dC_dt += (k04 + 2.0 * k05 * t) * Xw;
-  dC_dt += (k03 + k04 * t + k05 * t * t) * dXw_dPsv * dPsv_dt;
-  dC_dt += (k03 + k04 * t + k05 * t * t) * dXw_dF * dF_dt;
-  dC_dt += (k07 + 2.0 * k08 * t) * p;
-  dC_dt += (k10 + 2.0 * k11 * t) * xc;
-  dC_dt += 2.0 * k12 * Xw * dXw_dPsv * dPsv_dt;
-  dC_dt += 2.0 * k12 * Xw * dXw_dF * dF_dt;
-  dC_dt += k15 * p * xc * dXw_dPsv * dPsv_dt;
-  dC_dt += k15 * p * xc * dXw_dF * dF_dt;
-  return dC_dt;
-}
-
-auto dC_dXw(const double t, const double p, const double Xw, const double xc)
-    -> double {
-  auto dC_dXw = k03 + k04 * t + k05 * t * t;
-  dC_dXw += 2.0 * k12 * Xw;
-  dC_dXw += k15 * xc * p;
-  return dC_dXw;
-}
-
-auto dC_dp(const double t, const double p, const double Xw, const double xc,
-           const double dXw_dp) -> double {
-  auto dC_dp = (k03 + k04 * t + k05 * t * t) * dXw_dp;
-  dC_dp += k06 + k07 * t + k08 * t * t;
-  dC_dp += 2.0 * k12 * Xw * dXw_dp;
-  dC_dp += 2.0 * k13 * p;
-  dC_dp += k15 * dXw_dp * p * xc;
-  dC_dp += k15 * Xw * xc;
-  return dC_dp;
-}
-
-auto dC_dxc(const double t, const double p, const double Xw, const double xc)
-    -> double {
-  auto dC_dxc = k09 + k10 * t + k11 * t * t;
-  dC_dxc += 2.0 * k14 * xc;
-  dC_dxc += k15 * p * Xw;
-  return dC_dxc;
-}
-
-auto dC_dh(const double dC_dXw, const double dXw_dh) -> double {
-  return dC_dXw * dXw_dh;
-}
+namespace internal {
+
+#ifndef __AVR__
+const double kExpTable[kExpTableSize] = {
+    403.4287934927351, 416.23499808144635, 429.4477152409339,
+    443.0798490653855, 457.14471326890896, 471.65604418826433,
+    486.6280141983472, 502.07524555352444, 518.012824668342,
+    534.4563168515505, 551.4217815078388, 568.9257878221232,
+    586.9854309417088, 605.6183486721279, 624.8427387029609,
+    644.6773763804644, 665.1416330443618, 686.2554949467076,
+    708.0395827712994, 730.5151717727034, 753.7042125545613,
+    777.629352507471, 802.313957927379, 827.7821368360857,
+    854.0587625261516, 881.1694978531985, 909.1408202993323,
+    938.0000478321625, 967.7753655846766, 998.495853382024,
+    1030.1915141420939, 1062.893303177624, 1096.6331584284585,
+    1131.4440316534813, 1167.3599206126853, 1204.4159022708138,
+    1242.6481670549958, 1282.0940541998355, 1322.7920882144774,
+    1364.7820165072585, 1408.1048482046956, 1452.8028942027192,
+    1498.919808489272, 1546.5006307786239, 1595.5918304990491,
+    1646.2413521768196, 1698.4986622608421, 1752.4147974336688,
+    1808.0424144560632, 1865.4358415938036, 1924.6511316769472,
+    1985.7461168433776, 2048.780465020098, 2113.8157381974315,
+    2180.9154525530494, 2250.1451404845307, 2321.572414611057,
+    2395.2670338067314, 2471.3009713300253, 2549.7484851158824,
+    2630.686190299136, 2714.193134040063, 2800.3508727251633,
+    2889.243551618546, 2980.9579870417283, 3075.5837511620985,
+    3173.213259472856, 3273.9418610498587, 3377.8679316735347,
+    3485.092969906799, 3595.7216962228085, 3709.862155279374,
+    3827.6258214399063, 3949.1277076439605, 4074.4864777337,
+    4203.824562345984, 4337.2682784832705, 4474.947952880096,
+    4616.998049285644, 4763.55729978668, 4914.768840299134,
+    5070.780350360642, 5231.744197360583, 5397.817585348465,
+    5569.162708566004, 5745.946909852821, 5928.342844080489,
+    6116.528646774525, 6310.688108089024, 6511.010852303835,
+    6717.692523019596, 6930.934974231482, 7150.946467468294,
+    7377.941875189409, 7612.142890638241, 7853.778244357167,
+    8103.083927575384};
+#endif
+
+}  // namespace internal
+
+#define SPEED_OF_SOUND_INSTANTIATE_THEORY(Scalar) \
+  template auto T<Scalar>(Scalar) -> Scalar; \
+  template auto dT_dt<Scalar>() -> Scalar; \
+  template auto F<Scalar>(Scalar, Scalar) -> Scalar; \
+  template auto dF_dp<Scalar>() -> Scalar; \
+  template auto dF_dt<Scalar>(Scalar) -> Scalar; \
+  template auto Psv<Scalar>(Scalar) -> Scalar; \
+  template auto dPsv_dt<Scalar>(Scalar) -> Scalar; \
+  template auto dPsv_dt<Scalar>(Scalar, Scalar) -> Scalar; \
+  template auto FastPsv<Scalar>(Scalar) -> Scalar; \
+  template auto FastPsvAndDerivative<Scalar>(Scalar, Scalar*) -> Scalar; \
+  template auto Xw<Scalar>(Scalar, Scalar, Scalar, Scalar) -> Scalar; \
+  template auto dXw_dh<Scalar>(Scalar, Scalar, Scalar) -> Scalar; \
+  template auto dXw_dF<Scalar>(Scalar, Scalar, Scalar) -> Scalar; \
+  template auto dXw_dPsv<Scalar>(Scalar, Scalar, Scalar) -> Scalar; \
+  template auto dXw_dp<Scalar>(Scalar, Scalar, Scalar, Scalar) -> Scalar; \
+  template auto C<Scalar>(Scalar, Scalar, Scalar, Scalar) -> Scalar; \
+  template auto dC_dt<Scalar>(Scalar, Scalar, Scalar, Scalar, Scalar, Scalar, \
+      Scalar, Scalar) -> Scalar; \
+  template auto dC_dXw<Scalar>(Scalar, Scalar, Scalar, Scalar) -> Scalar; \
+  template auto dC_dxc<Scalar>(Scalar, Scalar, Scalar, Scalar) -> Scalar; \
+  template auto dC_dp<Scalar>(Scalar, Scalar, Scalar, Scalar, \
+      Scalar) -> Scalar; \
+  template auto dC_dh<Scalar>(Scalar, Scalar) -> Scalar; \
+  template auto d2F_dt2<Scalar>() -> Scalar; \
+  template auto d2Psv_dt2<Scalar>(Scalar, Scalar) -> Scalar; \
+  template auto d2Xw_dt2<Scalar>(Scalar, Scalar, Scalar, Scalar, Scalar, \
+      Scalar, Scalar, Scalar) -> Scalar; \
+  template auto d2Xw_dtdh<Scalar>(Scalar, Scalar, Scalar, Scalar, \
+      Scalar) -> Scalar; \
+  template auto d2Xw_dtdp<Scalar>(Scalar, Scalar, Scalar, Scalar, Scalar, \
+      Scalar) -> Scalar; \
+  template auto d2Xw_dhdp<Scalar>(Scalar, Scalar, Scalar) -> Scalar; \
+  template auto d2Xw_dp2<Scalar>(Scalar, Scalar, Scalar, Scalar) -> Scalar; \
+  template auto d2C_dt2<Scalar>(Scalar, Scalar, Scalar, Scalar, Scalar, \
+      Scalar) -> Scalar; \
+  template auto d2C_dtdh<Scalar>(Scalar, Scalar, Scalar, Scalar, Scalar, \
+      Scalar, Scalar) -> Scalar; \
+  template auto d2C_dtdp<Scalar>(Scalar, Scalar, Scalar, Scalar, Scalar, \
+      Scalar, Scalar) -> Scalar; \
+  template auto d2C_dtdxc<Scalar>(Scalar, Scalar, Scalar) -> Scalar; \
+  template auto d2C_dh2<Scalar>(Scalar) -> Scalar; \
+  template auto d2C_dhdp<Scalar>(Scalar, Scalar, Scalar, Scalar, Scalar, \
+      Scalar, Scalar) -> Scalar; \
+  template auto d2C_dhdxc<Scalar>(Scalar, Scalar) -> Scalar; \
+  template auto d2C_dp2<Scalar>(Scalar, Scalar, Scalar, Scalar, Scalar, \
+      Scalar) -> Scalar; \
+  template auto d2C_dpdxc<Scalar>(Scalar, Scalar, Scalar) -> Scalar; \
+  template auto d2C_dxc2<Scalar>() -> Scalar;
+
+SPEED_OF_SOUND_INSTANTIATE_THEORY(float)
+SPEED_OF_SOUND_INSTANTIATE_THEORY(double)
+SPEED_OF_SOUND_INSTANTIATE_THEORY(long double)
+
+#undef SPEED_OF_SOUND_INSTANTIATE_THEORY
 
 }  // namespace theory
 
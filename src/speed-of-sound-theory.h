@@ -5,56 +5,164 @@ namespace speedofsound {
 
 namespace theory {
 
-const double kStdTemperature = 20.0;
-const double kStdHumidity = 0.5;
-const double kStdPressure = 101325.0;
-const double kStdCO2MoleFraction = 0.000314;
-
-const double kMinTemperature = 0.0;
-const double kMinHumidity = 0.0;
-const double kMinPressure = 75000.0;
-const double kMinXwPressure = 60000.0;
-const double kMinCO2MoleFraction = 0.0;
-
-const double kMaxTemperature = 30.0;
-const double kMaxHumidity = 1.0;
-const double kMaxPressure = 102000.0;
-const double kMaxXwPressure = 110000.0;
-const double kMaxCO2MoleFraction = 0.01;
-
-auto T(const double t) -> double;
-auto dT_dt() -> double;
-
-auto F(const double p, const double t) -> double;
-auto dF_dp() -> double;
-auto dF_dt(const double t) -> double;
-
-auto Psv(const double T) -> double;
-auto dPsv_dt(const double T) -> double;
-
-auto Xw(const double h, const double F, const double Psv, const double p)
-    -> double;
-auto dXw_dh(const double F, const double Psv, const double p) -> double;
-auto dXw_dF(const double h, const double Psv, const double p) -> double;
-auto dXw_dPsv(const double h, const double F, const double p) -> double;
-auto dXw_dp(const double h, const double F, const double Psv, const double p)
-    -> double;
-
-auto C(const double t, const double p, const double Xw, const double xc)
-    -> double;
-auto dC_dt(const double t, const double p, const double Xw, const double xc,
-           const double dXw_dF, const double dF_dt, const double dXw_dPsv,
-           const double dPsv_dt) -> double;
-auto dC_dXw(const double t, const double p, const double Xw, const double xc)
-    -> double;
-auto dC_dxc(const double t, const double p, const double Xw, const double xc)
-    -> double;
-auto dC_dp(const double t, const double p, const double Xw, const double xc,
-           const double dXw_dp) -> double;
-auto dC_dh(const double dC_dXw, const double dXw_dh) -> double;
+constexpr double kStdTemperature = 20.0;
+constexpr double kStdHumidity = 0.5;
+constexpr double kStdPressure = 101325.0;
+constexpr double kStdCO2MoleFraction = 0.000314;
+
+constexpr double kMinTemperature = 0.0;
+constexpr double kMinHumidity = 0.0;
+constexpr double kMinPressure = 75000.0;
+constexpr double kMinXwPressure = 60000.0;
+constexpr double kMinCO2MoleFraction = 0.0;
+
+constexpr double kMaxTemperature = 30.0;
+constexpr double kMaxHumidity = 1.0;
+constexpr double kMaxPressure = 102000.0;
+constexpr double kMaxXwPressure = 110000.0;
+constexpr double kMaxCO2MoleFraction = 0.01;
+
+// The model is defined in speed-of-sound-theory-inl.h and instantiated for
+// float, double and long double. With SPEED_OF_SOUND_HEADER_ONLY (the
+// HEADER_ONLY CMake option) this header includes the definitions, so that
+// callers can inline the model; the library still provides the exponential
+// table and the explicit instantiations.
+template <typename Scalar>
+auto T(const Scalar t) -> Scalar;
+template <typename Scalar = double>
+auto dT_dt() -> Scalar;
+
+template <typename Scalar>
+auto F(const Scalar p, const Scalar t) -> Scalar;
+template <typename Scalar = double>
+auto dF_dp() -> Scalar;
+template <typename Scalar>
+auto dF_dt(const Scalar t) -> Scalar;
+
+template <typename Scalar>
+auto Psv(const Scalar T) -> Scalar;
+template <typename Scalar>
+auto dPsv_dt(const Scalar T) -> Scalar;
+// From Psv already evaluated at T, without a second exponential
+template <typename Scalar>
+auto dPsv_dt(const Scalar T, const Scalar Psv) -> Scalar;
+
+// Avoids libm, except on AVR, and shares one exponential between the value
+// and derivative. Within kFastPsvMaxRelativeError of Psv and dPsv_dt for
+// T(kMinTemperature) <= T <= T(kMaxTemperature); falls back to libm where the
+// exponent is outside its table.
+constexpr double kFastPsvMaxRelativeError = 8.0e-16;
+template <typename Scalar>
+auto FastPsv(const Scalar T) -> Scalar;
+template <typename Scalar>
+auto FastPsvAndDerivative(const Scalar T, Scalar* dPsv_dt) -> Scalar;
+
+template <typename Scalar>
+auto Xw(const Scalar h, const Scalar F, const Scalar Psv, const Scalar p)
+    -> Scalar;
+template <typename Scalar>
+auto dXw_dh(const Scalar F, const Scalar Psv, const Scalar p) -> Scalar;
+template <typename Scalar>
+auto dXw_dF(const Scalar h, const Scalar Psv, const Scalar p) -> Scalar;
+template <typename Scalar>
+auto dXw_dPsv(const Scalar h, const Scalar F, const Scalar p) -> Scalar;
+template <typename Scalar>
+auto dXw_dp(const Scalar h, const Scalar F, const Scalar Psv, const Scalar p)
+    -> Scalar;
+
+template <typename Scalar>
+auto C(const Scalar t, const Scalar p, const Scalar Xw, const Scalar xc)
+    -> Scalar;
+template <typename Scalar>
+auto dC_dt(const Scalar t, const Scalar p, const Scalar Xw, const Scalar xc,
+           const Scalar dXw_dF, const Scalar dF_dt, const Scalar dXw_dPsv,
+           const Scalar dPsv_dt) -> Scalar;
+template <typename Scalar>
+auto dC_dXw(const Scalar t, const Scalar p, const Scalar Xw, const Scalar xc)
+    -> Scalar;
+template <typename Scalar>
+auto dC_dxc(const Scalar t, const Scalar p, const Scalar Xw, const Scalar xc)
+    -> Scalar;
+template <typename Scalar>
+auto dC_dp(const Scalar t, const Scalar p, const Scalar Xw, const Scalar xc,
+           const Scalar dXw_dp) -> Scalar;
+template <typename Scalar>
+auto dC_dh(const Scalar dC_dXw, const Scalar dXw_dh) -> Scalar;
+
+template <typename Scalar = double>
+auto d2F_dt2() -> Scalar;
+
+template <typename Scalar>
+auto d2Psv_dt2(const Scalar T, const Scalar Psv) -> Scalar;
+
+template <typename Scalar>
+auto d2Xw_dt2(const Scalar h, const Scalar F, const Scalar Psv, const Scalar p,
+              const Scalar dF_dt, const Scalar dPsv_dt, const Scalar d2F_dt2,
+              const Scalar d2Psv_dt2) -> Scalar;
+template <typename Scalar>
+auto d2Xw_dtdh(const Scalar F, const Scalar Psv, const Scalar p,
+               const Scalar dF_dt, const Scalar dPsv_dt) -> Scalar;
+template <typename Scalar>
+auto d2Xw_dtdp(const Scalar h, const Scalar F, const Scalar Psv,
+               const Scalar p, const Scalar dF_dt, const Scalar dPsv_dt)
+    -> Scalar;
+template <typename Scalar>
+auto d2Xw_dhdp(const Scalar F, const Scalar Psv, const Scalar p) -> Scalar;
+template <typename Scalar>
+auto d2Xw_dp2(const Scalar h, const Scalar F, const Scalar Psv, const Scalar p)
+    -> Scalar;
+
+// dXw_dt is the total derivative dXw_dF * dF_dt + dXw_dPsv * dPsv_dt
+template <typename Scalar>
+auto d2C_dt2(const Scalar t, const Scalar p, const Scalar Xw, const Scalar xc,
+             const Scalar dXw_dt, const Scalar d2Xw_dt2) -> Scalar;
+template <typename Scalar>
+auto d2C_dtdh(const Scalar t, const Scalar p, const Scalar Xw,
+              const Scalar xc, const Scalar dXw_dt, const Scalar dXw_dh,
+              const Scalar d2Xw_dtdh) -> Scalar;
+template <typename Scalar>
+auto d2C_dtdp(const Scalar t, const Scalar p, const Scalar Xw,
+              const Scalar xc, const Scalar dXw_dt, const Scalar dXw_dp,
+              const Scalar d2Xw_dtdp) -> Scalar;
+template <typename Scalar>
+auto d2C_dtdxc(const Scalar t, const Scalar p, const Scalar dXw_dt)
+    -> Scalar;
+template <typename Scalar>
+auto d2C_dh2(const Scalar dXw_dh) -> Scalar;
+template <typename Scalar>
+auto d2C_dhdp(const Scalar t, const Scalar p, const Scalar Xw,
+              const Scalar xc, const Scalar dXw_dh, const Scalar dXw_dp,
+              const Scalar d2Xw_dhdp) -> Scalar;
+template <typename Scalar>
+auto d2C_dhdxc(const Scalar p, const Scalar dXw_dh) -> Scalar;
+template <typename Scalar>
+auto d2C_dp2(const Scalar t, const Scalar p, const Scalar Xw, const Scalar xc,
+             const Scalar dXw_dp, const Scalar d2Xw_dp2) -> Scalar;
+template <typename Scalar>
+auto d2C_dpdxc(const Scalar p, const Scalar Xw, const Scalar dXw_dp)
+    -> Scalar;
+template <typename Scalar = double>
+auto d2C_dxc2() -> Scalar;
+
+// Upper bounds of the absolute second partial derivatives of C over the valid
+// environment range, with a 10% margin
+constexpr double kMaxD2C_dt2 = 9.3e-3;
+constexpr double kMaxD2C_dtdh = 2.1e-1;
+constexpr double kMaxD2C_dtdp = 2.7e-6;
+constexpr double kMaxD2C_dtdxc = 2.6e-1;
+constexpr double kMaxD2C_dh2 = 2.1e-2;
+constexpr double kMaxD2C_dhdp = 4.6e-5;
+constexpr double kMaxD2C_dhdxc = 2.3;
+constexpr double kMaxD2C_dp2 = 1.3e-9;
+constexpr double kMaxD2C_dpdxc = 7.2e-8;
+constexpr double kMaxD2C_dxc2 = 65.0;
 
 }  // namespace theory
 
 }  // namespace speedofsound
 
+#ifdef SPEED_OF_SOUND_HEADER_ONLY
+#include "speed-of-sound-theory-inl.h"
+#endif
+
 #endif  // SPEED_OF_SOUND_THEORY_H_
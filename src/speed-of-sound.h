@@ -7,22 +7,76 @@
 
 namespace speedofsound {
 
-class SpeedOfSound {
+// kQuadratic also stores the Hessian at the linearization point so that
+// Approximate stays accurate over a wider range of environments
+enum class ApproximationOrder { kLinear, kQuadratic };
+
+// Largest relative difference of Compute, QuickCompute and Approximate from the
+// double instantiation over the valid range. long double evaluates Psv with
+// libm, so it also bounds the error of the double instantiation.
+constexpr double kFloatMaxRelativeError = 5.0e-7;
+constexpr double kLongDoubleMaxRelativeError = 1.5e-15;
+
+// Defined in speed-of-sound-inl.h and instantiated for float, double and long
+// double; SPEED_OF_SOUND_HEADER_ONLY includes the definitions below
+template <typename Scalar>
+class BasicSpeedOfSound {
  public:
-  SpeedOfSound();
-  SpeedOfSound(const Environment& ambient_conitions);
-  auto GetInitEnvironment() const -> Environment;
-  auto GetInitEnvironmentRate() const -> EnvironmentRate;
-  auto Compute(const Environment& ambient_conitions) -> double;
-  auto QuickCompute(const Environment& ambient_conitions) const -> double;
-  auto Approximate(const Environment& ambient_conitions) const -> double;
+  BasicSpeedOfSound();
+  BasicSpeedOfSound(const BasicEnvironment<Scalar>& ambient_conitions);
+  BasicSpeedOfSound(const BasicEnvironment<Scalar>& ambient_conitions,
+                    const ApproximationOrder approximation_order);
+  // Restores a linearization point without calling Compute, e.g. one
+  // evaluated at compile time with compile_time::Linearize
+  constexpr BasicSpeedOfSound(
+      const BasicEnvironment<Scalar>& init_environment,
+      const Scalar init_speed_of_sound,
+      const BasicEnvironmentRate<Scalar>& init_environment_rate,
+      const BasicEnvironmentCurvature<Scalar>& init_environment_curvature,
+      const ApproximationOrder approximation_order)
+      : init_speed_of_sound_(init_speed_of_sound),
+        init_environment_(init_environment),
+        init_environment_rate_(init_environment_rate),
+        init_environment_curvature_(init_environment_curvature),
+        approximation_order_(approximation_order) {}
+  auto GetApproximationOrder() const -> ApproximationOrder;
+  auto GetInitSpeedOfSound() const -> Scalar;
+  auto GetInitEnvironment() const -> BasicEnvironment<Scalar>;
+  auto GetInitEnvironmentRate() const -> BasicEnvironmentRate<Scalar>;
+  auto GetInitEnvironmentCurvature() const -> BasicEnvironmentCurvature<Scalar>;
+  auto Compute(const BasicEnvironment<Scalar>& ambient_conitions) -> Scalar;
+  // Value and gradient in one pass, without moving the linearization point
+  auto ComputeRate(const BasicEnvironment<Scalar>& ambient_conitions,
+                   BasicEnvironmentRate<Scalar>* rate) const -> Scalar;
+  auto QuickCompute(const BasicEnvironment<Scalar>& ambient_conitions) const
+      -> Scalar;
+  auto Approximate(const BasicEnvironment<Scalar>& ambient_conitions) const
+      -> Scalar;
 
  private:
-  double init_speed_of_sound_;
-  Environment init_environment_;
-  EnvironmentRate init_environment_rate_;
+#ifdef SPEED_OF_SOUND_INSTRUMENTATION
+  // Drift and error of a sampled Approximate call, which it returns
+  auto RecordApproximation(const BasicEnvironment<Scalar>& ambient_conitions,
+                           const Scalar approx_speed_of_sound) const -> Scalar;
+#endif
+  auto ComputeCurvature(const BasicEnvironment<Scalar>& ambient_conitions)
+      -> void;
+  auto ApproximateCurvature(
+      const BasicEnvironment<Scalar>& ambient_conitions) const -> Scalar;
+
+  Scalar init_speed_of_sound_;
+  BasicEnvironment<Scalar> init_environment_;
+  BasicEnvironmentRate<Scalar> init_environment_rate_;
+  BasicEnvironmentCurvature<Scalar> init_environment_curvature_;
+  ApproximationOrder approximation_order_;
 };
 
+using SpeedOfSound = BasicSpeedOfSound<double>;
+
 }  // namespace speedofsound
 
+#ifdef SPEED_OF_SOUND_HEADER_ONLY
+#include "speed-of-sound-inl.h"
+#endif
+
 #endif  // SPEED_OF_SOUND_H_
@@ -0,0 +1,128 @@
+#include "thread-pool.h"
+
+#include <algorithm>
+
+namespace speedofsound {
+
+ThreadPool::ThreadPool(const size_t thread_count)
+    : thread_count_(thread_count > 0
+                        ? thread_count
+                        : std::max<size_t>(
+                              1, std::thread::hardware_concurrency())),
+      shares_(new Share[thread_count_]),
+      task_(nullptr),
+      grain_(1),
+      generation_(0),
+      active_workers_(0),
+      stop_(false) {
+  for (size_t i = 0; i < thread_count_; ++i) {
+    shares_[i].begin_ = 0;
+    shares_[i].end_ = 0;
+  }
+  // Share 0 belongs to the calling thread
+  for (size_t i = 1; i < thread_count_; ++i) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  start_.notify_all();
+  for (auto& worker : workers_) worker.join();
+}
+
+auto ThreadPool::GetThreadCount() const -> size_t { return thread_count_; }
+
+auto ThreadPool::ParallelFor(const size_t count, const size_t grain,
+                             const Task& task) -> void {
+  const auto chunk = grain > 0 ? grain : 1;
+  if (thread_count_ == 1 || count <= chunk) {
+    for (size_t begin = 0; begin < count; begin += chunk) {
+      task(begin, begin + chunk < count ? begin + chunk : count);
+    }
+    return;
+  }
+  std::lock_guard<std::mutex> parallel_for_lock(parallel_for_mutex_);
+  for (size_t i = 0; i < thread_count_; ++i) {
+    std::lock_guard<std::mutex> lock(shares_[i].mutex_);
+    shares_[i].begin_ = count * i / thread_count_;
+    shares_[i].end_ = count * (i + 1) / thread_count_;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    grain_ = chunk;
+    active_workers_ = workers_.size();
+    ++generation_;
+  }
+  start_.notify_all();
+  Work(0);
+  std::unique_lock<std::mutex> lock(mutex_);
+  finish_.wait(lock, [this] { return active_workers_ == 0; });
+  task_ = nullptr;
+}
+
+auto ThreadPool::WorkerLoop(const size_t index) -> void {
+  uint64_t generation = 0;
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      start_.wait(lock, [this, generation] {
+        return stop_ || generation_ != generation;
+      });
+      if (stop_) return;
+      generation = generation_;
+    }
+    Work(index);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--active_workers_ == 0) finish_.notify_one();
+  }
+}
+
+auto ThreadPool::Work(const size_t index) -> void {
+  size_t begin, end;
+  while (Take(index, &begin, &end) || Steal(index, &begin, &end)) {
+    (*task_)(begin, end);
+  }
+}
+
+auto ThreadPool::Take(const size_t index, size_t* begin, size_t* end)
+    -> bool {
+  auto& share = shares_[index];
+  std::lock_guard<std::mutex> lock(share.mutex_);
+  if (share.begin_ == share.end_) return false;
+  *begin = share.begin_;
+  *end = share.end_ - share.begin_ > grain_ ? share.begin_ + grain_
+                                            : share.end_;
+  share.begin_ = *end;
+  return true;
+}
+
+auto ThreadPool::Steal(const size_t index, size_t* begin, size_t* end)
+    -> bool {
+  for (size_t i = 1; i < thread_count_; ++i) {
+    auto& victim = shares_[(index + i) % thread_count_];
+    size_t stolen_begin, stolen_end;
+    {
+      std::lock_guard<std::mutex> lock(victim.mutex_);
+      const auto remaining = victim.end_ - victim.begin_;
+      if (remaining == 0) continue;
+      stolen_end = victim.end_;
+      stolen_begin = remaining > grain_ ? victim.end_ - remaining / 2
+                                        : victim.begin_;
+      victim.end_ = stolen_begin;
+    }
+    {
+      std::lock_guard<std::mutex> lock(shares_[index].mutex_);
+      shares_[index].begin_ = stolen_begin;
+      shares_[index].end_ = stolen_end;
+    }
+    return Take(index, begin, end);
+  }
+  return false;
+}
+
+}  // namespace speedofsound
@@ -0,0 +1,66 @@
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace speedofsound {
+
+// Fixed set of threads that run index ranges with work stealing. The calling
+// thread takes part in every ParallelFor, so a pool of one thread runs inline.
+class ThreadPool {
+ public:
+  typedef std::function<void(size_t begin, size_t end)> Task;
+
+  // Zero selects one thread per hardware thread
+  explicit ThreadPool(const size_t thread_count = 0);
+  ThreadPool(const ThreadPool&) = delete;
+  auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+  ~ThreadPool();
+  auto GetThreadCount() const -> size_t;
+  // Calls task on disjoint ranges of at most grain indices that together
+  // cover [0, count) and returns once all of them have finished. Each thread
+  // starts with an equal share; a thread that runs out steals half of what is
+  // left of another thread's share.
+  auto ParallelFor(const size_t count, const size_t grain, const Task& task)
+      -> void;
+
+ private:
+  // Padded to a cache line so that threads claiming work do not contend
+  class Share {
+   public:
+    std::mutex mutex_;
+    size_t begin_;
+    size_t end_;
+    char padding_[64];
+  };
+
+  auto WorkerLoop(const size_t index) -> void;
+  auto Work(const size_t index) -> void;
+  auto Take(const size_t index, size_t* begin, size_t* end) -> bool;
+  auto Steal(const size_t index, size_t* begin, size_t* end) -> bool;
+
+  const size_t thread_count_;
+  std::unique_ptr<Share[]> shares_;
+  std::vector<std::thread> workers_;
+  std::mutex parallel_for_mutex_;
+  std::mutex mutex_;
+  std::condition_variable start_;
+  std::condition_variable finish_;
+  const Task* task_;
+  size_t grain_;
+  uint64_t generation_;
+  size_t active_workers_;
+  bool stop_;
+};
+
+}  // namespace speedofsound
+
+#endif  // THREAD_POOL_H_
@@ -0,0 +1,107 @@
+#include "dual_test.h"
+
+#include <math.h>
+
+#include "speed-of-sound-theory-inl.h"
+
+auto DualTest::AutomaticRate(const speedofsound::Environment& environment,
+                             speedofsound::EnvironmentRate* rate) -> double {
+  const auto t = Dual4::Variable(environment.temperature_, 0);
+  const auto h = Dual4::Variable(environment.humidity_, 1);
+  const auto p = Dual4::Variable(environment.pressure_, 2);
+  const auto xc = Dual4::Variable(environment.co2_mole_fraction_, 3);
+  const auto T = speedofsound::theory::T(t);
+  const auto F = speedofsound::theory::F(p, t);
+  // Separate statements, since the order of evaluation of arguments is
+  // unspecified
+  double dPsv_dt;
+  const auto psv_value =
+      speedofsound::theory::FastPsvAndDerivative(T.value_, &dPsv_dt);
+  const auto Psv = speedofsound::Chain(psv_value, dPsv_dt, T);
+  const auto Xw = speedofsound::theory::Xw(h, F, Psv, p);
+  const auto C = speedofsound::theory::C(t, p, Xw, xc);
+  rate->temperature_rate_ = C.gradient_[0];
+  rate->humidity_rate_ = C.gradient_[1];
+  rate->pressure_rate_ = C.gradient_[2];
+  rate->co2_mole_fraction_rate_ = C.gradient_[3];
+  return C.value_;
+}
+
+auto DualTest::Tolerance(const double rate) const -> double {
+  return kRelativeTolerance * fabs(rate) + kAbsoluteTolerance;
+}
+
+TEST_F(DualTest, ArithmeticRules) {
+  const auto x = Dual2::Variable(3.0, 0);
+  const auto y = Dual2::Variable(2.0, 1);
+  const auto sum = x + y * 2.0 - 1.0;
+  EXPECT_DOUBLE_EQ(6.0, sum.value_);
+  EXPECT_DOUBLE_EQ(1.0, sum.gradient_[0]);
+  EXPECT_DOUBLE_EQ(2.0, sum.gradient_[1]);
+  const auto product = x * y;
+  EXPECT_DOUBLE_EQ(6.0, product.value_);
+  EXPECT_DOUBLE_EQ(2.0, product.gradient_[0]);
+  EXPECT_DOUBLE_EQ(3.0, product.gradient_[1]);
+  const auto quotient = x / y;
+  EXPECT_DOUBLE_EQ(1.5, quotient.value_);
+  EXPECT_DOUBLE_EQ(0.5, quotient.gradient_[0]);
+  EXPECT_DOUBLE_EQ(-0.75, quotient.gradient_[1]);
+  const auto reciprocal = 1.0 / x;
+  EXPECT_DOUBLE_EQ(1.0 / 3.0, reciprocal.value_);
+  EXPECT_DOUBLE_EQ(-1.0 / 9.0, reciprocal.gradient_[0]);
+  EXPECT_DOUBLE_EQ(0.0, reciprocal.gradient_[1]);
+  const auto negation = 1.0 - x;
+  EXPECT_DOUBLE_EQ(-2.0, negation.value_);
+  EXPECT_DOUBLE_EQ(-1.0, negation.gradient_[0]);
+}
+
+TEST_F(DualTest, ChainRule) {
+  const auto x = Dual2::Variable(0.5, 0);
+  const auto y = Dual2::Variable(2.0, 1);
+  const auto xy = x * y;
+  const auto exp_xy = speedofsound::Chain(exp(xy.value_), exp(xy.value_), xy);
+  EXPECT_DOUBLE_EQ(exp(1.0), exp_xy.value_);
+  EXPECT_DOUBLE_EQ(2.0 * exp(1.0), exp_xy.gradient_[0]);
+  EXPECT_DOUBLE_EQ(0.5 * exp(1.0), exp_xy.gradient_[1]);
+}
+
+TEST_F(DualTest, AutomaticRateMatchesComputeRate) {
+  using speedofsound::theory::kMaxCO2MoleFraction;
+  using speedofsound::theory::kMaxHumidity;
+  using speedofsound::theory::kMaxPressure;
+  using speedofsound::theory::kMaxTemperature;
+  using speedofsound::theory::kMinCO2MoleFraction;
+  using speedofsound::theory::kMinHumidity;
+  using speedofsound::theory::kMinPressure;
+  using speedofsound::theory::kMinTemperature;
+  speedofsound::Environment environment;
+  speedofsound::EnvironmentRate expected, actual;
+  for (auto t = kMinTemperature; t <= kMaxTemperature;
+       t += (kMaxTemperature - kMinTemperature) * kIncrementFactor) {
+    for (auto h = kMinHumidity; h <= kMaxHumidity;
+         h += (kMaxHumidity - kMinHumidity) * kIncrementFactor) {
+      for (auto p = kMinPressure; p <= kMaxPressure;
+           p += (kMaxPressure - kMinPressure) * kIncrementFactor) {
+        for (auto xc = kMinCO2MoleFraction; xc <= kMaxCO2MoleFraction;
+             xc += (kMaxCO2MoleFraction - kMinCO2MoleFraction) *
+                   kIncrementFactor) {
+          environment.temperature_ = t;
+          environment.humidity_ = h;
+          environment.pressure_ = p;
+          environment.co2_mole_fraction_ = xc;
+          const auto c = speed_of_sound_.ComputeRate(environment, &expected);
+          ASSERT_EQ(c, AutomaticRate(environment, &actual));
+          ASSERT_NEAR(expected.temperature_rate_, actual.temperature_rate_,
+                      Tolerance(expected.temperature_rate_));
+          ASSERT_NEAR(expected.humidity_rate_, actual.humidity_rate_,
+                      Tolerance(expected.humidity_rate_));
+          ASSERT_NEAR(expected.pressure_rate_, actual.pressure_rate_,
+                      Tolerance(expected.pressure_rate_));
+          ASSERT_NEAR(expected.co2_mole_fraction_rate_,
+                      actual.co2_mole_fraction_rate_,
+                      Tolerance(expected.co2_mole_fraction_rate_));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,27 @@
+#ifndef TEST_DUAL_TEST_H_
+#define TEST_DUAL_TEST_H_
+
+#include "gtest/gtest.h"
+
+#include "dual.h"
+#include "speed-of-sound.h"
+
+class DualTest : public ::testing::Test {
+ public:
+  typedef speedofsound::Dual<double, 2> Dual2;
+  typedef speedofsound::Dual<double, 4> Dual4;
+
+  // Speed of sound and its gradient by forward-mode differentiation of the
+  // theory functions
+  static auto AutomaticRate(const speedofsound::Environment& environment,
+                            speedofsound::EnvironmentRate* rate) -> double;
+  // The pressure rate cancels to zero in dry air, so an absolute term is kept
+  auto Tolerance(const double rate) const -> double;
+
+  speedofsound::SpeedOfSound speed_of_sound_;
+  const double kIncrementFactor = 10.0 / 100.0;
+  const double kRelativeTolerance = 1.0e-13;
+  const double kAbsoluteTolerance = 1.0e-18;
+};
+
+#endif  // TEST_DUAL_TEST_H_
@@ -0,0 +1,126 @@
+#include "speed-of-sound-accuracy_test.h"
+
+#include <string.h>
+
+using speedofsound::AccuracyEngine;
+
+AccuracySweepTest::AccuracySweepTest() {
+  options_.temperature_points_ = 7;
+  options_.humidity_points_ = 6;
+  options_.pressure_points_ = 5;
+  options_.co2_mole_fraction_points_ = 3;
+  options_.temperature_regions_ = 3;
+  options_.humidity_regions_ = 2;
+}
+
+auto AccuracySweepTest::Run(
+    const size_t thread_count, const std::vector<AccuracyEngine>& engines,
+    std::vector<speedofsound::EngineAccuracy>* results) -> bool {
+  speedofsound::ThreadPool pool(thread_count);
+  speedofsound::AccuracySweep sweep(&pool);
+  return sweep.Run(options_, engines, results);
+}
+
+TEST_F(AccuracySweepTest, EngineNamesRoundTrip) {
+  for (size_t i = 0; i < speedofsound::kAccuracyEngineCount; ++i) {
+    const auto engine = static_cast<AccuracyEngine>(i);
+    auto parsed = AccuracyEngine::kCompute;
+    EXPECT_TRUE(speedofsound::ParseAccuracyEngine(
+        speedofsound::AccuracyEngineName(engine), &parsed));
+    EXPECT_EQ(parsed, engine);
+  }
+  auto parsed = AccuracyEngine::kCompute;
+  EXPECT_FALSE(speedofsound::ParseAccuracyEngine("exact", &parsed));
+  EXPECT_EQ(parsed, AccuracyEngine::kCompute);
+}
+
+TEST_F(AccuracySweepTest, DefaultOptionsAreValid) {
+  EXPECT_TRUE(speedofsound::AccuracySweepOptions().Validate());
+  EXPECT_TRUE(options_.Validate());
+}
+
+TEST_F(AccuracySweepTest, RejectsInvalidOptions) {
+  std::vector<speedofsound::EngineAccuracy> results;
+  options_.pressure_points_ = 1;
+  EXPECT_FALSE(Run(1, {AccuracyEngine::kQuickCompute}, &results));
+  options_.pressure_points_ = 5;
+  options_.humidity_regions_ = 7;
+  EXPECT_FALSE(Run(1, {AccuracyEngine::kQuickCompute}, &results));
+  options_.humidity_regions_ = 2;
+  options_.surrogate_tolerance_ = 0.0;
+  EXPECT_FALSE(Run(1, {AccuracyEngine::kQuickCompute}, &results));
+  EXPECT_TRUE(results.empty());
+}
+
+TEST_F(AccuracySweepTest, RejectsDuplicateEngines) {
+  std::vector<speedofsound::EngineAccuracy> results;
+  EXPECT_FALSE(Run(1,
+                   {AccuracyEngine::kApproximate, AccuracyEngine::kCompute,
+                    AccuracyEngine::kApproximate},
+                   &results));
+  EXPECT_TRUE(results.empty());
+}
+
+TEST_F(AccuracySweepTest, RegionsCoverTheGrid) {
+  std::vector<speedofsound::EngineAccuracy> results;
+  ASSERT_TRUE(Run(1, {AccuracyEngine::kApproximate}, &results));
+  ASSERT_EQ(results.size(), 1UL);
+  const auto& result = results[0];
+  EXPECT_EQ(result.engine_, AccuracyEngine::kApproximate);
+  EXPECT_EQ(result.total_.count_, 7UL * 6 * 5 * 3);
+  ASSERT_EQ(result.regions_.size(), 3UL * 2);
+  uint64_t count = 0;
+  double max_error = 0.0;
+  for (const auto& region : result.regions_) {
+    EXPECT_GT(region.count_, 0UL);
+    EXPECT_LE(region.max_error_, result.total_.max_error_);
+    count += region.count_;
+    max_error = region.max_error_ > max_error ? region.max_error_ : max_error;
+  }
+  EXPECT_EQ(count, result.total_.count_);
+  EXPECT_EQ(max_error, result.total_.max_error_);
+  // Exact at the standard environment, so the error grows away from it
+  EXPECT_GT(result.total_.max_error_, result.total_.MeanError());
+  EXPECT_GT(result.nanoseconds_per_call_, 0.0);
+}
+
+TEST_F(AccuracySweepTest, ErrorsMatchTheEngines) {
+  const std::vector<AccuracyEngine> engines = {
+      AccuracyEngine::kCompute, AccuracyEngine::kQuickCompute,
+      AccuracyEngine::kQuickComputeBatch, AccuracyEngine::kFloatQuickCompute,
+      AccuracyEngine::kApproximate, AccuracyEngine::kAnchored};
+  std::vector<speedofsound::EngineAccuracy> results;
+  ASSERT_TRUE(Run(1, engines, &results));
+  ASSERT_EQ(results.size(), engines.size());
+  for (size_t i = 0; i < engines.size(); ++i) {
+    EXPECT_EQ(results[i].engine_, engines[i]);
+  }
+  EXPECT_LT(results[0].total_.max_error_, 1.0e-10);
+  EXPECT_LT(results[1].total_.max_error_, 1.0e-10);
+  EXPECT_LT(results[2].total_.max_error_, 1.0e-10);
+  EXPECT_LT(results[3].total_.max_error_, 1.0e-3);
+  EXPECT_GT(results[3].total_.max_error_, results[1].total_.max_error_);
+  EXPECT_GT(results[4].total_.max_error_, options_.surrogate_tolerance_);
+  EXPECT_LE(results[5].total_.max_error_, options_.surrogate_tolerance_);
+}
+
+TEST_F(AccuracySweepTest, ResultsDoNotDependOnThreads) {
+  const std::vector<AccuracyEngine> engines = {
+      AccuracyEngine::kQuickCompute, AccuracyEngine::kQuadraticApproximate,
+      AccuracyEngine::kAnchored};
+  std::vector<speedofsound::EngineAccuracy> one;
+  std::vector<speedofsound::EngineAccuracy> three;
+  ASSERT_TRUE(Run(1, engines, &one));
+  ASSERT_TRUE(Run(3, engines, &three));
+  ASSERT_EQ(one.size(), three.size());
+  for (size_t i = 0; i < one.size(); ++i) {
+    EXPECT_EQ(one[i].total_.max_error_, three[i].total_.max_error_);
+    EXPECT_EQ(one[i].total_.sum_error_, three[i].total_.sum_error_);
+    ASSERT_EQ(one[i].regions_.size(), three[i].regions_.size());
+    for (size_t r = 0; r < one[i].regions_.size(); ++r) {
+      EXPECT_EQ(one[i].regions_[r].sum_error_,
+                three[i].regions_[r].sum_error_);
+      EXPECT_EQ(one[i].regions_[r].count_, three[i].regions_[r].count_);
+    }
+  }
+}
@@ -0,0 +1,20 @@
+#ifndef TEST_SPEED_OF_SOUND_ACCURACY_TEST_H_
+#define TEST_SPEED_OF_SOUND_ACCURACY_TEST_H_
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "speed-of-sound-accuracy.h"
+
+class AccuracySweepTest : public ::testing::Test {
+ public:
+  AccuracySweepTest();
+  auto Run(const size_t thread_count,
+           const std::vector<speedofsound::AccuracyEngine>& engines,
+           std::vector<speedofsound::EngineAccuracy>* results) -> bool;
+
+  speedofsound::AccuracySweepOptions options_;
+};
+
+#endif  // TEST_SPEED_OF_SOUND_ACCURACY_TEST_H_
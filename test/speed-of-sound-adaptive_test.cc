@@ -0,0 +1,114 @@
+#include "speed-of-sound-adaptive_test.h"
+
+#include <math.h>
+
+AdaptiveSpeedOfSoundTest::AdaptiveSpeedOfSoundTest()
+    : adaptive_speed_of_sound_(kTolerance) {}
+
+auto AdaptiveSpeedOfSoundTest::StreamEnvironment(const int i) const
+    -> speedofsound::Environment {
+  const auto phase = 2.0 * M_PI * i / kStreamLength;
+  speedofsound::Environment environment;
+  environment.temperature_ = 15.0 + 10.0 * sin(phase);
+  environment.humidity_ = 0.5 + 0.4 * sin(3.0 * phase);
+  environment.pressure_ = 90000.0 + 8000.0 * cos(2.0 * phase);
+  environment.co2_mole_fraction_ = 0.005 + 0.004 * cos(phase);
+  return environment;
+}
+
+TEST_F(AdaptiveSpeedOfSoundTest, ConstructorDefaultValues) {
+  EXPECT_DOUBLE_EQ(adaptive_speed_of_sound_.GetTolerance(), kTolerance);
+  EXPECT_EQ(adaptive_speed_of_sound_.GetApproximationCount(), 0UL);
+  EXPECT_EQ(adaptive_speed_of_sound_.GetRecomputeCount(), 0UL);
+  EXPECT_DOUBLE_EQ(adaptive_speed_of_sound_.GetSpeedOfSound()
+                       .GetInitEnvironment()
+                       .temperature_,
+                   speedofsound::theory::kStdTemperature);
+  EXPECT_DOUBLE_EQ(
+      adaptive_speed_of_sound_.EstimateError(speedofsound::Environment()),
+      0.0);
+}
+
+TEST_F(AdaptiveSpeedOfSoundTest, EstimateErrorBoundsApproximation) {
+  speedofsound::Environment e_init;
+  speedofsound::Environment e;
+  for (auto t = kTMin; t <= kTMax; t += (kTMax - kTMin) * kIncrementFactor) {
+    for (auto h = kHMin; h <= kHMax; h += (kHMax - kHMin) * kIncrementFactor) {
+      for (auto p = kPMin; p <= kPMax;
+           p += (kPMax - kPMin) * kIncrementFactor) {
+        for (auto xc = kXcMin; xc <= kXcMax;
+             xc += (kXcMax - kXcMin) * kIncrementFactor) {
+          e_init.temperature_ = t;
+          e_init.humidity_ = h;
+          e_init.pressure_ = p;
+          e_init.co2_mole_fraction_ = xc;
+          speed_of_sound_.Compute(e_init);
+          speedofsound::AdaptiveSpeedOfSound adaptive_speed_of_sound(
+              e_init, kTolerance);
+          // Opposite corner of the valid range
+          e.temperature_ = kTMax + kTMin - t;
+          e.humidity_ = kHMax + kHMin - h;
+          e.pressure_ = kPMax + kPMin - p;
+          e.co2_mole_fraction_ = kXcMax + kXcMin - xc;
+          const auto error = fabs(speed_of_sound_.Approximate(e) -
+                                  speed_of_sound_.QuickCompute(e));
+          ASSERT_LE(error, adaptive_speed_of_sound.EstimateError(e));
+        }
+      }
+    }
+  }
+}
+
+TEST_F(AdaptiveSpeedOfSoundTest, ApproximationWithinTolerance) {
+  for (auto i = 0; i < kStreamLength; ++i) {
+    const auto e = StreamEnvironment(i);
+    const auto c = speed_of_sound_.QuickCompute(e);
+    ASSERT_NEAR(adaptive_speed_of_sound_.Approximate(e), c, kTolerance);
+  }
+  EXPECT_EQ(adaptive_speed_of_sound_.GetApproximationCount() +
+                adaptive_speed_of_sound_.GetRecomputeCount(),
+            static_cast<unsigned long>(kStreamLength));
+  EXPECT_GT(adaptive_speed_of_sound_.GetRecomputeCount(), 0UL);
+  EXPECT_LT(adaptive_speed_of_sound_.GetRecomputeCount(),
+            adaptive_speed_of_sound_.GetApproximationCount());
+}
+
+TEST_F(AdaptiveSpeedOfSoundTest, RecomputeUpdatesInitEnvironment) {
+  speedofsound::Environment e;
+  e.temperature_ = kTMax;
+  const auto c = adaptive_speed_of_sound_.Approximate(e);
+  EXPECT_EQ(adaptive_speed_of_sound_.GetRecomputeCount(), 1UL);
+  EXPECT_DOUBLE_EQ(c, speed_of_sound_.QuickCompute(e));
+  EXPECT_DOUBLE_EQ(adaptive_speed_of_sound_.GetSpeedOfSound()
+                       .GetInitEnvironment()
+                       .temperature_,
+                   kTMax);
+  EXPECT_DOUBLE_EQ(adaptive_speed_of_sound_.EstimateError(e), 0.0);
+  adaptive_speed_of_sound_.Approximate(e);
+  EXPECT_EQ(adaptive_speed_of_sound_.GetApproximationCount(), 1UL);
+  EXPECT_EQ(adaptive_speed_of_sound_.GetRecomputeCount(), 1UL);
+}
+
+TEST_F(AdaptiveSpeedOfSoundTest, ResetCounters) {
+  for (auto i = 0; i < kStreamLength; i += 100) {
+    adaptive_speed_of_sound_.Approximate(StreamEnvironment(i));
+  }
+  adaptive_speed_of_sound_.ResetCounters();
+  EXPECT_EQ(adaptive_speed_of_sound_.GetApproximationCount(), 0UL);
+  EXPECT_EQ(adaptive_speed_of_sound_.GetRecomputeCount(), 0UL);
+}
+
+TEST_F(AdaptiveSpeedOfSoundTest, InvalidToleranceAlwaysRecomputes) {
+  EXPECT_TRUE(adaptive_speed_of_sound_.IsValid());
+  for (const auto tolerance : {0.0, -1.0, static_cast<double>(NAN)}) {
+    speedofsound::AdaptiveSpeedOfSound adaptive_speed_of_sound(tolerance);
+    EXPECT_FALSE(adaptive_speed_of_sound.IsValid());
+    for (auto i = 1; i <= 100; ++i) {
+      const auto e = StreamEnvironment(i);
+      EXPECT_DOUBLE_EQ(adaptive_speed_of_sound.Approximate(e),
+                       speed_of_sound_.QuickCompute(e));
+    }
+    EXPECT_EQ(adaptive_speed_of_sound.GetApproximationCount(), 0UL);
+    EXPECT_EQ(adaptive_speed_of_sound.GetRecomputeCount(), 100UL);
+  }
+}
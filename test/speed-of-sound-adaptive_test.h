@@ -0,0 +1,31 @@
+#ifndef TEST_SPEED_OF_SOUND_ADAPTIVE_TEST_H_
+#define TEST_SPEED_OF_SOUND_ADAPTIVE_TEST_H_
+
+#include "gtest/gtest.h"
+
+#include "speed-of-sound-adaptive.h"
+#include "speed-of-sound.h"
+
+class AdaptiveSpeedOfSoundTest : public ::testing::Test {
+ public:
+  AdaptiveSpeedOfSoundTest();
+
+  // Slowly drifting sensor readings within the valid range
+  auto StreamEnvironment(const int i) const -> speedofsound::Environment;
+
+  const double kTolerance = 0.01;
+  speedofsound::SpeedOfSound speed_of_sound_;
+  speedofsound::AdaptiveSpeedOfSound adaptive_speed_of_sound_;
+  const int kStreamLength = 100000;
+  const double kIncrementFactor = 10.0 / 100.0;
+  const double kTMin = speedofsound::theory::kMinTemperature;
+  const double kTMax = speedofsound::theory::kMaxTemperature;
+  const double kHMin = speedofsound::theory::kMinHumidity;
+  const double kHMax = speedofsound::theory::kMaxHumidity;
+  const double kPMin = speedofsound::theory::kMinPressure;
+  const double kPMax = speedofsound::theory::kMaxPressure;
+  const double kXcMin = speedofsound::theory::kMinCO2MoleFraction;
+  const double kXcMax = speedofsound::theory::kMaxCO2MoleFraction;
+};
+
+#endif  // TEST_SPEED_OF_SOUND_ADAPTIVE_TEST_H_
@@ -0,0 +1,88 @@
+#include "speed-of-sound-anchored_test.h"
+
+#include <math.h>
+
+AnchoredSpeedOfSoundTest::AnchoredSpeedOfSoundTest()
+    : anchored_speed_of_sound_(kTolerance) {}
+
+TEST_F(AnchoredSpeedOfSoundTest, ConstructorDefaultValues) {
+  EXPECT_TRUE(anchored_speed_of_sound_.IsValid());
+  EXPECT_DOUBLE_EQ(anchored_speed_of_sound_.GetTolerance(), kTolerance);
+  EXPECT_LE(anchored_speed_of_sound_.GetErrorBound(), kTolerance);
+  EXPECT_GT(anchored_speed_of_sound_.GetCellCount(), 1UL);
+  EXPECT_LE(anchored_speed_of_sound_.GetCellCount(),
+            speedofsound::AnchoredSpeedOfSound::kMaxCells);
+  EXPECT_EQ(anchored_speed_of_sound_.GetAnchorCount(), 0UL);
+}
+
+TEST_F(AnchoredSpeedOfSoundTest, TighterToleranceNeedsMoreCells) {
+  const speedofsound::AnchoredSpeedOfSound coarse(10.0 * kTolerance);
+  EXPECT_LT(coarse.GetCellCount(), anchored_speed_of_sound_.GetCellCount());
+  EXPECT_EQ(speedofsound::AnchoredSpeedOfSound(100.0).GetCellCount(), 1UL);
+}
+
+TEST_F(AnchoredSpeedOfSoundTest, UnreachableToleranceStopsAtMaxCells) {
+  const speedofsound::AnchoredSpeedOfSound fine(1.0e-9);
+  EXPECT_EQ(fine.GetCellCount(),
+            speedofsound::AnchoredSpeedOfSound::kMaxCells);
+  EXPECT_GT(fine.GetErrorBound(), 1.0e-9);
+  EXPECT_LT(fine.GetErrorBound(), kTolerance);
+}
+
+TEST_F(AnchoredSpeedOfSoundTest, InvalidToleranceLeavesOneCell) {
+  for (const auto tolerance : {0.0, -1.0, static_cast<double>(NAN)}) {
+    speedofsound::AnchoredSpeedOfSound invalid(tolerance);
+    EXPECT_FALSE(invalid.IsValid());
+    EXPECT_EQ(invalid.GetCellCount(), 1UL);
+    const speedofsound::Environment e;
+    EXPECT_NEAR(invalid.Approximate(e), speed_of_sound_.QuickCompute(e),
+                invalid.GetErrorBound());
+  }
+}
+
+TEST_F(AnchoredSpeedOfSoundTest, ApproximationWithinTolerance) {
+  speedofsound::Environment e;
+  for (auto t = kTMin; t <= kTMax; t += (kTMax - kTMin) * kIncrementFactor) {
+    for (auto h = kHMin; h <= kHMax; h += (kHMax - kHMin) * kIncrementFactor) {
+      for (auto p = kPMin; p <= kPMax;
+           p += (kPMax - kPMin) * kIncrementFactor) {
+        for (auto xc = kXcMin; xc <= kXcMax;
+             xc += (kXcMax - kXcMin) * kIncrementFactor) {
+          e.temperature_ = t;
+          e.humidity_ = h;
+          e.pressure_ = p;
+          e.co2_mole_fraction_ = xc;
+          ASSERT_NEAR(anchored_speed_of_sound_.Approximate(e),
+                      speed_of_sound_.QuickCompute(e), kTolerance);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(AnchoredSpeedOfSoundTest, AnchorsAddedOnFirstVisit) {
+  speedofsound::Environment e;
+  anchored_speed_of_sound_.Approximate(e);
+  EXPECT_EQ(anchored_speed_of_sound_.GetAnchorCount(), 1UL);
+  // Same cell
+  e.temperature_ += 1.0e-6;
+  anchored_speed_of_sound_.Approximate(e);
+  EXPECT_EQ(anchored_speed_of_sound_.GetAnchorCount(), 1UL);
+  e.temperature_ = kTMin;
+  anchored_speed_of_sound_.Approximate(e);
+  e.temperature_ = kTMax;
+  anchored_speed_of_sound_.Approximate(e);
+  EXPECT_EQ(anchored_speed_of_sound_.GetAnchorCount(), 3UL);
+}
+
+TEST_F(AnchoredSpeedOfSoundTest, OutOfRangeUsesEdgeCell) {
+  speedofsound::Environment e;
+  e.temperature_ = kTMax;
+  const auto c_edge = anchored_speed_of_sound_.Approximate(e);
+  e.temperature_ = kTMax + 5.0;
+  const auto c_outside = anchored_speed_of_sound_.Approximate(e);
+  EXPECT_EQ(anchored_speed_of_sound_.GetAnchorCount(), 1UL);
+  EXPECT_GT(c_outside, c_edge);
+  e.temperature_ = NAN;
+  EXPECT_TRUE(isnan(anchored_speed_of_sound_.Approximate(e)));
+}
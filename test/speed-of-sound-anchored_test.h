@@ -0,0 +1,27 @@
+#ifndef TEST_SPEED_OF_SOUND_ANCHORED_TEST_H_
+#define TEST_SPEED_OF_SOUND_ANCHORED_TEST_H_
+
+#include "gtest/gtest.h"
+
+#include "speed-of-sound-anchored.h"
+#include "speed-of-sound.h"
+
+class AnchoredSpeedOfSoundTest : public ::testing::Test {
+ public:
+  AnchoredSpeedOfSoundTest();
+
+  const double kTolerance = 0.01;
+  speedofsound::SpeedOfSound speed_of_sound_;
+  speedofsound::AnchoredSpeedOfSound anchored_speed_of_sound_;
+  const double kIncrementFactor = 7.0 / 100.0;
+  const double kTMin = speedofsound::theory::kMinTemperature;
+  const double kTMax = speedofsound::theory::kMaxTemperature;
+  const double kHMin = speedofsound::theory::kMinHumidity;
+  const double kHMax = speedofsound::theory::kMaxHumidity;
+  const double kPMin = speedofsound::theory::kMinPressure;
+  const double kPMax = speedofsound::theory::kMaxPressure;
+  const double kXcMin = speedofsound::theory::kMinCO2MoleFraction;
+  const double kXcMax = speedofsound::theory::kMaxCO2MoleFraction;
+};
+
+#endif  // TEST_SPEED_OF_SOUND_ANCHORED_TEST_H_
@@ -0,0 +1,242 @@
+#include "speed-of-sound-batch_test.h"
+
+#include <math.h>
+#include <string.h>
+
+SpeedOfSoundBatchTest::SpeedOfSoundBatchTest() {
+  using speedofsound::theory::kMaxCO2MoleFraction;
+  using speedofsound::theory::kMaxHumidity;
+  using speedofsound::theory::kMaxPressure;
+  using speedofsound::theory::kMaxTemperature;
+  using speedofsound::theory::kMinCO2MoleFraction;
+  using speedofsound::theory::kMinHumidity;
+  using speedofsound::theory::kMinPressure;
+  using speedofsound::theory::kMinTemperature;
+  const auto t_step = (kMaxTemperature - kMinTemperature) * kIncrementFactor;
+  const auto h_step = (kMaxHumidity - kMinHumidity) * kIncrementFactor;
+  const auto p_step = (kMaxPressure - kMinPressure) * kIncrementFactor;
+  const auto xc_step =
+      (kMaxCO2MoleFraction - kMinCO2MoleFraction) * kIncrementFactor;
+  speedofsound::Environment environment;
+  speedofsound::BasicSpeedOfSound<float> float_speed_of_sound;
+  for (auto t = kMinTemperature; t <= kMaxTemperature; t += t_step) {
+    for (auto h = kMinHumidity; h <= kMaxHumidity; h += h_step) {
+      for (auto p = kMinPressure; p <= kMaxPressure; p += p_step) {
+        for (auto xc = kMinCO2MoleFraction; xc <= kMaxCO2MoleFraction;
+             xc += xc_step) {
+          environment.temperature_ = t;
+          environment.humidity_ = h;
+          environment.pressure_ = p;
+          environment.co2_mole_fraction_ = xc;
+          temperature_.push_back(t);
+          humidity_.push_back(h);
+          pressure_.push_back(p);
+          co2_mole_fraction_.push_back(xc);
+          expected_.push_back(speed_of_sound_.QuickCompute(environment));
+          const speedofsound::BasicEnvironment<float> float_environment(
+              static_cast<float>(t), static_cast<float>(h),
+              static_cast<float>(p), static_cast<float>(xc));
+          float_temperature_.push_back(float_environment.temperature_);
+          float_humidity_.push_back(float_environment.humidity_);
+          float_pressure_.push_back(float_environment.pressure_);
+          float_co2_mole_fraction_.push_back(
+              float_environment.co2_mole_fraction_);
+          float_expected_.push_back(
+              float_speed_of_sound.QuickCompute(float_environment));
+        }
+      }
+    }
+  }
+}
+
+auto SpeedOfSoundBatchTest::Arrays() const -> speedofsound::EnvironmentArrays {
+  return speedofsound::EnvironmentArrays(
+      temperature_.data(), humidity_.data(), pressure_.data(),
+      co2_mole_fraction_.data());
+}
+
+auto SpeedOfSoundBatchTest::FloatArrays() const
+    -> speedofsound::FloatEnvironmentArrays {
+  return speedofsound::FloatEnvironmentArrays(
+      float_temperature_.data(), float_humidity_.data(),
+      float_pressure_.data(), float_co2_mole_fraction_.data());
+}
+
+auto SpeedOfSoundBatchTest::UlpDistance(const double a, const double b)
+    -> int64_t {
+  int64_t a_bits, b_bits;
+  memcpy(&a_bits, &a, sizeof(a));
+  memcpy(&b_bits, &b, sizeof(b));
+  return a_bits > b_bits ? a_bits - b_bits : b_bits - a_bits;
+}
+
+auto SpeedOfSoundBatchTest::UlpDistance(const float a, const float b)
+    -> int64_t {
+  int32_t a_bits, b_bits;
+  memcpy(&a_bits, &a, sizeof(a));
+  memcpy(&b_bits, &b, sizeof(b));
+  return a_bits > b_bits ? int64_t{a_bits} - b_bits : int64_t{b_bits} - a_bits;
+}
+
+TEST_F(SpeedOfSoundBatchTest, ScalarKernelMatchesQuickCompute) {
+  std::vector<double> c(expected_.size());
+  ASSERT_TRUE(speedofsound::QuickComputeBatch(
+      Arrays(), c.size(), c.data(), speedofsound::BatchKernel::kScalar));
+  for (size_t i = 0; i < c.size(); ++i) {
+    ASSERT_EQ(expected_[i], c[i]);
+  }
+}
+
+TEST_F(SpeedOfSoundBatchTest, SimdKernelsWithinUlpBound) {
+  for (const auto kernel : kSimdKernels) {
+    if (!speedofsound::BatchKernelSupported(kernel)) continue;
+    std::vector<double> c(expected_.size());
+    ASSERT_TRUE(speedofsound::QuickComputeBatch(Arrays(), c.size(), c.data(),
+                                                kernel));
+    for (size_t i = 0; i < c.size(); ++i) {
+      ASSERT_LE(UlpDistance(expected_[i], c[i]),
+                speedofsound::kBatchMaxUlpError);
+    }
+  }
+}
+
+TEST_F(SpeedOfSoundBatchTest, KernelsHandlePartialVectors) {
+  const size_t kMaxCount = 17;
+  for (const auto kernel : kSimdKernels) {
+    if (!speedofsound::BatchKernelSupported(kernel)) continue;
+    for (size_t count = 0; count <= kMaxCount; ++count) {
+      std::vector<double> c(kMaxCount + 1, 0.0);
+      ASSERT_TRUE(
+          speedofsound::QuickComputeBatch(Arrays(), count, c.data(), kernel));
+      for (size_t i = 0; i < count; ++i) {
+        ASSERT_LE(UlpDistance(expected_[i], c[i]),
+                  speedofsound::kBatchMaxUlpError);
+      }
+      for (auto i = count; i <= kMaxCount; ++i) {
+        ASSERT_EQ(0.0, c[i]);
+      }
+    }
+  }
+}
+
+TEST_F(SpeedOfSoundBatchTest, FloatScalarKernelMatchesQuickCompute) {
+  std::vector<float> c(float_expected_.size());
+  ASSERT_TRUE(speedofsound::QuickComputeBatch(
+      FloatArrays(), c.size(), c.data(), speedofsound::BatchKernel::kScalar));
+  for (size_t i = 0; i < c.size(); ++i) {
+    ASSERT_EQ(float_expected_[i], c[i]);
+  }
+}
+
+TEST_F(SpeedOfSoundBatchTest, FloatSimdKernelsWithinUlpBound) {
+  for (const auto kernel : kSimdKernels) {
+    if (!speedofsound::BatchKernelSupported(kernel)) continue;
+    std::vector<float> c(float_expected_.size());
+    ASSERT_TRUE(speedofsound::QuickComputeBatch(FloatArrays(), c.size(),
+                                                c.data(), kernel));
+    for (size_t i = 0; i < c.size(); ++i) {
+      ASSERT_LE(UlpDistance(float_expected_[i], c[i]),
+                speedofsound::kFloatBatchMaxUlpError);
+    }
+  }
+}
+
+TEST_F(SpeedOfSoundBatchTest, FloatKernelsHandlePartialVectors) {
+  const size_t kMaxCount = 33;
+  for (const auto kernel : kSimdKernels) {
+    if (!speedofsound::BatchKernelSupported(kernel)) continue;
+    for (size_t count = 0; count <= kMaxCount; ++count) {
+      std::vector<float> c(kMaxCount + 1, 0.0f);
+      ASSERT_TRUE(speedofsound::QuickComputeBatch(FloatArrays(), count,
+                                                  c.data(), kernel));
+      for (size_t i = 0; i < count; ++i) {
+        ASSERT_LE(UlpDistance(float_expected_[i], c[i]),
+                  speedofsound::kFloatBatchMaxUlpError);
+      }
+      for (auto i = count; i <= kMaxCount; ++i) {
+        ASSERT_EQ(0.0f, c[i]);
+      }
+    }
+  }
+}
+
+TEST_F(SpeedOfSoundBatchTest, AutoKernelUsesBestSupportedKernel) {
+  const auto best_kernel = speedofsound::BestBatchKernel();
+  EXPECT_TRUE(speedofsound::BatchKernelSupported(best_kernel));
+  EXPECT_TRUE(speedofsound::BatchKernelSupported(
+      speedofsound::BatchKernel::kScalar));
+  std::vector<double> c_auto(expected_.size()), c_best(expected_.size());
+  ASSERT_TRUE(speedofsound::QuickComputeBatch(Arrays(), c_auto.size(),
+                                              c_auto.data()));
+  ASSERT_TRUE(speedofsound::QuickComputeBatch(Arrays(), c_best.size(),
+                                              c_best.data(), best_kernel));
+  for (size_t i = 0; i < c_auto.size(); ++i) {
+    ASSERT_EQ(c_best[i], c_auto[i]);
+  }
+}
+
+TEST_F(SpeedOfSoundBatchTest, FastPsvKernelsWithinTolerance) {
+  const auto tolerance = speedofsound::theory::kFastPsvMaxRelativeError;
+  std::vector<double> T;
+  for (const auto t : temperature_) {
+    T.push_back(speedofsound::theory::T(t));
+  }
+  auto kernels = kSimdKernels;
+  kernels.push_back(speedofsound::BatchKernel::kScalar);
+  for (const auto kernel : kernels) {
+    if (!speedofsound::BatchKernelSupported(kernel)) continue;
+    std::vector<double> Psv(T.size()), dPsv_dt(T.size()), Psv_only(T.size());
+    ASSERT_TRUE(speedofsound::FastPsvBatch(T.data(), T.size(), Psv.data(),
+                                           dPsv_dt.data(), kernel));
+    ASSERT_TRUE(speedofsound::FastPsvBatch(T.data(), T.size(),
+                                           Psv_only.data(), nullptr, kernel));
+    for (size_t i = 0; i < T.size(); ++i) {
+      const auto expected_Psv = speedofsound::theory::Psv(T[i]);
+      const auto expected_dPsv_dt = speedofsound::theory::dPsv_dt(T[i]);
+      ASSERT_EQ(Psv[i], Psv_only[i]);
+      ASSERT_NEAR(expected_Psv, Psv[i], expected_Psv * tolerance);
+      ASSERT_NEAR(expected_dPsv_dt, dPsv_dt[i], expected_dPsv_dt * tolerance);
+    }
+  }
+}
+
+TEST_F(SpeedOfSoundBatchTest, ComputeRateBatchMatchesComputeRate) {
+  const auto size = expected_.size();
+  auto kernels = kSimdKernels;
+  kernels.push_back(speedofsound::BatchKernel::kScalar);
+  for (const auto kernel : kernels) {
+    std::vector<double> c(size), t_rate(size), h_rate(size), p_rate(size),
+        xc_rate(size);
+    const speedofsound::EnvironmentRateArrays rates(
+        t_rate.data(), h_rate.data(), p_rate.data(), xc_rate.data());
+    if (!speedofsound::BatchKernelSupported(kernel)) {
+      EXPECT_FALSE(speedofsound::ComputeRateBatch(Arrays(), size, c.data(),
+                                                  rates, kernel));
+      continue;
+    }
+    ASSERT_TRUE(speedofsound::ComputeRateBatch(Arrays(), size, c.data(),
+                                               rates, kernel));
+    // Bit-identical for the scalar kernel; the pressure rate cancels to zero
+    // in dry air, so it keeps an absolute term
+    const auto relative_tolerance =
+        kernel == speedofsound::BatchKernel::kScalar ? 0.0 : 1.0e-14;
+    const auto absolute_tolerance =
+        kernel == speedofsound::BatchKernel::kScalar ? 0.0 : 1.0e-18;
+    for (size_t i = 0; i < size; ++i) {
+      const speedofsound::Environment environment(
+          temperature_[i], humidity_[i], pressure_[i], co2_mole_fraction_[i]);
+      speedofsound::EnvironmentRate rate;
+      const auto expected = speed_of_sound_.ComputeRate(environment, &rate);
+      ASSERT_NEAR(expected, c[i], fabs(expected) * relative_tolerance);
+      ASSERT_NEAR(rate.temperature_rate_, t_rate[i],
+                  fabs(rate.temperature_rate_) * relative_tolerance);
+      ASSERT_NEAR(rate.humidity_rate_, h_rate[i],
+                  fabs(rate.humidity_rate_) * relative_tolerance);
+      ASSERT_NEAR(rate.pressure_rate_, p_rate[i],
+                  fabs(rate.pressure_rate_) * relative_tolerance +
+                      absolute_tolerance);
+      ASSERT_NEAR(rate.co2_mole_fraction_rate_, xc_rate[i],
+                  fabs(rate.co2_mole_fraction_rate_) * relative_tolerance);
+    }
+  }
+}
@@ -0,0 +1,32 @@
+#ifndef TEST_SPEED_OF_SOUND_BATCH_TEST_H_
+#define TEST_SPEED_OF_SOUND_BATCH_TEST_H_
+
+#include <stdint.h>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "speed-of-sound-batch.h"
+#include "speed-of-sound.h"
+
+class SpeedOfSoundBatchTest : public ::testing::Test {
+ public:
+  SpeedOfSoundBatchTest();
+  auto Arrays() const -> speedofsound::EnvironmentArrays;
+  auto FloatArrays() const -> speedofsound::FloatEnvironmentArrays;
+  static auto UlpDistance(const double a, const double b) -> int64_t;
+  static auto UlpDistance(const float a, const float b) -> int64_t;
+
+  speedofsound::SpeedOfSound speed_of_sound_;
+  std::vector<double> temperature_, humidity_, pressure_, co2_mole_fraction_;
+  std::vector<double> expected_;
+  std::vector<float> float_temperature_, float_humidity_, float_pressure_,
+      float_co2_mole_fraction_;
+  std::vector<float> float_expected_;
+  const double kIncrementFactor = 10.0 / 100.0;
+  const std::vector<speedofsound::BatchKernel> kSimdKernels = {
+      speedofsound::BatchKernel::kSse2, speedofsound::BatchKernel::kAvx2,
+      speedofsound::BatchKernel::kAvx512};
+};
+
+#endif  // TEST_SPEED_OF_SOUND_BATCH_TEST_H_
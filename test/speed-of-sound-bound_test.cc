@@ -0,0 +1,90 @@
+#include "speed-of-sound-bound_test.h"
+
+#include <math.h>
+
+#include "speed-of-sound-theory.h"
+
+auto BoundSpeedOfSoundTest::GetEnvironment(const int i) const
+    -> speedofsound::Environment {
+  const auto phase = 2.0 * M_PI * i / kSteps;
+  return speedofsound::Environment(15.0 + 15.0 * sin(phase),
+                                   0.5 + 0.5 * sin(3.0 * phase),
+                                   88500.0 + 13500.0 * cos(2.0 * phase),
+                                   0.005 + 0.005 * cos(5.0 * phase));
+}
+
+template <unsigned kBound>
+auto BoundSpeedOfSoundTest::ExpectMatchesQuickCompute(
+    const speedofsound::Environment& bound_conditions) const -> void {
+  const speedofsound::BoundSpeedOfSound<kBound> bound(bound_conditions);
+  for (auto i = 0; i < kSteps; ++i) {
+    const auto ambient_conitions = GetEnvironment(i);
+    auto expected_conditions = ambient_conitions;
+    if (kBound & speedofsound::kBoundTemperature) {
+      expected_conditions.temperature_ = bound_conditions.temperature_;
+    }
+    if (kBound & speedofsound::kBoundHumidity) {
+      expected_conditions.humidity_ = bound_conditions.humidity_;
+    }
+    if (kBound & speedofsound::kBoundPressure) {
+      expected_conditions.pressure_ = bound_conditions.pressure_;
+    }
+    if (kBound & speedofsound::kBoundCO2MoleFraction) {
+      expected_conditions.co2_mole_fraction_ =
+          bound_conditions.co2_mole_fraction_;
+    }
+    ASSERT_EQ(bound.QuickCompute(ambient_conitions),
+              speed_of_sound_.QuickCompute(expected_conditions))
+        << "bound inputs " << kBound << ", step " << i;
+  }
+}
+
+TEST_F(BoundSpeedOfSoundTest, GetBoundEnvironment) {
+  const speedofsound::Environment bound_conditions(12.5, 0.3, 98000.0,
+                                                   0.0007);
+  const speedofsound::TemperatureBoundSpeedOfSound bound(bound_conditions);
+  const auto environment = bound.GetBoundEnvironment();
+  EXPECT_EQ(environment.temperature_, bound_conditions.temperature_);
+  EXPECT_EQ(environment.humidity_, bound_conditions.humidity_);
+  EXPECT_EQ(environment.pressure_, bound_conditions.pressure_);
+  EXPECT_EQ(environment.co2_mole_fraction_,
+            bound_conditions.co2_mole_fraction_);
+}
+
+TEST_F(BoundSpeedOfSoundTest, TemperatureBoundIdenticalToQuickCompute) {
+  for (auto i = 0; i < kSteps; i += 7) {
+    ExpectMatchesQuickCompute<speedofsound::kBoundTemperature>(
+        GetEnvironment(i));
+  }
+}
+
+TEST_F(BoundSpeedOfSoundTest, EverySetOfInputsIdenticalToQuickCompute) {
+  const speedofsound::Environment bound_conditions(27.0, 0.85, 76000.0,
+                                                   0.0093);
+  ExpectMatchesQuickCompute<1>(bound_conditions);
+  ExpectMatchesQuickCompute<2>(bound_conditions);
+  ExpectMatchesQuickCompute<3>(bound_conditions);
+  ExpectMatchesQuickCompute<4>(bound_conditions);
+  ExpectMatchesQuickCompute<5>(bound_conditions);
+  ExpectMatchesQuickCompute<6>(bound_conditions);
+  ExpectMatchesQuickCompute<7>(bound_conditions);
+  ExpectMatchesQuickCompute<8>(bound_conditions);
+  ExpectMatchesQuickCompute<9>(bound_conditions);
+  ExpectMatchesQuickCompute<10>(bound_conditions);
+  ExpectMatchesQuickCompute<11>(bound_conditions);
+  ExpectMatchesQuickCompute<12>(bound_conditions);
+  ExpectMatchesQuickCompute<13>(bound_conditions);
+  ExpectMatchesQuickCompute<14>(bound_conditions);
+  ExpectMatchesQuickCompute<15>(bound_conditions);
+}
+
+TEST_F(BoundSpeedOfSoundTest, AllInputsBoundIsConstant) {
+  const speedofsound::Environment bound_conditions;
+  const speedofsound::BoundSpeedOfSound<
+      speedofsound::kBoundTemperature | speedofsound::kBoundHumidity |
+      speedofsound::kBoundPressure | speedofsound::kBoundCO2MoleFraction>
+      bound(bound_conditions);
+  const auto expected = speed_of_sound_.QuickCompute(bound_conditions);
+  EXPECT_EQ(bound.QuickCompute(GetEnvironment(0)), expected);
+  EXPECT_EQ(bound.QuickCompute(GetEnvironment(kSteps / 3)), expected);
+}
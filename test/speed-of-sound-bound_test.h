@@ -0,0 +1,24 @@
+#ifndef TEST_SPEED_OF_SOUND_BOUND_TEST_H_
+#define TEST_SPEED_OF_SOUND_BOUND_TEST_H_
+
+#include "gtest/gtest.h"
+
+#include "environment.h"
+#include "speed-of-sound-bound.h"
+#include "speed-of-sound.h"
+
+class BoundSpeedOfSoundTest : public ::testing::Test {
+ public:
+  // Environment i of kSteps spread over the valid range
+  auto GetEnvironment(const int i) const -> speedofsound::Environment;
+  // Expects BoundSpeedOfSound<kBound> bound at bound_conditions to be
+  // identical to QuickCompute with the bound inputs replaced
+  template <unsigned kBound>
+  auto ExpectMatchesQuickCompute(
+      const speedofsound::Environment& bound_conditions) const -> void;
+
+  speedofsound::SpeedOfSound speed_of_sound_;
+  const int kSteps = 200;
+};
+
+#endif  // TEST_SPEED_OF_SOUND_BOUND_TEST_H_
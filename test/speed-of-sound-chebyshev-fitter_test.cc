@@ -0,0 +1,55 @@
+#include "speed-of-sound-chebyshev-fitter_test.h"
+
+#include <math.h>
+
+auto ChebyshevFitterTest::MaxError(
+    const speedofsound::ChebyshevSurrogate& surrogate) const -> double {
+  auto max_error = 0.0;
+  for (auto t = kTMin; t <= kTMax; t += (kTMax - kTMin) * kIncrementFactor) {
+    for (auto h = kHMin; h <= kHMax; h += (kHMax - kHMin) * kIncrementFactor) {
+      for (auto p = kPMin; p <= kPMax;
+           p += (kPMax - kPMin) * kIncrementFactor) {
+        for (auto xc = kXcMin; xc <= kXcMax;
+             xc += (kXcMax - kXcMin) * kIncrementFactor) {
+          const speedofsound::Environment environment(t, h, p, xc);
+          const auto error = fabs(surrogate.Evaluate(environment) -
+                                  speed_of_sound_.QuickCompute(environment));
+          max_error = error > max_error ? error : max_error;
+        }
+      }
+    }
+  }
+  return max_error;
+}
+
+TEST_F(ChebyshevFitterTest, RejectsInvalidTolerances) {
+  EXPECT_FALSE(fitter_.IsValid());
+  EXPECT_FALSE(fitter_.GetSurrogate().IsValid());
+  EXPECT_FALSE(fitter_.Fit(0.0));
+  EXPECT_FALSE(fitter_.Fit(-1.0));
+  // Below the interpolation error of the reference series
+  EXPECT_FALSE(fitter_.Fit(1.0e-15));
+  EXPECT_FALSE(fitter_.IsValid());
+  ASSERT_TRUE(fitter_.Fit(kTolerance));
+  EXPECT_FALSE(fitter_.Fit(0.0));
+  EXPECT_FALSE(fitter_.IsValid());
+}
+
+TEST_F(ChebyshevFitterTest, FitWithinTolerance) {
+  ASSERT_TRUE(fitter_.Fit(kTolerance));
+  const auto surrogate = fitter_.GetSurrogate();
+  ASSERT_TRUE(surrogate.IsValid());
+  EXPECT_EQ(surrogate.GetTermCount(), fitter_.GetTerms().size());
+  EXPECT_GT(fitter_.GetMaxError(), 0.0);
+  EXPECT_LE(fitter_.GetMaxError(), kTolerance);
+  EXPECT_DOUBLE_EQ(surrogate.GetMaxError(), fitter_.GetMaxError());
+  EXPECT_LE(MaxError(surrogate), kTolerance);
+}
+
+TEST_F(ChebyshevFitterTest, TighterToleranceNeedsMoreTerms) {
+  ASSERT_TRUE(fitter_.Fit(kTolerance));
+  const auto term_count = fitter_.GetTerms().size();
+  ASSERT_TRUE(fitter_.Fit(kTolerance / 1000.0));
+  EXPECT_GT(fitter_.GetTerms().size(), term_count);
+  EXPECT_LE(MaxError(fitter_.GetSurrogate()), kTolerance / 1000.0);
+}
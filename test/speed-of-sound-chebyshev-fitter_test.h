@@ -0,0 +1,30 @@
+#ifndef TEST_SPEED_OF_SOUND_CHEBYSHEV_FITTER_TEST_H_
+#define TEST_SPEED_OF_SOUND_CHEBYSHEV_FITTER_TEST_H_
+
+#include "gtest/gtest.h"
+
+#include "speed-of-sound-chebyshev-fitter.h"
+#include "speed-of-sound.h"
+
+class ChebyshevFitterTest : public ::testing::Test {
+ public:
+  // Largest absolute difference from QuickCompute on a grid that avoids the
+  // grid used by the fitter
+  auto MaxError(const speedofsound::ChebyshevSurrogate& surrogate) const
+      -> double;
+
+  speedofsound::SpeedOfSound speed_of_sound_;
+  speedofsound::ChebyshevFitter fitter_;
+  const double kTolerance = 1.0e-3;
+  const double kIncrementFactor = 7.0 / 100.0;
+  const double kTMin = speedofsound::theory::kMinTemperature;
+  const double kTMax = speedofsound::theory::kMaxTemperature;
+  const double kHMin = speedofsound::theory::kMinHumidity;
+  const double kHMax = speedofsound::theory::kMaxHumidity;
+  const double kPMin = speedofsound::theory::kMinPressure;
+  const double kPMax = speedofsound::theory::kMaxPressure;
+  const double kXcMin = speedofsound::theory::kMinCO2MoleFraction;
+  const double kXcMax = speedofsound::theory::kMaxCO2MoleFraction;
+};
+
+#endif  // TEST_SPEED_OF_SOUND_CHEBYSHEV_FITTER_TEST_H_
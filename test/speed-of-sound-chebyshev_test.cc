@@ -0,0 +1,69 @@
+#include "speed-of-sound-chebyshev_test.h"
+
+#include <math.h>
+
+#include "speed-of-sound-theory.h"
+
+auto ChebyshevSurrogateTest::Position(const double x, const double min,
+                                      const double max) const -> double {
+  return (2.0 * x - (min + max)) / (max - min);
+}
+
+TEST_F(ChebyshevSurrogateTest, DegreeValidation) {
+  EXPECT_TRUE(speedofsound::ChebyshevDegree().Validate());
+  EXPECT_TRUE(kDegree.Validate());
+  EXPECT_FALSE(speedofsound::ChebyshevDegree(
+                   0, speedofsound::kMaxChebyshevDegree + 1, 0, 0)
+                   .Validate());
+}
+
+TEST_F(ChebyshevSurrogateTest, InvalidSurrogates) {
+  EXPECT_FALSE(speedofsound::ChebyshevSurrogate().IsValid());
+  EXPECT_FALSE(
+      speedofsound::ChebyshevSurrogate(kDegree, kTerms, 0, 0.0).IsValid());
+  EXPECT_FALSE(speedofsound::ChebyshevSurrogate(
+                   speedofsound::ChebyshevDegree(
+                       speedofsound::kMaxChebyshevDegree + 1, 1, 0, 2),
+                   kTerms, 5, 0.0)
+                   .IsValid());
+  // A term exceeds the degree
+  EXPECT_FALSE(speedofsound::ChebyshevSurrogate(
+                   speedofsound::ChebyshevDegree(1, 1, 0, 1), kTerms, 5, 0.0)
+                   .IsValid());
+}
+
+TEST_F(ChebyshevSurrogateTest, OverDegreeEvaluatesToNaN) {
+  const auto degree = speedofsound::kMaxChebyshevDegree + 5;
+  const speedofsound::ChebyshevSurrogate surrogate(
+      speedofsound::ChebyshevDegree(degree, degree, degree, degree), kTerms,
+      5, 0.0);
+  ASSERT_FALSE(surrogate.IsValid());
+  EXPECT_TRUE(isnan(surrogate.Evaluate(speedofsound::Environment())));
+}
+
+TEST_F(ChebyshevSurrogateTest, EvaluatesSeries) {
+  const speedofsound::ChebyshevSurrogate surrogate(kDegree, kTerms, 5, 0.125);
+  ASSERT_TRUE(surrogate.IsValid());
+  EXPECT_EQ(surrogate.GetTerms(), kTerms);
+  EXPECT_EQ(surrogate.GetTermCount(), 5U);
+  EXPECT_DOUBLE_EQ(surrogate.GetMaxError(), 0.125);
+  EXPECT_EQ(surrogate.GetDegree().co2_mole_fraction_degree_, 2U);
+  for (auto t = 0.0; t <= 30.0; t += 7.5) {
+    for (auto h = 0.0; h <= 1.0; h += 0.25) {
+      for (auto xc = 0.0; xc <= 0.01; xc += 0.0025) {
+        const speedofsound::Environment environment(t, h, 90000.0, xc);
+        const auto u_t = Position(t, speedofsound::theory::kMinTemperature,
+                                  speedofsound::theory::kMaxTemperature);
+        const auto u_h = Position(h, speedofsound::theory::kMinHumidity,
+                                  speedofsound::theory::kMaxHumidity);
+        const auto u_xc =
+            Position(xc, speedofsound::theory::kMinCO2MoleFraction,
+                     speedofsound::theory::kMaxCO2MoleFraction);
+        const auto expected = 340.0 + 10.0 * u_t + 2.0 * u_h +
+                              0.5 * u_t * u_h -
+                              0.25 * (2.0 * u_xc * u_xc - 1.0);
+        EXPECT_NEAR(surrogate.Evaluate(environment), expected, 1e-12);
+      }
+    }
+  }
+}
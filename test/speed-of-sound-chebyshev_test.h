@@ -0,0 +1,24 @@
+#ifndef TEST_SPEED_OF_SOUND_CHEBYSHEV_TEST_H_
+#define TEST_SPEED_OF_SOUND_CHEBYSHEV_TEST_H_
+
+#include "gtest/gtest.h"
+
+#include "speed-of-sound-chebyshev.h"
+
+class ChebyshevSurrogateTest : public ::testing::Test {
+ public:
+  // Position of x in [min, max] on the Chebyshev interval [-1, 1]
+  auto Position(const double x, const double min, const double max) const
+      -> double;
+
+  const speedofsound::ChebyshevTerm kTerms[5] = {
+      speedofsound::ChebyshevTerm(340.0, 0, 0, 0, 0),
+      speedofsound::ChebyshevTerm(10.0, 1, 0, 0, 0),
+      speedofsound::ChebyshevTerm(2.0, 0, 1, 0, 0),
+      speedofsound::ChebyshevTerm(0.5, 1, 1, 0, 0),
+      speedofsound::ChebyshevTerm(-0.25, 0, 0, 0, 2)};
+  const speedofsound::ChebyshevDegree kDegree =
+      speedofsound::ChebyshevDegree(1, 1, 0, 2);
+};
+
+#endif  // TEST_SPEED_OF_SOUND_CHEBYSHEV_TEST_H_
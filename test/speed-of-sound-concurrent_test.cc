@@ -0,0 +1,73 @@
+#include "speed-of-sound-concurrent_test.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_F(ConcurrentSpeedOfSoundTest, MatchesSpeedOfSound) {
+  speedofsound::ConcurrentSpeedOfSound concurrent(kColdEnvironment);
+  speedofsound::SpeedOfSound speed_of_sound(kColdEnvironment);
+  EXPECT_EQ(speed_of_sound.Approximate(kQuery),
+            concurrent.Approximate(kQuery));
+  EXPECT_EQ(speed_of_sound.Compute(kWarmEnvironment),
+            concurrent.Compute(kWarmEnvironment));
+  EXPECT_EQ(speed_of_sound.Approximate(kQuery),
+            concurrent.Approximate(kQuery));
+  EXPECT_EQ(speed_of_sound.GetInitSpeedOfSound(),
+            concurrent.GetSpeedOfSound().GetInitSpeedOfSound());
+  EXPECT_EQ(
+      speed_of_sound.GetInitEnvironmentRate().pressure_rate_,
+      concurrent.GetSpeedOfSound().GetInitEnvironmentRate().pressure_rate_);
+}
+
+TEST_F(ConcurrentSpeedOfSoundTest, DefaultEnvironment) {
+  const speedofsound::ConcurrentSpeedOfSound concurrent;
+  const speedofsound::SpeedOfSound speed_of_sound;
+  EXPECT_EQ(speed_of_sound.Approximate(kQuery),
+            concurrent.Approximate(kQuery));
+}
+
+TEST_F(ConcurrentSpeedOfSoundTest, PublishCount) {
+  speedofsound::ConcurrentSpeedOfSound concurrent;
+  EXPECT_EQ(1u, concurrent.GetPublishCount());
+  concurrent.Compute(kWarmEnvironment);
+  concurrent.Publish(speedofsound::SpeedOfSound(kColdEnvironment));
+  EXPECT_EQ(3u, concurrent.GetPublishCount());
+}
+
+// Readers only ever see one of the two published points in full
+TEST_F(ConcurrentSpeedOfSoundTest, ReadersNeverSeeTornPoints) {
+  const speedofsound::SpeedOfSound cold(kColdEnvironment);
+  const speedofsound::SpeedOfSound warm(kWarmEnvironment);
+  speedofsound::ConcurrentSpeedOfSound concurrent(kColdEnvironment);
+  std::atomic<bool> done(false);
+  std::atomic<int> torn(0);
+  std::vector<std::thread> readers;
+  for (auto i = 0; i < kReaderCount; ++i) {
+    readers.emplace_back([&] {
+      while (!done) {
+        const auto approximation = concurrent.Approximate(kQuery);
+        const auto point = concurrent.GetSpeedOfSound();
+        const auto& expected =
+            point.GetInitEnvironment().temperature_ ==
+                    kColdEnvironment.temperature_
+                ? cold
+                : warm;
+        if ((approximation != cold.Approximate(kQuery) &&
+             approximation != warm.Approximate(kQuery)) ||
+            point.Approximate(kQuery) != expected.Approximate(kQuery) ||
+            point.GetInitSpeedOfSound() != expected.GetInitSpeedOfSound()) {
+          ++torn;
+        }
+      }
+    });
+  }
+  for (auto i = 0; i < kPublishCount; ++i) {
+    concurrent.Publish(i % 2 == 0 ? warm : cold);
+  }
+  done = true;
+  for (auto& reader : readers) reader.join();
+  EXPECT_EQ(0, torn);
+  EXPECT_EQ(static_cast<uint64_t>(kPublishCount) + 1,
+            concurrent.GetPublishCount());
+}
@@ -0,0 +1,21 @@
+#ifndef TEST_SPEED_OF_SOUND_CONCURRENT_TEST_H_
+#define TEST_SPEED_OF_SOUND_CONCURRENT_TEST_H_
+
+#include "gtest/gtest.h"
+
+#include "speed-of-sound-concurrent.h"
+
+class ConcurrentSpeedOfSoundTest : public ::testing::Test {
+ public:
+  // Linearization points far enough apart that no field is shared
+  const speedofsound::Environment kColdEnvironment =
+      speedofsound::Environment(2.0, 0.2, 80000.0, 0.0002);
+  const speedofsound::Environment kWarmEnvironment =
+      speedofsound::Environment(28.0, 0.9, 101000.0, 0.008);
+  const speedofsound::Environment kQuery =
+      speedofsound::Environment(15.0, 0.6, 95000.0, 0.001);
+  const int kReaderCount = 4;
+  const int kPublishCount = 20000;
+};
+
+#endif  // TEST_SPEED_OF_SOUND_CONCURRENT_TEST_H_
@@ -0,0 +1,140 @@
+#include "speed-of-sound-constexpr_test.h"
+
+#include <math.h>
+
+namespace {
+
+constexpr speedofsound::Environment kOperatingPoint(25.0, 0.4, 98000.0,
+                                                    0.0004);
+constexpr double kSpeedOfSound =
+    speedofsound::compile_time::Compute(kOperatingPoint);
+constexpr speedofsound::SpeedOfSound kLinearSpeedOfSound =
+    speedofsound::compile_time::Linearize(kOperatingPoint);
+constexpr speedofsound::SpeedOfSound kQuadraticSpeedOfSound =
+    speedofsound::compile_time::Linearize(
+        kOperatingPoint, speedofsound::ApproximationOrder::kQuadratic);
+constexpr double kSpeedOfSoundTable[] = {
+    speedofsound::compile_time::Compute(
+        speedofsound::Environment(0.0, 0.5, 101325.0, 0.0004)),
+    speedofsound::compile_time::Compute(
+        speedofsound::Environment(10.0, 0.5, 101325.0, 0.0004)),
+    speedofsound::compile_time::Compute(
+        speedofsound::Environment(20.0, 0.5, 101325.0, 0.0004)),
+    speedofsound::compile_time::Compute(
+        speedofsound::Environment(30.0, 0.5, 101325.0, 0.0004))};
+
+static_assert(kSpeedOfSound > 345.0 && kSpeedOfSound < 348.0,
+              "Speed of sound is not evaluated at compile time");
+static_assert(kSpeedOfSoundTable[0] < kSpeedOfSoundTable[3],
+              "Speed of sound table is not evaluated at compile time");
+
+auto RelativeError(const double actual, const double expected) -> double {
+  return fabs(actual - expected) / fabs(expected);
+}
+
+}  // namespace
+
+TEST_F(SpeedOfSoundConstexprTest, ExpWithinTolerance) {
+  for (auto x = -700.0; x <= 700.0; x += 0.37) {
+    ASSERT_LE(
+        RelativeError(speedofsound::theory::compile_time::Exp(x), exp(x)),
+        speedofsound::theory::compile_time::kMaxExpRelativeError);
+  }
+}
+
+TEST_F(SpeedOfSoundConstexprTest, ComputeMatchesQuickCompute) {
+  // Psv enters C scaled down by Xw, so C is closer than Psv
+  const auto tolerance =
+      speedofsound::theory::compile_time::kMaxExpRelativeError;
+  speedofsound::Environment e;
+  for (auto t = kTMin; t <= kTMax; t += (kTMax - kTMin) * kIncrementFactor) {
+    for (auto h = kHMin; h <= kHMax; h += (kHMax - kHMin) * kIncrementFactor) {
+      for (auto p = kPMin; p <= kPMax;
+           p += (kPMax - kPMin) * kIncrementFactor) {
+        for (auto xc = kXcMin; xc <= kXcMax;
+             xc += (kXcMax - kXcMin) * kIncrementFactor) {
+          e.temperature_ = t;
+          e.humidity_ = h;
+          e.pressure_ = p;
+          e.co2_mole_fraction_ = xc;
+          const auto c = speed_of_sound_.QuickCompute(e);
+          ASSERT_LE(
+              RelativeError(speedofsound::compile_time::Compute(e), c),
+              tolerance);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(SpeedOfSoundConstexprTest, LinearizeMatchesConstructor) {
+  const auto tolerance = 1.0e-12;
+  const speedofsound::SpeedOfSound speed_of_sound(
+      kOperatingPoint, speedofsound::ApproximationOrder::kQuadratic);
+  const auto rate = speed_of_sound.GetInitEnvironmentRate();
+  const auto linear_rate = kLinearSpeedOfSound.GetInitEnvironmentRate();
+  const auto curvature = speed_of_sound.GetInitEnvironmentCurvature();
+  const auto quadratic_curvature =
+      kQuadraticSpeedOfSound.GetInitEnvironmentCurvature();
+
+  EXPECT_EQ(kLinearSpeedOfSound.GetApproximationOrder(),
+            speedofsound::ApproximationOrder::kLinear);
+  EXPECT_EQ(kQuadraticSpeedOfSound.GetApproximationOrder(),
+            speedofsound::ApproximationOrder::kQuadratic);
+  EXPECT_DOUBLE_EQ(kLinearSpeedOfSound.GetInitEnvironment().temperature_,
+                   kOperatingPoint.temperature_);
+  EXPECT_LE(RelativeError(kSpeedOfSound,
+                          speed_of_sound_.QuickCompute(kOperatingPoint)),
+            tolerance);
+  EXPECT_LE(RelativeError(linear_rate.temperature_rate_,
+                          rate.temperature_rate_),
+            tolerance);
+  EXPECT_LE(RelativeError(linear_rate.humidity_rate_, rate.humidity_rate_),
+            tolerance);
+  EXPECT_LE(RelativeError(linear_rate.pressure_rate_, rate.pressure_rate_),
+            tolerance);
+  EXPECT_LE(RelativeError(linear_rate.co2_mole_fraction_rate_,
+                          rate.co2_mole_fraction_rate_),
+            tolerance);
+  EXPECT_DOUBLE_EQ(kLinearSpeedOfSound.GetInitEnvironmentCurvature()
+                       .temperature_temperature_,
+                   0.0);
+  EXPECT_LE(RelativeError(quadratic_curvature.temperature_temperature_,
+                          curvature.temperature_temperature_),
+            tolerance);
+  EXPECT_LE(RelativeError(quadratic_curvature.temperature_humidity_,
+                          curvature.temperature_humidity_),
+            tolerance);
+  EXPECT_LE(RelativeError(quadratic_curvature.temperature_pressure_,
+                          curvature.temperature_pressure_),
+            tolerance);
+  EXPECT_LE(RelativeError(quadratic_curvature.temperature_co2_mole_fraction_,
+                          curvature.temperature_co2_mole_fraction_),
+            tolerance);
+  EXPECT_LE(RelativeError(quadratic_curvature.humidity_humidity_,
+                          curvature.humidity_humidity_),
+            tolerance);
+  EXPECT_LE(RelativeError(quadratic_curvature.humidity_pressure_,
+                          curvature.humidity_pressure_),
+            tolerance);
+  EXPECT_LE(RelativeError(quadratic_curvature.humidity_co2_mole_fraction_,
+                          curvature.humidity_co2_mole_fraction_),
+            tolerance);
+  EXPECT_LE(RelativeError(quadratic_curvature.pressure_pressure_,
+                          curvature.pressure_pressure_),
+            tolerance);
+  EXPECT_LE(RelativeError(quadratic_curvature.pressure_co2_mole_fraction_,
+                          curvature.pressure_co2_mole_fraction_),
+            tolerance);
+  EXPECT_DOUBLE_EQ(quadratic_curvature.co2_mole_fraction_co2_mole_fraction_,
+                   curvature.co2_mole_fraction_co2_mole_fraction_);
+}
+
+TEST_F(SpeedOfSoundConstexprTest, LinearizedApproximationMatches) {
+  const auto tolerance = 1.0e-12;
+  const speedofsound::SpeedOfSound speed_of_sound(kOperatingPoint);
+  speedofsound::Environment e(20.0, 0.6, 100000.0, 0.0005);
+  EXPECT_NEAR(kLinearSpeedOfSound.Approximate(e),
+              speed_of_sound.Approximate(e),
+              speed_of_sound.Approximate(e) * tolerance);
+}
@@ -0,0 +1,173 @@
+#include "speed-of-sound-eikonal_test.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <limits>
+
+#include "speed-of-sound-batch.h"
+
+
+auto SpeedOfSoundEikonalTest::Fill(const speedofsound::GridShape& shape,
+                                   const bool layered) -> void {
+  temperature_.assign(shape.Cells(), 20.0);
+  humidity_.assign(shape.Cells(), 0.5);
+  pressure_.assign(shape.Cells(), 101325.0);
+  co2_mole_fraction_.assign(shape.Cells(), 0.0004);
+  if (!layered) return;
+  for (size_t i = 0; i < shape.Cells(); ++i) {
+    temperature_[i] = 30.0 * (i % shape.x_size_) / (shape.x_size_ - 1);
+  }
+}
+
+auto SpeedOfSoundEikonalTest::Arrays() const
+    -> speedofsound::EnvironmentArrays {
+  return speedofsound::EnvironmentArrays(
+      temperature_.data(), humidity_.data(), pressure_.data(),
+      co2_mole_fraction_.data());
+}
+
+auto SpeedOfSoundEikonalTest::Reference(const speedofsound::GridShape& shape,
+                                        const size_t source_x,
+                                        const size_t source_y,
+                                        const size_t source_z) const
+    -> std::vector<double> {
+  const auto infinity = std::numeric_limits<double>::infinity();
+  const size_t n[3] = {shape.x_size_, shape.y_size_, shape.z_size_};
+  const size_t strides[3] = {1, n[0], n[0] * n[1]};
+  std::vector<double> f(shape.Cells());
+  std::vector<double> c(shape.Cells());
+  speedofsound::QuickComputeBatch(Arrays(), shape.Cells(), c.data());
+  for (size_t i = 0; i < shape.Cells(); ++i) f[i] = shape.spacing_ / c[i];
+  std::vector<double> t(shape.Cells(), infinity);
+  t[source_x + source_y * strides[1] + source_z * strides[2]] = 0.0;
+  const auto directions = n[2] == 1 ? 4u : 8u;
+  for (auto changed = true; changed;) {
+    changed = false;
+    for (unsigned direction = 0; direction < directions; ++direction) {
+      for (size_t k = 0; k < n[2]; ++k) {
+        for (size_t j = 0; j < n[1]; ++j) {
+          for (size_t l = 0; l < n[0]; ++l) {
+            const size_t p[3] = {(direction & 1) ? n[0] - 1 - l : l,
+                                 (direction & 2) ? n[1] - 1 - j : j,
+                                 (direction & 4) ? n[2] - 1 - k : k};
+            const auto i =
+                p[0] * strides[0] + p[1] * strides[1] + p[2] * strides[2];
+            double a[3];
+            for (auto axis = 0; axis < 3; ++axis) {
+              a[axis] = infinity;
+              if (p[axis] > 0) a[axis] = t[i - strides[axis]];
+              if (p[axis] + 1 < n[axis]) {
+                a[axis] = std::min(a[axis], t[i + strides[axis]]);
+              }
+            }
+            std::sort(a, a + 3);
+            if (a[0] == infinity) continue;
+            auto u = a[0] + f[i];
+            if (u > a[1]) {
+              const auto d = a[0] - a[1];
+              u = 0.5 * (a[0] + a[1] + sqrt(2.0 * f[i] * f[i] - d * d));
+              if (u > a[2]) {
+                const auto s = a[0] + a[1] + a[2];
+                const auto q = a[0] * a[0] + a[1] * a[1] + a[2] * a[2];
+                u = (s + sqrt(fmax(0.0, s * s - 3.0 * (q - f[i] * f[i])))) /
+                    3.0;
+              }
+            }
+            if (u < t[i]) {
+              t[i] = u;
+              changed = true;
+            }
+          }
+        }
+      }
+    }
+  }
+  return t;
+}
+
+TEST_F(SpeedOfSoundEikonalTest, ConstantEnvironmentAlongAxes) {
+  Fill(kShape3d, false);
+  double c;
+  speedofsound::QuickComputeBatch(Arrays(), 1, &c);
+  speedofsound::ThreadPool pool(2);
+  speedofsound::EikonalSolver solver(&pool);
+  ASSERT_TRUE(solver.SetEnvironment(kShape3d, Arrays()));
+  std::vector<double> t(kShape3d.Cells());
+  ASSERT_TRUE(solver.Solve(0, 0, 0, t.data()));
+  const auto h = kShape3d.spacing_;
+  for (size_t x = 0; x < kShape3d.x_size_; ++x) {
+    EXPECT_NEAR(x * h / c, t[x], 1e-12);
+  }
+  for (size_t z = 0; z < kShape3d.z_size_; ++z) {
+    const auto i = z * kShape3d.x_size_ * kShape3d.y_size_;
+    EXPECT_NEAR(z * h / c, t[i], 1e-12);
+  }
+  // The first-order scheme overestimates off the axes, by O(h)
+  const auto n = kShape3d.z_size_ - 1;
+  const auto i = n * (kShape3d.x_size_ * kShape3d.y_size_ +
+                      kShape3d.x_size_ + 1);
+  const auto exact = sqrt(3.0) * n * h / c;
+  EXPECT_GT(t[i], exact);
+  EXPECT_LT(t[i], exact * 1.2);
+}
+
+TEST_F(SpeedOfSoundEikonalTest, MatchesReference2d) {
+  Fill(kShape2d, true);
+  const auto expected = Reference(kShape2d, 7, 30, 0);
+  speedofsound::ThreadPool pool(2);
+  speedofsound::EikonalSolver solver(&pool);
+  ASSERT_TRUE(solver.SetEnvironment(kShape2d, Arrays()));
+  std::vector<double> t(kShape2d.Cells());
+  ASSERT_TRUE(solver.Solve(7, 30, 0, t.data()));
+  for (size_t i = 0; i < kShape2d.Cells(); ++i) {
+    ASSERT_NEAR(expected[i], t[i], 1e-12);
+  }
+}
+
+TEST_F(SpeedOfSoundEikonalTest, MatchesReference3d) {
+  Fill(kShape3d, true);
+  const auto expected = Reference(kShape3d, 18, 2, 5);
+  speedofsound::ThreadPool pool(2);
+  speedofsound::EikonalSolver solver(&pool);
+  ASSERT_TRUE(solver.SetEnvironment(kShape3d, Arrays()));
+  std::vector<double> t(kShape3d.Cells());
+  ASSERT_TRUE(solver.Solve(18, 2, 5, t.data()));
+  EXPECT_LT(solver.GetIterationCount(), speedofsound::kMaxEikonalIterations);
+  for (size_t i = 0; i < kShape3d.Cells(); ++i) {
+    ASSERT_NEAR(expected[i], t[i], 1e-12);
+  }
+}
+
+TEST_F(SpeedOfSoundEikonalTest, IndependentOfThreadCount) {
+  Fill(kShape3d, true);
+  std::vector<double> expected;
+  for (const auto thread_count : kThreadCounts) {
+    speedofsound::ThreadPool pool(thread_count);
+    speedofsound::EikonalSolver solver(&pool);
+    ASSERT_TRUE(solver.SetEnvironment(kShape3d, Arrays()));
+    std::vector<double> t(kShape3d.Cells());
+    ASSERT_TRUE(solver.Solve(3, 12, 0, t.data()));
+    if (expected.empty()) expected = t;
+    for (size_t i = 0; i < kShape3d.Cells(); ++i) {
+      ASSERT_EQ(expected[i], t[i]);
+    }
+  }
+}
+
+TEST_F(SpeedOfSoundEikonalTest, InvalidInput) {
+  speedofsound::ThreadPool pool(2);
+  speedofsound::EikonalSolver solver(&pool);
+  std::vector<double> t(kShape2d.Cells());
+  EXPECT_FALSE(solver.Solve(0, 0, 0, t.data()));
+  Fill(kShape2d, false);
+  EXPECT_FALSE(solver.SetEnvironment(speedofsound::GridShape(), Arrays()));
+  EXPECT_FALSE(solver.SetEnvironment(
+      speedofsound::GridShape(45, 37, 1, -0.5), Arrays()));
+  ASSERT_TRUE(solver.SetEnvironment(kShape2d, Arrays()));
+  EXPECT_FALSE(solver.Solve(kShape2d.x_size_, 0, 0, t.data()));
+  EXPECT_FALSE(solver.Solve(0, 0, 1, t.data()));
+  humidity_[100] = 1.5;
+  EXPECT_FALSE(solver.SetEnvironment(kShape2d, Arrays()));
+  EXPECT_FALSE(solver.Solve(0, 0, 0, t.data()));
+}
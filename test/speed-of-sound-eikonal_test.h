@@ -0,0 +1,29 @@
+#ifndef TEST_SPEED_OF_SOUND_EIKONAL_TEST_H_
+#define TEST_SPEED_OF_SOUND_EIKONAL_TEST_H_
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "speed-of-sound-eikonal.h"
+
+class SpeedOfSoundEikonalTest : public ::testing::Test {
+ public:
+  // Environments of shape, the temperature rising along x when layered
+  auto Fill(const speedofsound::GridShape& shape, const bool layered) -> void;
+  auto Arrays() const -> speedofsound::EnvironmentArrays;
+  // Serial fast sweeping on the row-major grid, without blocks
+  auto Reference(const speedofsound::GridShape& shape, const size_t source_x,
+                 const size_t source_y, const size_t source_z) const
+      -> std::vector<double>;
+
+  std::vector<double> temperature_, humidity_, pressure_, co2_mole_fraction_;
+  // Sizes that are not multiples of the block edge
+  const speedofsound::GridShape kShape2d =
+      speedofsound::GridShape(45, 37, 1, 0.5);
+  const speedofsound::GridShape kShape3d =
+      speedofsound::GridShape(19, 13, 11, 0.25);
+  const std::vector<size_t> kThreadCounts = {1, 2, 4};
+};
+
+#endif  // TEST_SPEED_OF_SOUND_EIKONAL_TEST_H_
@@ -0,0 +1,154 @@
+#include "speed-of-sound-fixed_test.h"
+
+#include <math.h>
+
+namespace {
+
+// Computed independently from the same integer recipe; any change to the
+// rounding of an intermediate shows up here
+class Golden {
+ public:
+  speedofsound::FixedEnvironment environment_;
+  int32_t speed_of_sound_;
+};
+
+const Golden kGolden[] = {
+    {{0, 0, 75000, 0}, 21724367},
+    {{1966080, 65536, 102000, 42949672}, 22976497},
+    {{1966080, 65536, 75000, 42949672}, 23029415},
+    {{1310720, 32768, 101325, 1348620}, 22544017},
+    {{0, 65536, 102000, 0}, 21744262},
+    {{1966080, 0, 75000, 42949672}, 22822973},
+    {{679126, 19772, 87937, 3240447}, 22142768},
+    {{151909, 12337, 86982, 39110241}, 21770461},
+    {{121632, 28140, 76228, 5767821}, 21803787},
+    {{909420, 54810, 77289, 16150620}, 22307032},
+    {{190238, 55642, 76936, 37946955}, 21818244},
+    {{259631, 29260, 95664, 42106330}, 21838928},
+    {{1222633, 8108, 93910, 39295019}, 22409689},
+    {{831899, 6499, 82244, 3126110}, 22224666},
+    {{1167410, 17455, 84489, 28127945}, 22405097},
+    {{302524, 15439, 93707, 20701864}, 21886969}};
+
+}  // namespace
+
+template <typename Check>
+auto FixedSpeedOfSoundTest::ForEachEnvironment(const Check& check) const
+    -> void {
+  const int64_t n = kSteps - 1;
+  for (int64_t t = 0; t <= n; ++t) {
+    for (int64_t h = 0; h <= n; ++h) {
+      for (int64_t p = 0; p <= n; ++p) {
+        for (int64_t xc = 0; xc <= n; ++xc) {
+          check(speedofsound::FixedEnvironment(
+              static_cast<int32_t>(kTMax * t / n),
+              static_cast<int32_t>(kHMax * h / n),
+              static_cast<int32_t>(kPMin + (kPMax - kPMin) * p / n),
+              static_cast<int32_t>(kXcMax * xc / n)));
+        }
+      }
+    }
+  }
+}
+
+TEST_F(FixedSpeedOfSoundTest, ConstructorDefaultValues) {
+  const auto environment = fixed_speed_of_sound_.GetInitEnvironment();
+  const speedofsound::FixedEnvironment standard;
+  EXPECT_EQ(environment.temperature_, standard.temperature_);
+  EXPECT_EQ(environment.humidity_, standard.humidity_);
+  EXPECT_EQ(environment.pressure_, standard.pressure_);
+  EXPECT_EQ(environment.co2_mole_fraction_, standard.co2_mole_fraction_);
+  EXPECT_EQ(speedofsound::ToFixedEnvironment(speedofsound::Environment())
+                .co2_mole_fraction_,
+            standard.co2_mole_fraction_);
+  EXPECT_NEAR(ldexp(fixed_speed_of_sound_.GetInitSpeedOfSound(), -32),
+              speed_of_sound_.GetInitSpeedOfSound(), 1.0e-6);
+  EXPECT_NEAR(ldexp(fixed_speed_of_sound_.GetInitEnvironmentRate()
+                        .temperature_rate_,
+                    -speedofsound::kFixedTemperatureRateBits),
+              speed_of_sound_.GetInitEnvironmentRate().temperature_rate_,
+              1.0e-9);
+}
+
+TEST_F(FixedSpeedOfSoundTest, ValidateEnvironment) {
+  EXPECT_TRUE(speedofsound::FixedEnvironment().ValidateEnvironment());
+  EXPECT_TRUE(speedofsound::FixedEnvironment(0, 0, kPMin, 0)
+                  .ValidateEnvironment());
+  EXPECT_TRUE(speedofsound::FixedEnvironment(kTMax, kHMax, kPMax, kXcMax)
+                  .ValidateEnvironment());
+  EXPECT_FALSE(speedofsound::FixedEnvironment(-1, 0, kPMin, 0)
+                   .ValidateEnvironment());
+  EXPECT_FALSE(speedofsound::FixedEnvironment(0, kHMax + 1, kPMin, 0)
+                   .ValidateEnvironment());
+  EXPECT_FALSE(speedofsound::FixedEnvironment(0, 0, kPMin - 1, 0)
+                   .ValidateEnvironment());
+  EXPECT_FALSE(speedofsound::FixedEnvironment(0, 0, kPMin, kXcMax + 1)
+                   .ValidateEnvironment());
+  // The rounded-down maxima stay inside the double range
+  EXPECT_TRUE(speedofsound::ToEnvironment(
+                  speedofsound::FixedEnvironment(kTMax, kHMax, kPMax, kXcMax))
+                  .ValidateEnvironment());
+}
+
+TEST_F(FixedSpeedOfSoundTest, ConversionsRoundTrip) {
+  ForEachEnvironment([](const speedofsound::FixedEnvironment& environment) {
+    const auto converted = speedofsound::ToFixedEnvironment(
+        speedofsound::ToEnvironment(environment));
+    EXPECT_EQ(converted.temperature_, environment.temperature_);
+    EXPECT_EQ(converted.humidity_, environment.humidity_);
+    EXPECT_EQ(converted.pressure_, environment.pressure_);
+    EXPECT_EQ(converted.co2_mole_fraction_, environment.co2_mole_fraction_);
+  });
+  EXPECT_EQ(speedofsound::FixedToSpeedOfSound(22544017),
+            22544017.0 / 65536.0);
+}
+
+TEST_F(FixedSpeedOfSoundTest, QuickComputeIsBitExact) {
+  for (const auto& golden : kGolden) {
+    EXPECT_EQ(speedofsound::FixedQuickCompute(golden.environment_),
+              golden.speed_of_sound_);
+  }
+}
+
+TEST_F(FixedSpeedOfSoundTest, QuickComputeWithinMaxError) {
+  double max_error = 0.0;
+  ForEachEnvironment([&](const speedofsound::FixedEnvironment& environment) {
+    const auto error =
+        fabs(speedofsound::FixedToSpeedOfSound(
+                 speedofsound::FixedQuickCompute(environment)) -
+             speed_of_sound_.QuickCompute(
+                 speedofsound::ToEnvironment(environment)));
+    max_error = error > max_error ? error : max_error;
+  });
+  EXPECT_LT(max_error, speedofsound::kFixedMaxError);
+  // Not much more than the final rounding
+  EXPECT_GT(max_error, 0.4 * speedofsound::kFixedMaxError);
+}
+
+TEST_F(FixedSpeedOfSoundTest, ApproximateWithinMaxError) {
+  const speedofsound::SpeedOfSound speed_of_sound(
+      speedofsound::Environment(7.3, 0.81, 89123.4, 0.0042));
+  const speedofsound::FixedSpeedOfSound fixed_speed_of_sound(speed_of_sound);
+  ForEachEnvironment([&](const speedofsound::FixedEnvironment& environment) {
+    const auto ambient_conitions = speedofsound::ToEnvironment(environment);
+    EXPECT_NEAR(speedofsound::FixedToSpeedOfSound(
+                    fixed_speed_of_sound_.Approximate(environment)),
+                speed_of_sound_.Approximate(ambient_conitions),
+                speedofsound::kFixedMaxError);
+    EXPECT_NEAR(speedofsound::FixedToSpeedOfSound(
+                    fixed_speed_of_sound.Approximate(environment)),
+                speed_of_sound.Approximate(ambient_conitions),
+                speedofsound::kFixedMaxError);
+  });
+}
+
+// 352 m/s plus the four rounded terms, worked by hand
+TEST_F(FixedSpeedOfSoundTest, ApproximateIsBitExact) {
+  const speedofsound::FixedSpeedOfSound fixed_speed_of_sound(
+      speedofsound::FixedEnvironment(), static_cast<int64_t>(352) << 32,
+      speedofsound::FixedEnvironmentRate(651561165, 387441430, 16038212,
+                                         -1429934080));
+  const speedofsound::FixedEnvironment environment(655360, 6554, 95000,
+                                                   4294967);
+  EXPECT_EQ(fixed_speed_of_sound.Approximate(environment), 22628945);
+}
@@ -0,0 +1,28 @@
+#ifndef TEST_SPEED_OF_SOUND_FIXED_TEST_H_
+#define TEST_SPEED_OF_SOUND_FIXED_TEST_H_
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+
+#include "speed-of-sound-fixed.h"
+#include "speed-of-sound.h"
+
+class FixedSpeedOfSoundTest : public ::testing::Test {
+ public:
+  // Calls check on a grid over the valid fixed-point range that includes
+  // its corners
+  template <typename Check>
+  auto ForEachEnvironment(const Check& check) const -> void;
+
+  speedofsound::SpeedOfSound speed_of_sound_;
+  speedofsound::FixedSpeedOfSound fixed_speed_of_sound_;
+  const int kSteps = 13;
+  const int32_t kTMax = 1966080;
+  const int32_t kHMax = 65536;
+  const int32_t kPMin = 75000;
+  const int32_t kPMax = 102000;
+  const int32_t kXcMax = 42949672;
+};
+
+#endif  // TEST_SPEED_OF_SOUND_FIXED_TEST_H_
@@ -0,0 +1,85 @@
+#include "speed-of-sound-incremental_test.h"
+
+#include <math.h>
+
+auto IncrementalSpeedOfSoundTest::ExpectMatchesComputeRate(
+    speedofsound::IncrementalSpeedOfSound* incremental) const -> void {
+  speedofsound::EnvironmentRate rate;
+  const auto c =
+      speed_of_sound_.ComputeRate(incremental->GetEnvironment(), &rate);
+  EXPECT_EQ(incremental->GetSpeedOfSound(), c);
+  const auto incremental_rate = incremental->GetEnvironmentRate();
+  EXPECT_EQ(incremental_rate.temperature_rate_, rate.temperature_rate_);
+  EXPECT_EQ(incremental_rate.humidity_rate_, rate.humidity_rate_);
+  EXPECT_EQ(incremental_rate.pressure_rate_, rate.pressure_rate_);
+  EXPECT_EQ(incremental_rate.co2_mole_fraction_rate_,
+            rate.co2_mole_fraction_rate_);
+}
+
+TEST_F(IncrementalSpeedOfSoundTest, ConstructorDefaultValues) {
+  EXPECT_DOUBLE_EQ(incremental_.GetEnvironment().temperature_,
+                   speedofsound::theory::kStdTemperature);
+  EXPECT_EQ(incremental_.GetPsvEvaluationCount(), 0UL);
+  EXPECT_EQ(incremental_.GetSpeedOfSound(),
+            speed_of_sound_.GetInitSpeedOfSound());
+  EXPECT_EQ(incremental_.GetPsvEvaluationCount(), 1UL);
+}
+
+TEST_F(IncrementalSpeedOfSoundTest, IdenticalToComputeAfterEachChange) {
+  ExpectMatchesComputeRate(&incremental_);
+  for (auto i = 0; i < kSteps; ++i) {
+    const auto phase = 2.0 * M_PI * i / kSteps;
+    switch (i % 4) {
+      case 0:
+        incremental_.SetTemperature(15.0 + 10.0 * sin(phase));
+        break;
+      case 1:
+        incremental_.SetHumidity(0.5 + 0.4 * sin(3.0 * phase));
+        break;
+      case 2:
+        incremental_.SetPressure(90000.0 + 8000.0 * cos(2.0 * phase));
+        break;
+      default:
+        incremental_.SetCO2MoleFraction(0.005 + 0.004 * cos(phase));
+    }
+    // The rate only every few changes, so that stale inputs accumulate
+    if (i % 3 == 0) {
+      ExpectMatchesComputeRate(&incremental_);
+    } else {
+      ASSERT_EQ(incremental_.GetSpeedOfSound(),
+                speed_of_sound_.QuickCompute(incremental_.GetEnvironment()));
+    }
+  }
+}
+
+TEST_F(IncrementalSpeedOfSoundTest, OnlyTemperatureEvaluatesPsv) {
+  incremental_.GetSpeedOfSound();
+  const auto count = incremental_.GetPsvEvaluationCount();
+  incremental_.SetHumidity(0.8);
+  incremental_.GetSpeedOfSound();
+  incremental_.SetPressure(95000.0);
+  incremental_.SetCO2MoleFraction(0.002);
+  incremental_.GetEnvironmentRate();
+  incremental_.SetTemperature(speedofsound::theory::kStdTemperature);
+  incremental_.GetSpeedOfSound();
+  EXPECT_EQ(incremental_.GetPsvEvaluationCount(), count);
+  incremental_.SetTemperature(25.0);
+  incremental_.SetTemperature(26.0);
+  incremental_.GetSpeedOfSound();
+  incremental_.GetSpeedOfSound();
+  EXPECT_EQ(incremental_.GetPsvEvaluationCount(), count + 1);
+  ExpectMatchesComputeRate(&incremental_);
+}
+
+TEST_F(IncrementalSpeedOfSoundTest, ApproximateMatchesSpeedOfSound) {
+  speedofsound::Environment e(12.0, 0.3, 98000.0, 0.001);
+  incremental_.SetEnvironment(e);
+  speed_of_sound_.Compute(e);
+  e.temperature_ += 0.5;
+  e.humidity_ -= 0.05;
+  EXPECT_EQ(incremental_.Approximate(e), speed_of_sound_.Approximate(e));
+  const auto linearization = incremental_.GetLinearization();
+  EXPECT_EQ(linearization.Approximate(e), speed_of_sound_.Approximate(e));
+  EXPECT_EQ(linearization.GetInitSpeedOfSound(),
+            speed_of_sound_.GetInitSpeedOfSound());
+}
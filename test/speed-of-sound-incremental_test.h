@@ -0,0 +1,21 @@
+#ifndef TEST_SPEED_OF_SOUND_INCREMENTAL_TEST_H_
+#define TEST_SPEED_OF_SOUND_INCREMENTAL_TEST_H_
+
+#include "gtest/gtest.h"
+
+#include "speed-of-sound-incremental.h"
+#include "speed-of-sound.h"
+
+class IncrementalSpeedOfSoundTest : public ::testing::Test {
+ public:
+  // Expects the value and rate of incremental to be identical to
+  // ComputeRate at its environment
+  auto ExpectMatchesComputeRate(
+      speedofsound::IncrementalSpeedOfSound* incremental) const -> void;
+
+  speedofsound::SpeedOfSound speed_of_sound_;
+  speedofsound::IncrementalSpeedOfSound incremental_;
+  const int kSteps = 1000;
+};
+
+#endif  // TEST_SPEED_OF_SOUND_INCREMENTAL_TEST_H_
@@ -0,0 +1,141 @@
+#include "speed-of-sound-instrumentation_test.h"
+
+#include <math.h>
+#include <string.h>
+
+#include <thread>
+#include <vector>
+
+using speedofsound::instrumentation::kHistogramBuckets;
+using speedofsound::instrumentation::kSamplePeriod;
+using speedofsound::instrumentation::Probe;
+
+InstrumentationTest::InstrumentationTest() {
+  speedofsound::instrumentation::ResetInstrumentation();
+}
+
+template <typename Function>
+auto InstrumentationTest::OnNewThread(Function function) -> void {
+  std::thread thread(function);
+  thread.join();
+}
+
+auto InstrumentationTest::Total(const uint64_t* histogram) -> uint64_t {
+  uint64_t total = 0;
+  for (size_t i = 0; i < kHistogramBuckets; ++i) total += histogram[i];
+  return total;
+}
+
+TEST_F(InstrumentationTest, CountsCalls) {
+  speedofsound::SpeedOfSound speed_of_sound(kEnvironment);
+  speedofsound::EnvironmentRate rate;
+  for (size_t i = 0; i < kCalls; ++i) {
+    speed_of_sound.QuickCompute(kEnvironment);
+    speed_of_sound.Approximate(kEnvironment);
+    speed_of_sound.Approximate(kEnvironment);
+  }
+  speed_of_sound.ComputeRate(kEnvironment, &rate);
+  const auto snapshot = speedofsound::instrumentation::TakeSnapshot();
+  EXPECT_EQ(1u, snapshot.Calls(Probe::kCompute));
+  EXPECT_EQ(1u, snapshot.Calls(Probe::kComputeRate));
+  EXPECT_EQ(kCalls, snapshot.Calls(Probe::kQuickCompute));
+  EXPECT_EQ(2 * kCalls, snapshot.Calls(Probe::kApproximate));
+}
+
+TEST_F(InstrumentationTest, ResetStartsFromZero) {
+  const speedofsound::SpeedOfSound speed_of_sound(kEnvironment);
+  speed_of_sound.QuickCompute(kEnvironment);
+  speedofsound::instrumentation::ResetInstrumentation();
+  const auto snapshot = speedofsound::instrumentation::TakeSnapshot();
+  EXPECT_EQ(0u, snapshot.Calls(Probe::kCompute));
+  EXPECT_EQ(0u, snapshot.Calls(Probe::kQuickCompute));
+}
+
+TEST_F(InstrumentationTest, SamplesEveryPeriod) {
+  OnNewThread([this] {
+    const speedofsound::SpeedOfSound speed_of_sound(kEnvironment);
+    for (size_t i = 0; i < 3 * kSamplePeriod; ++i) {
+      speed_of_sound.Approximate(kEnvironment);
+    }
+  });
+  const auto snapshot = speedofsound::instrumentation::TakeSnapshot();
+  const auto approximate = static_cast<size_t>(Probe::kApproximate);
+  EXPECT_EQ(3u, snapshot.samples_[approximate]);
+  EXPECT_EQ(1u, snapshot.samples_[static_cast<size_t>(Probe::kCompute)]);
+  EXPECT_EQ(3u, Total(snapshot.drift_));
+  EXPECT_EQ(3u, Total(snapshot.approximation_error_));
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+  EXPECT_GT(snapshot.MeanCycles(Probe::kCompute), 0.0);
+#endif
+}
+
+TEST_F(InstrumentationTest, DriftAndErrorHistograms) {
+  auto drifted = kEnvironment;
+  // A sixteenth of the temperature range, 2^-4
+  drifted.temperature_ += (speedofsound::theory::kMaxTemperature -
+                           speedofsound::theory::kMinTemperature) /
+                          16.0;
+  double error = 0.0;
+  OnNewThread([this, &drifted, &error] {
+    const speedofsound::SpeedOfSound speed_of_sound(kEnvironment);
+    error = fabs(speed_of_sound.Approximate(drifted) -
+                 speed_of_sound.QuickCompute(drifted));
+  });
+  const auto snapshot = speedofsound::instrumentation::TakeSnapshot();
+  EXPECT_EQ(1u, snapshot.drift_[speedofsound::instrumentation::HistogramBucket(
+                    1.0 / 16.0)]);
+  EXPECT_EQ(1u, Total(snapshot.drift_));
+  EXPECT_EQ(1u, snapshot.approximation_error_
+                    [speedofsound::instrumentation::HistogramBucket(error)]);
+}
+
+TEST_F(InstrumentationTest, HistogramBucket) {
+  using speedofsound::instrumentation::HistogramBucket;
+  using speedofsound::instrumentation::kHistogramMinExponent;
+  EXPECT_EQ(0u, HistogramBucket(0.0));
+  EXPECT_EQ(0u, HistogramBucket(ldexp(0.99, kHistogramMinExponent)));
+  EXPECT_EQ(1u, HistogramBucket(ldexp(1.0, kHistogramMinExponent)));
+  EXPECT_EQ(1u, HistogramBucket(ldexp(1.99, kHistogramMinExponent)));
+  EXPECT_EQ(2u, HistogramBucket(ldexp(1.0, kHistogramMinExponent + 1)));
+  EXPECT_EQ(kHistogramBuckets - 1, HistogramBucket(1.0e9));
+  EXPECT_EQ(0u, HistogramBucket(NAN));
+}
+
+TEST_F(InstrumentationTest, CountsInvalidEnvironments) {
+  const speedofsound::Environment invalid(20.0, 1.5, 101325.0, 0.0004);
+  EXPECT_TRUE(kEnvironment.ValidateEnvironment());
+  EXPECT_FALSE(invalid.ValidateEnvironment());
+  EXPECT_FALSE(invalid.ValidateEnvironment());
+  const auto snapshot = speedofsound::instrumentation::TakeSnapshot();
+  EXPECT_EQ(2u, snapshot.invalid_environments_);
+}
+
+TEST_F(InstrumentationTest, SumsThreads) {
+  std::vector<std::thread> threads;
+  for (auto i = 0; i < 4; ++i) {
+    threads.emplace_back([this] {
+      const speedofsound::SpeedOfSound speed_of_sound(kEnvironment);
+      for (size_t j = 0; j < kCalls; ++j) {
+        speed_of_sound.QuickCompute(kEnvironment);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  const auto snapshot = speedofsound::instrumentation::TakeSnapshot();
+  EXPECT_EQ(4u, snapshot.Calls(Probe::kCompute));
+  EXPECT_EQ(4 * kCalls, snapshot.Calls(Probe::kQuickCompute));
+}
+
+TEST_F(InstrumentationTest, FormatJson) {
+  const speedofsound::SpeedOfSound speed_of_sound(kEnvironment);
+  speed_of_sound.Approximate(kEnvironment);
+  const auto snapshot = speedofsound::instrumentation::TakeSnapshot();
+  char text[2048];
+  ASSERT_TRUE(
+      speedofsound::instrumentation::FormatJson(snapshot, text, sizeof(text)));
+  EXPECT_EQ('{', text[0]);
+  EXPECT_EQ('}', text[strlen(text) - 1]);
+  EXPECT_NE(nullptr, strstr(text, "\"approximate\":{\"calls\":1,"));
+  EXPECT_NE(nullptr, strstr(text, "\"drift\":["));
+  EXPECT_FALSE(speedofsound::instrumentation::FormatJson(snapshot, text, 64));
+}
@@ -0,0 +1,24 @@
+#ifndef TEST_SPEED_OF_SOUND_INSTRUMENTATION_TEST_H_
+#define TEST_SPEED_OF_SOUND_INSTRUMENTATION_TEST_H_
+
+#include "gtest/gtest.h"
+
+#include "speed-of-sound-instrumentation.h"
+#include "speed-of-sound.h"
+
+class InstrumentationTest : public ::testing::Test {
+ public:
+  InstrumentationTest();
+
+  // Runs function on a new thread, whose counters start at zero so that its
+  // first call of each probe is sampled
+  template <typename Function>
+  auto OnNewThread(Function function) -> void;
+  static auto Total(const uint64_t* histogram) -> uint64_t;
+
+  const speedofsound::Environment kEnvironment =
+      speedofsound::Environment(20.0, 0.5, 101325.0, 0.0004);
+  const size_t kCalls = 1000;
+};
+
+#endif  // TEST_SPEED_OF_SOUND_INSTRUMENTATION_TEST_H_
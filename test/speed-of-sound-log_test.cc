@@ -0,0 +1,257 @@
+#include "speed-of-sound-log_test.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "speed-of-sound-theory.h"
+
+LogTest::LogTest()
+    : input_path_("speed-of-sound-log_test." +
+                  std::to_string(static_cast<long>(getpid())) + ".in"),
+      output_path_("speed-of-sound-log_test." +
+                   std::to_string(static_cast<long>(getpid())) + ".out") {
+  using speedofsound::theory::kMaxCO2MoleFraction;
+  using speedofsound::theory::kMaxHumidity;
+  using speedofsound::theory::kMaxPressure;
+  using speedofsound::theory::kMaxTemperature;
+  using speedofsound::theory::kMinCO2MoleFraction;
+  using speedofsound::theory::kMinHumidity;
+  using speedofsound::theory::kMinPressure;
+  using speedofsound::theory::kMinTemperature;
+  for (size_t i = 0; i < kCount; ++i) {
+    const auto fraction = static_cast<double>(i) / (kCount - 1);
+    environments_.push_back(speedofsound::Environment(
+        kMinTemperature + (kMaxTemperature - kMinTemperature) * fraction,
+        kMinHumidity + (kMaxHumidity - kMinHumidity) * (i % 11) / 10.0,
+        kMinPressure + (kMaxPressure - kMinPressure) * (i % 7) / 6.0,
+        kMinCO2MoleFraction +
+            (kMaxCO2MoleFraction - kMinCO2MoleFraction) * (i % 3) / 2.0));
+  }
+}
+
+LogTest::~LogTest() {
+  remove(input_path_.c_str());
+  remove(output_path_.c_str());
+}
+
+auto LogTest::WriteFile(const std::string& path,
+                        const std::string& contents) const -> void {
+  auto file = fopen(path.c_str(), "wb");
+  ASSERT_NE(nullptr, file);
+  ASSERT_EQ(contents.size(), fwrite(contents.data(), 1, contents.size(), file));
+  ASSERT_EQ(0, fclose(file));
+}
+
+auto LogTest::WriteCsv() const -> void {
+  std::string contents = "temperature,humidity,pressure,co2\n# Sensor log\n";
+  char line[128];
+  for (const auto& environment : environments_) {
+    snprintf(line, sizeof(line), "%.17g, %.17g,%.17g ,%.17g\r\n",
+             environment.temperature_, environment.humidity_,
+             environment.pressure_, environment.co2_mole_fraction_);
+    contents += line;
+    if (contents.size() % 7 == 0) contents += "\n# comment\n";
+  }
+  WriteFile(input_path_, contents);
+}
+
+auto LogTest::WriteBinary() const -> void {
+  WriteFile(input_path_,
+            std::string(reinterpret_cast<const char*>(environments_.data()),
+                        environments_.size() * sizeof(environments_[0])));
+}
+
+auto LogTest::Process(const speedofsound::LogFormat input_format,
+                      const speedofsound::LogFormat output_format,
+                      const speedofsound::LogEngine engine,
+                      const double tolerance,
+                      speedofsound::LogStatistics* statistics) const
+    -> std::vector<double> {
+  std::vector<double> speed_of_sound;
+  speedofsound::LogReader reader;
+  EXPECT_TRUE(reader.Open(input_path_.c_str(), input_format));
+  auto output = fopen(output_path_.c_str(), "wb");
+  EXPECT_NE(nullptr, output);
+  if (output == nullptr) return speed_of_sound;
+  speedofsound::LogWriter writer(output, output_format);
+  EXPECT_TRUE(speedofsound::ProcessLog(&reader, &writer, engine, tolerance,
+                                       statistics));
+  EXPECT_EQ(0, fclose(output));
+  auto input = fopen(output_path_.c_str(), "rb");
+  EXPECT_NE(nullptr, input);
+  if (input == nullptr) return speed_of_sound;
+  double value;
+  while (output_format == speedofsound::LogFormat::kBinary
+             ? fread(&value, sizeof(value), 1, input) == 1
+             : fscanf(input, "%lf", &value) == 1) {
+    speed_of_sound.push_back(value);
+  }
+  fclose(input);
+  return speed_of_sound;
+}
+
+TEST_F(LogTest, CsvMatchesQuickCompute) {
+  WriteCsv();
+  speedofsound::LogStatistics statistics;
+  const auto c =
+      Process(speedofsound::LogFormat::kCsv, speedofsound::LogFormat::kCsv,
+              speedofsound::LogEngine::kQuickCompute, 0.0, &statistics);
+  ASSERT_EQ(kCount, c.size());
+  EXPECT_EQ(kCount, statistics.records_);
+  EXPECT_EQ(0u, statistics.invalid_records_);
+  const auto kResolution = 0.5 / pow(10.0, speedofsound::kLogCsvDecimals);
+  for (size_t i = 0; i < kCount; ++i) {
+    ASSERT_NEAR(speed_of_sound_.QuickCompute(environments_[i]), c[i],
+                kResolution);
+  }
+}
+
+TEST_F(LogTest, BinaryMatchesQuickCompute) {
+  WriteBinary();
+  speedofsound::LogStatistics statistics;
+  const auto c = Process(
+      speedofsound::LogFormat::kBinary, speedofsound::LogFormat::kBinary,
+      speedofsound::LogEngine::kQuickCompute, 0.0, &statistics);
+  ASSERT_EQ(kCount, c.size());
+  EXPECT_EQ(kCount * sizeof(environments_[0]), statistics.bytes_read_);
+  EXPECT_EQ(kCount * sizeof(double), statistics.bytes_written_);
+  for (size_t i = 0; i < kCount; ++i) {
+    ASSERT_EQ(speed_of_sound_.QuickCompute(environments_[i]), c[i]);
+  }
+}
+
+TEST_F(LogTest, ApproximateWithinTolerance) {
+  const auto kTolerance = 0.01;
+  WriteBinary();
+  speedofsound::LogStatistics statistics;
+  const auto c = Process(
+      speedofsound::LogFormat::kBinary, speedofsound::LogFormat::kBinary,
+      speedofsound::LogEngine::kApproximate, kTolerance, &statistics);
+  ASSERT_EQ(kCount, c.size());
+  for (size_t i = 0; i < kCount; ++i) {
+    ASSERT_NEAR(speed_of_sound_.QuickCompute(environments_[i]), c[i],
+                kTolerance);
+  }
+}
+
+TEST_F(LogTest, InvalidEnvironmentsAreNan) {
+  WriteFile(input_path_,
+            "20,0.5,101325,0.0004\n"
+            "200,0.5,101325,0.0004\n"
+            "20,0.5,101325,0.0004");
+  speedofsound::LogStatistics statistics;
+  const auto c =
+      Process(speedofsound::LogFormat::kCsv, speedofsound::LogFormat::kBinary,
+              speedofsound::LogEngine::kQuickCompute, 0.0, &statistics);
+  ASSERT_EQ(3u, c.size());
+  EXPECT_EQ(1u, statistics.invalid_records_);
+  EXPECT_FALSE(isnan(c[0]));
+  EXPECT_TRUE(isnan(c[1]));
+  EXPECT_EQ(c[0], c[2]);
+}
+
+TEST_F(LogTest, MalformedRecords) {
+  speedofsound::LogReader reader;
+  double t[4], h[4], p[4], xc[4];
+  WriteFile(input_path_,
+            "temperature,humidity,pressure,co2\n"
+            "20,0.5,101325,0.0004\n"
+            "\n"
+            "20,0.5,101325\n"
+            "20,0.5,101325,0.0004\n");
+  ASSERT_TRUE(reader.Open(input_path_.c_str(), speedofsound::LogFormat::kCsv));
+  EXPECT_EQ(1u, reader.Read(4, t, h, p, xc));
+  EXPECT_TRUE(reader.HasError());
+  EXPECT_EQ(4u, reader.GetErrorLine());
+  EXPECT_EQ(0u, reader.Read(4, t, h, p, xc));
+  // Only a first line without numbers is a header
+  WriteFile(input_path_, "20,0.5,101325,0.0004x\n");
+  ASSERT_TRUE(reader.Open(input_path_.c_str(), speedofsound::LogFormat::kCsv));
+  EXPECT_EQ(0u, reader.Read(4, t, h, p, xc));
+  EXPECT_TRUE(reader.HasError());
+  EXPECT_EQ(1u, reader.GetErrorLine());
+  WriteFile(input_path_,
+            "# comment\n"
+            "temperature,humidity,pressure,co2\n"
+            "20,0.5,101325,0.0004\n");
+  ASSERT_TRUE(reader.Open(input_path_.c_str(), speedofsound::LogFormat::kCsv));
+  EXPECT_EQ(0u, reader.Read(4, t, h, p, xc));
+  EXPECT_TRUE(reader.HasError());
+  EXPECT_EQ(2u, reader.GetErrorLine());
+  WriteFile(input_path_, std::string(3 * sizeof(double), '\0'));
+  EXPECT_FALSE(
+      reader.Open(input_path_.c_str(), speedofsound::LogFormat::kBinary));
+  EXPECT_FALSE(reader.Open("", speedofsound::LogFormat::kCsv));
+}
+
+TEST_F(LogTest, EmptyLog) {
+  WriteFile(input_path_, "");
+  speedofsound::LogReader reader;
+  double t, h, p, xc;
+  ASSERT_TRUE(reader.Open(input_path_.c_str(), speedofsound::LogFormat::kCsv));
+  EXPECT_EQ(0u, reader.GetSize());
+  EXPECT_EQ(0u, reader.Read(1, &t, &h, &p, &xc));
+  EXPECT_FALSE(reader.HasError());
+}
+
+TEST_F(LogTest, FieldsMatchStrtod) {
+  const std::vector<std::string> kFields = {
+      "20",     "-3.75",      "+0.5",          ".25",
+      "101325", "0.0004",     "20.",           "-0.0",
+      "1e-3",   "2.5E4",      "0x1p-2",        "123456789012345",
+      "0.1",    "0.30000001", "1234567.891234", "0.00000000000000000000001",
+      "1234567890123456789", "3.14159265358979323846", "7", "-12.5"};
+  std::string contents;
+  for (size_t i = 0; i < kFields.size(); ++i) {
+    contents += kFields[i] + (i % 4 == 3 ? "\n" : ",");
+  }
+  WriteFile(input_path_, contents);
+  speedofsound::LogReader reader;
+  ASSERT_TRUE(reader.Open(input_path_.c_str(), speedofsound::LogFormat::kCsv));
+  const auto kRecords = kFields.size() / 4;
+  std::vector<double> t(kRecords), h(kRecords), p(kRecords), xc(kRecords);
+  ASSERT_EQ(kRecords,
+            reader.Read(kRecords, t.data(), h.data(), p.data(), xc.data()));
+  for (size_t i = 0; i < kRecords; ++i) {
+    EXPECT_EQ(strtod(kFields[4 * i].c_str(), nullptr), t[i]);
+    EXPECT_EQ(strtod(kFields[4 * i + 1].c_str(), nullptr), h[i]);
+    EXPECT_EQ(strtod(kFields[4 * i + 2].c_str(), nullptr), p[i]);
+    EXPECT_EQ(strtod(kFields[4 * i + 3].c_str(), nullptr), xc[i]);
+  }
+}
+
+TEST_F(LogTest, CsvOutput) {
+  const double kValues[] = {331.25, 0.0, -2.5, 4.0e-10, -6.0e-10, 1.0e12,
+                            NAN};
+  auto output = fopen(output_path_.c_str(), "wb");
+  ASSERT_NE(nullptr, output);
+  speedofsound::LogWriter writer(output, speedofsound::LogFormat::kCsv);
+  ASSERT_TRUE(writer.Write(kValues, sizeof(kValues) / sizeof(kValues[0])));
+  ASSERT_TRUE(writer.Flush());
+  ASSERT_EQ(0, fclose(output));
+  auto input = fopen(output_path_.c_str(), "rb");
+  ASSERT_NE(nullptr, input);
+  char text[256] = {};
+  const auto length = fread(text, 1, sizeof(text) - 1, input);
+  fclose(input);
+  EXPECT_EQ(length, writer.GetBytesWritten());
+  EXPECT_STREQ(
+      "331.250000000\n0.000000000\n-2.500000000\n0.000000000\n"
+      "-0.000000001\n1000000000000\nnan\n",
+      text);
+}
+
+TEST_F(LogTest, FailedWriteNotCounted) {
+  const double kValues[] = {331.25, 343.5};
+  WriteFile(output_path_, "");
+  // Writes to a stream opened for reading fail
+  auto output = fopen(output_path_.c_str(), "rb");
+  ASSERT_NE(nullptr, output);
+  speedofsound::LogWriter writer(output, speedofsound::LogFormat::kCsv);
+  ASSERT_TRUE(writer.Write(kValues, sizeof(kValues) / sizeof(kValues[0])));
+  EXPECT_FALSE(writer.Flush());
+  EXPECT_EQ(0u, writer.GetBytesWritten());
+  fclose(output);
+}
@@ -0,0 +1,36 @@
+#ifndef TEST_SPEED_OF_SOUND_LOG_TEST_H_
+#define TEST_SPEED_OF_SOUND_LOG_TEST_H_
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "environment.h"
+#include "speed-of-sound-log.h"
+#include "speed-of-sound.h"
+
+class LogTest : public ::testing::Test {
+ public:
+  LogTest();
+  ~LogTest() override;
+  auto WriteFile(const std::string& path, const std::string& contents) const
+      -> void;
+  auto WriteCsv() const -> void;
+  auto WriteBinary() const -> void;
+  // Runs ProcessLog from input_path_ into output_path_ and reads the output
+  auto Process(const speedofsound::LogFormat input_format,
+               const speedofsound::LogFormat output_format,
+               const speedofsound::LogEngine engine, const double tolerance,
+               speedofsound::LogStatistics* statistics) const
+      -> std::vector<double>;
+
+  speedofsound::SpeedOfSound speed_of_sound_;
+  std::vector<speedofsound::Environment> environments_;
+  std::string input_path_;
+  std::string output_path_;
+  // Spans several blocks, with a partial last block
+  const size_t kCount = 3 * speedofsound::kLogBlockSize + 17;
+};
+
+#endif  // TEST_SPEED_OF_SOUND_LOG_TEST_H_
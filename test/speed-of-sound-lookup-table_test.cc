@@ -0,0 +1,183 @@
+#include "speed-of-sound-lookup-table_test.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "speed-of-sound-theory.h"
+
+LookupTableTest::LookupTableTest()
+    : path_("speed-of-sound-lookup-table_test." +
+            std::to_string(static_cast<long>(getpid())) + ".bin") {}
+
+LookupTableTest::~LookupTableTest() { remove(path_.c_str()); }
+
+auto LookupTableTest::ExpectMapRejectsPatchedHeader(const long offset,
+                                                    const void* data,
+                                                    const size_t size)
+    -> void {
+  ASSERT_TRUE(lookup_table_.Build(kResolution));
+  ASSERT_TRUE(lookup_table_.Save(path_.c_str()));
+  auto file = fopen(path_.c_str(), "r+b");
+  ASSERT_NE(nullptr, file);
+  ASSERT_EQ(0, fseek(file, offset, SEEK_SET));
+  ASSERT_EQ(1U, fwrite(data, size, 1, file));
+  ASSERT_EQ(0, fclose(file));
+  EXPECT_FALSE(lookup_table_.Map(path_.c_str())) << "offset " << offset;
+  EXPECT_FALSE(lookup_table_.IsValid());
+}
+
+TEST_F(LookupTableTest, DefaultResolutionIsValid) {
+  EXPECT_TRUE(speedofsound::LookupTableResolution().Validate());
+  EXPECT_FALSE(speedofsound::LookupTableResolution(1, 2, 2, 2).Validate());
+  EXPECT_FALSE(lookup_table_.IsValid());
+  EXPECT_FALSE(lookup_table_.Build(
+      speedofsound::LookupTableResolution(2, 2, 0, 2)));
+  EXPECT_FALSE(lookup_table_.IsValid());
+}
+
+TEST_F(LookupTableTest, InterpolationExactAtGridPoints) {
+  ASSERT_TRUE(lookup_table_.Build(kResolution));
+  speedofsound::Environment environment;
+  environment.temperature_ = speedofsound::theory::kMinTemperature;
+  environment.humidity_ = speedofsound::theory::kMinHumidity;
+  environment.pressure_ = speedofsound::theory::kMinPressure;
+  environment.co2_mole_fraction_ = speedofsound::theory::kMinCO2MoleFraction;
+  EXPECT_DOUBLE_EQ(speed_of_sound_.QuickCompute(environment),
+                   lookup_table_.Interpolate(environment));
+  environment.temperature_ = speedofsound::theory::kMaxTemperature;
+  environment.humidity_ = speedofsound::theory::kMaxHumidity;
+  environment.pressure_ = speedofsound::theory::kMaxPressure;
+  environment.co2_mole_fraction_ = speedofsound::theory::kMaxCO2MoleFraction;
+  EXPECT_DOUBLE_EQ(speed_of_sound_.QuickCompute(environment),
+                   lookup_table_.Interpolate(environment));
+  environment.temperature_ = 10.0;
+  environment.humidity_ = 0.4;
+  environment.pressure_ = 88500.0;
+  environment.co2_mole_fraction_ = 0.005;
+  EXPECT_DOUBLE_EQ(speed_of_sound_.QuickCompute(environment),
+                   lookup_table_.Interpolate(environment));
+}
+
+TEST_F(LookupTableTest, InterpolationWithinReportedError) {
+  ASSERT_TRUE(lookup_table_.Build(kResolution));
+  const auto max_error = lookup_table_.GetMaxInterpolationError();
+  EXPECT_GT(max_error, 0.0);
+  const auto t_min = speedofsound::theory::kMinTemperature;
+  const auto t_max = speedofsound::theory::kMaxTemperature;
+  const auto h_min = speedofsound::theory::kMinHumidity;
+  const auto h_max = speedofsound::theory::kMaxHumidity;
+  const auto p_min = speedofsound::theory::kMinPressure;
+  const auto p_max = speedofsound::theory::kMaxPressure;
+  const auto xc_min = speedofsound::theory::kMinCO2MoleFraction;
+  const auto xc_max = speedofsound::theory::kMaxCO2MoleFraction;
+  speedofsound::Environment e;
+  for (auto t = t_min; t <= t_max; t += (t_max - t_min) * kIncrementFactor) {
+    for (auto h = h_min; h <= h_max; h += (h_max - h_min) * kIncrementFactor) {
+      for (auto p = p_min; p <= p_max;
+           p += (p_max - p_min) * kIncrementFactor) {
+        for (auto xc = xc_min; xc <= xc_max;
+             xc += (xc_max - xc_min) * kIncrementFactor) {
+          e.temperature_ = t;
+          e.humidity_ = h;
+          e.pressure_ = p;
+          e.co2_mole_fraction_ = xc;
+          ASSERT_NEAR(speed_of_sound_.QuickCompute(e),
+                      lookup_table_.Interpolate(e), max_error);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(LookupTableTest, FinerResolutionReducesError) {
+  ASSERT_TRUE(lookup_table_.Build(kResolution));
+  const auto coarse_error = lookup_table_.GetMaxInterpolationError();
+  ASSERT_TRUE(lookup_table_.Build(speedofsound::LookupTableResolution()));
+  EXPECT_LT(lookup_table_.GetMaxInterpolationError(), coarse_error);
+}
+
+TEST_F(LookupTableTest, InterpolateNaN) {
+  const speedofsound::Environment environment;
+  EXPECT_TRUE(isnan(lookup_table_.Interpolate(environment)));
+  ASSERT_TRUE(lookup_table_.Build(kResolution));
+  EXPECT_FALSE(isnan(lookup_table_.Interpolate(environment)));
+  for (size_t axis = 0; axis < 4; ++axis) {
+    auto nan_environment = environment;
+    double* x[4] = {&nan_environment.temperature_, &nan_environment.humidity_,
+                    &nan_environment.pressure_,
+                    &nan_environment.co2_mole_fraction_};
+    *x[axis] = NAN;
+    EXPECT_TRUE(isnan(lookup_table_.Interpolate(nan_environment))) << axis;
+  }
+}
+
+TEST_F(LookupTableTest, SaveAndMapRoundTrip) {
+  ASSERT_TRUE(lookup_table_.Build(kResolution));
+  ASSERT_TRUE(lookup_table_.Save(path_.c_str()));
+  speedofsound::LookupTable mapped_table;
+  ASSERT_TRUE(mapped_table.Map(path_.c_str()));
+  EXPECT_EQ(kResolution.Points(), mapped_table.GetResolution().Points());
+  EXPECT_EQ(lookup_table_.GetMaxInterpolationError(),
+            mapped_table.GetMaxInterpolationError());
+  speedofsound::Environment e;
+  for (auto t = 0.3; t < 30.0; t += 1.7) {
+    e.temperature_ = t;
+    e.humidity_ = t / 30.0;
+    EXPECT_EQ(lookup_table_.Interpolate(e), mapped_table.Interpolate(e));
+  }
+}
+
+TEST_F(LookupTableTest, MapRejectsInvalidFiles) {
+  EXPECT_FALSE(lookup_table_.Map(path_.c_str()));
+  auto file = fopen(path_.c_str(), "wb");
+  ASSERT_NE(nullptr, file);
+  fputs("not a lookup table", file);
+  fclose(file);
+  EXPECT_FALSE(lookup_table_.Map(path_.c_str()));
+  EXPECT_FALSE(lookup_table_.IsValid());
+
+  ASSERT_TRUE(lookup_table_.Build(kResolution));
+  ASSERT_TRUE(lookup_table_.Save(path_.c_str()));
+  ASSERT_EQ(0, truncate(path_.c_str(), 200));
+  EXPECT_FALSE(lookup_table_.Map(path_.c_str()));
+  EXPECT_FALSE(lookup_table_.IsValid());
+}
+
+TEST_F(LookupTableTest, MapRejectsNonFiniteAxes) {
+  const auto nan = static_cast<double>(NAN);
+  const auto infinity = static_cast<double>(INFINITY);
+  ExpectMapRejectsPatchedHeader(kMinOffset, &nan, sizeof(nan));
+  ExpectMapRejectsPatchedHeader(kMaxOffset + 8, &infinity, sizeof(infinity));
+}
+
+TEST_F(LookupTableTest, MapRejectsReversedAxes) {
+  // Humidity from 1 down to 1
+  const auto humidity = speedofsound::theory::kMaxHumidity;
+  ExpectMapRejectsPatchedHeader(kMinOffset + 8, &humidity, sizeof(humidity));
+  const double temperatures[2] = {speedofsound::theory::kMaxTemperature,
+                                  speedofsound::theory::kMinTemperature};
+  ExpectMapRejectsPatchedHeader(kMinOffset, &temperatures[0],
+                                sizeof(double));
+  ExpectMapRejectsPatchedHeader(kMaxOffset, &temperatures[1],
+                                sizeof(double));
+}
+
+TEST_F(LookupTableTest, MapRejectsAxesOutsideValidRange) {
+  const auto temperature = speedofsound::theory::kMinTemperature - 10.0;
+  ExpectMapRejectsPatchedHeader(kMinOffset, &temperature, sizeof(temperature));
+  const auto pressure = speedofsound::theory::kMaxPressure + 1.0;
+  ExpectMapRejectsPatchedHeader(kMaxOffset + 16, &pressure, sizeof(pressure));
+}
+
+TEST_F(LookupTableTest, MapRejectsOverflowingPointCounts) {
+  // The product of the point counts wraps around to that of kResolution,
+  // which matches the file size
+  const uint64_t points = kResolution.temperature_points_ + (1ULL << 63);
+  ExpectMapRejectsPatchedHeader(kPointsOffset, &points, sizeof(points));
+  // Too many cells for the cell indices
+  const uint64_t large_points = 1ULL << 31;
+  ExpectMapRejectsPatchedHeader(kPointsOffset + 24, &large_points,
+                                sizeof(large_points));
+}
@@ -0,0 +1,32 @@
+#ifndef TEST_SPEED_OF_SOUND_LOOKUP_TABLE_TEST_H_
+#define TEST_SPEED_OF_SOUND_LOOKUP_TABLE_TEST_H_
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "speed-of-sound-lookup-table.h"
+#include "speed-of-sound.h"
+
+class LookupTableTest : public ::testing::Test {
+ public:
+  LookupTableTest();
+  ~LookupTableTest() override;
+  // Saves a table at kResolution, overwrites size bytes of its header at
+  // offset with data and expects Map to reject the file
+  auto ExpectMapRejectsPatchedHeader(const long offset, const void* data,
+                                     const size_t size) -> void;
+
+  speedofsound::SpeedOfSound speed_of_sound_;
+  speedofsound::LookupTable lookup_table_;
+  std::string path_;
+  const speedofsound::LookupTableResolution kResolution =
+      speedofsound::LookupTableResolution(31, 6, 5, 3);
+  const double kIncrementFactor = 3.0 / 100.0;
+  // Offsets of the header fields in the file, per axis
+  const long kPointsOffset = 16;
+  const long kMinOffset = 48;
+  const long kMaxOffset = 80;
+};
+
+#endif  // TEST_SPEED_OF_SOUND_LOOKUP_TABLE_TEST_H_
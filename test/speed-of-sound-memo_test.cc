@@ -0,0 +1,120 @@
+#include "speed-of-sound-memo_test.h"
+
+#include <math.h>
+
+#include <thread>
+#include <vector>
+
+MemoizedSpeedOfSoundTest::MemoizedSpeedOfSoundTest() : memo_(kCapacity) {}
+
+auto MemoizedSpeedOfSoundTest::Reading(const int i) const
+    -> speedofsound::Environment {
+  const auto step = i % kDistinctReadings;
+  return speedofsound::Environment(20.0 + 0.01 * step, 0.5, 101325.0 + step,
+                                   0.0004);
+}
+
+TEST_F(MemoizedSpeedOfSoundTest, ConstructorDefaultValues) {
+  EXPECT_TRUE(memo_.IsValid());
+  EXPECT_EQ(memo_.GetCapacity(), kCapacity);
+  EXPECT_EQ(speedofsound::MemoizedSpeedOfSound(1).GetCapacity(),
+            speedofsound::MemoizedSpeedOfSound::kWays);
+  EXPECT_EQ(speedofsound::MemoizedSpeedOfSound(300).GetCapacity(), 512UL);
+  EXPECT_EQ(memo_.GetStatistics().hits_, 0UL);
+  EXPECT_EQ(memo_.GetStatistics().misses_, 0UL);
+  EXPECT_DOUBLE_EQ(memo_.GetStatistics().HitRate(), 0.0);
+  EXPECT_FALSE(speedofsound::MemoizedSpeedOfSound(
+                   kCapacity, speedofsound::Quantization(0.01, 0.0, 1.0, 1e-6))
+                   .IsValid());
+}
+
+TEST_F(MemoizedSpeedOfSoundTest, RepeatedReadingsHit) {
+  for (auto i = 0; i < 10 * kDistinctReadings; ++i) {
+    const auto e = Reading(i);
+    ASSERT_NEAR(memo_.QuickCompute(e), speed_of_sound_.QuickCompute(e),
+                1.0e-9);
+  }
+  const auto statistics = memo_.GetStatistics();
+  EXPECT_EQ(statistics.misses_, static_cast<uint64_t>(kDistinctReadings));
+  EXPECT_EQ(statistics.hits_, static_cast<uint64_t>(9 * kDistinctReadings));
+  EXPECT_DOUBLE_EQ(statistics.HitRate(), 0.9);
+  EXPECT_EQ(statistics.evictions_, 0UL);
+  memo_.ResetStatistics();
+  EXPECT_EQ(memo_.GetStatistics().hits_, 0UL);
+  memo_.Clear();
+  memo_.QuickCompute(Reading(0));
+  EXPECT_EQ(memo_.GetStatistics().misses_, 1UL);
+}
+
+TEST_F(MemoizedSpeedOfSoundTest, ResultsAtQuantizedEnvironment) {
+  speedofsound::Environment e;
+  const auto c = memo_.QuickCompute(e);
+  e.temperature_ += 0.004;
+  e.pressure_ += 0.4;
+  EXPECT_EQ(memo_.QuickCompute(e), c);
+  EXPECT_EQ(memo_.GetStatistics().hits_, 1UL);
+  e.temperature_ += 0.002;
+  EXPECT_NE(memo_.QuickCompute(e), c);
+  EXPECT_EQ(memo_.GetStatistics().misses_, 2UL);
+}
+
+TEST_F(MemoizedSpeedOfSoundTest, BoundedSizeEvictsUnreferenced) {
+  speedofsound::MemoizedSpeedOfSound memo(
+      speedofsound::MemoizedSpeedOfSound::kWays);
+  ASSERT_EQ(memo.GetCapacity(), speedofsound::MemoizedSpeedOfSound::kWays);
+  const auto ways = static_cast<int>(memo.GetCapacity());
+  for (auto i = 0; i < ways; ++i) memo.QuickCompute(Reading(i));
+  // Second chance for the first reading only
+  memo.QuickCompute(Reading(0));
+  memo.QuickCompute(Reading(ways));
+  EXPECT_EQ(memo.GetStatistics().evictions_, 1UL);
+  memo.ResetStatistics();
+  memo.QuickCompute(Reading(0));
+  memo.QuickCompute(Reading(1));
+  EXPECT_EQ(memo.GetStatistics().hits_, 1UL);
+  EXPECT_EQ(memo.GetStatistics().misses_, 1UL);
+  for (auto i = 0; i < 10 * ways; ++i) memo.QuickCompute(Reading(i));
+  EXPECT_GT(memo.GetStatistics().evictions_, 0UL);
+}
+
+TEST_F(MemoizedSpeedOfSoundTest, UnquantizableEnvironmentsComputed) {
+  speedofsound::Environment e;
+  e.pressure_ = 1.0e12;
+  EXPECT_DOUBLE_EQ(memo_.QuickCompute(e), speed_of_sound_.QuickCompute(e));
+  e.pressure_ = NAN;
+  EXPECT_TRUE(isnan(memo_.QuickCompute(e)));
+  EXPECT_EQ(memo_.GetStatistics().misses_, 2UL);
+  EXPECT_EQ(memo_.GetStatistics().hits_, 0UL);
+}
+
+TEST_F(MemoizedSpeedOfSoundTest, ShardedMatchesAcrossThreads) {
+  speedofsound::ShardedMemoizedSpeedOfSound sharded(3, kCapacity);
+  EXPECT_TRUE(sharded.IsValid());
+  EXPECT_EQ(sharded.GetShardCount(), 4UL);
+  EXPECT_EQ(sharded.GetCapacity(), 4 * 64UL);
+  const auto kThreads = 4;
+  const auto kReadings = 20 * kDistinctReadings;
+  std::vector<std::thread> threads;
+  std::vector<int> mismatches(kThreads, 0);
+  for (auto t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (auto i = 0; i < kReadings; ++i) {
+        const auto e = Reading(i + t);
+        if (fabs(sharded.QuickCompute(e) - speed_of_sound_.QuickCompute(e)) >
+            1.0e-9) {
+          ++mismatches[t];
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  for (const auto count : mismatches) EXPECT_EQ(count, 0);
+  const auto statistics = sharded.GetStatistics();
+  EXPECT_EQ(statistics.hits_ + statistics.misses_,
+            static_cast<uint64_t>(kThreads * kReadings));
+  EXPECT_GT(statistics.HitRate(), 0.9);
+  sharded.ResetStatistics();
+  sharded.Clear();
+  sharded.QuickCompute(Reading(0));
+  EXPECT_EQ(sharded.GetStatistics().misses_, 1UL);
+}
@@ -0,0 +1,22 @@
+#ifndef TEST_SPEED_OF_SOUND_MEMO_TEST_H_
+#define TEST_SPEED_OF_SOUND_MEMO_TEST_H_
+
+#include "gtest/gtest.h"
+
+#include "speed-of-sound-memo.h"
+#include "speed-of-sound.h"
+
+class MemoizedSpeedOfSoundTest : public ::testing::Test {
+ public:
+  MemoizedSpeedOfSoundTest();
+
+  // Sensor readings that revisit kDistinctReadings quantized environments
+  auto Reading(const int i) const -> speedofsound::Environment;
+
+  const size_t kCapacity = 256;
+  const int kDistinctReadings = 100;
+  speedofsound::SpeedOfSound speed_of_sound_;
+  speedofsound::MemoizedSpeedOfSound memo_;
+};
+
+#endif  // TEST_SPEED_OF_SOUND_MEMO_TEST_H_
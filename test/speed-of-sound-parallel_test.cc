@@ -0,0 +1,99 @@
+#include "speed-of-sound-parallel_test.h"
+
+#include <math.h>
+
+#include "speed-of-sound-theory.h"
+
+SpeedOfSoundParallelTest::SpeedOfSoundParallelTest() {
+  using speedofsound::theory::kMaxCO2MoleFraction;
+  using speedofsound::theory::kMaxHumidity;
+  using speedofsound::theory::kMaxPressure;
+  using speedofsound::theory::kMaxTemperature;
+  using speedofsound::theory::kMinCO2MoleFraction;
+  using speedofsound::theory::kMinHumidity;
+  using speedofsound::theory::kMinPressure;
+  using speedofsound::theory::kMinTemperature;
+  for (size_t i = 0; i < kCount; ++i) {
+    const auto fraction = static_cast<double>(i) / (kCount - 1);
+    temperature_.push_back(kMinTemperature +
+                           (kMaxTemperature - kMinTemperature) * fraction);
+    humidity_.push_back(kMaxHumidity -
+                        (kMaxHumidity - kMinHumidity) * fraction);
+    pressure_.push_back(kMinPressure +
+                        (kMaxPressure - kMinPressure) * (i % 97) / 96.0);
+    co2_mole_fraction_.push_back(
+        kMinCO2MoleFraction +
+        (kMaxCO2MoleFraction - kMinCO2MoleFraction) * (i % 13) / 12.0);
+  }
+}
+
+auto SpeedOfSoundParallelTest::Arrays() const
+    -> speedofsound::EnvironmentArrays {
+  return speedofsound::EnvironmentArrays(
+      temperature_.data(), humidity_.data(), pressure_.data(),
+      co2_mole_fraction_.data());
+}
+
+TEST_F(SpeedOfSoundParallelTest, MatchesQuickComputeBatch) {
+  for (const auto thread_count : kThreadCounts) {
+    speedofsound::ThreadPool pool(thread_count);
+    for (const auto kernel : kKernels) {
+      std::vector<double> expected(kCount), c(kCount);
+      const auto supported = speedofsound::QuickComputeBatch(
+          Arrays(), kCount, expected.data(), kernel);
+      ASSERT_EQ(supported, speedofsound::ParallelQuickComputeBatch(
+                               &pool, Arrays(), kCount, c.data(), kernel));
+      if (!supported) continue;
+      for (size_t i = 0; i < kCount; ++i) {
+        ASSERT_EQ(expected[i], c[i]);
+      }
+    }
+  }
+}
+
+TEST_F(SpeedOfSoundParallelTest, EmptyBatch) {
+  speedofsound::ThreadPool pool(2);
+  EXPECT_TRUE(
+      speedofsound::ParallelQuickComputeBatch(&pool, Arrays(), 0, nullptr));
+}
+
+TEST_F(SpeedOfSoundParallelTest, TravelTimeMatchesIntegrate) {
+  const size_t kPaths = 1000;
+  const speedofsound::TravelTimeIntegrator integrator(1.0e-9);
+  std::vector<speedofsound::PathSample> samples;
+  std::vector<size_t> offsets = {0};
+  for (size_t i = 0; i < kPaths; ++i) {
+    // Paths of 2 to 6 samples with a different environment at each one
+    for (size_t j = 0; j < 2 + i % 5; ++j) {
+      const auto k = (i * 7 + j * 131) % kCount;
+      samples.push_back(speedofsound::PathSample(
+          100.0 * j,
+          speedofsound::Environment(temperature_[k], humidity_[k],
+                                    pressure_[k], co2_mole_fraction_[k])));
+    }
+    offsets.push_back(samples.size());
+  }
+  for (const auto thread_count : kThreadCounts) {
+    speedofsound::ThreadPool pool(thread_count);
+    std::vector<double> travel_time(kPaths);
+    ASSERT_TRUE(speedofsound::ParallelTravelTime(
+        &pool, integrator, samples.data(), offsets.data(), kPaths,
+        travel_time.data()));
+    for (size_t i = 0; i < kPaths; ++i) {
+      double expected;
+      ASSERT_TRUE(integrator.Integrate(samples.data() + offsets[i],
+                                       offsets[i + 1] - offsets[i],
+                                       &expected));
+      ASSERT_EQ(expected, travel_time[i]);
+    }
+  }
+  // A single sample is not a path
+  offsets[2] = offsets[1] + 1;
+  speedofsound::ThreadPool pool(2);
+  std::vector<double> travel_time(2);
+  EXPECT_FALSE(speedofsound::ParallelTravelTime(
+      &pool, integrator, samples.data(), offsets.data(), 2,
+      travel_time.data()));
+  EXPECT_FALSE(isnan(travel_time[0]));
+  EXPECT_TRUE(isnan(travel_time[1]));
+}
@@ -0,0 +1,25 @@
+#ifndef TEST_SPEED_OF_SOUND_PARALLEL_TEST_H_
+#define TEST_SPEED_OF_SOUND_PARALLEL_TEST_H_
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "speed-of-sound-parallel.h"
+
+class SpeedOfSoundParallelTest : public ::testing::Test {
+ public:
+  SpeedOfSoundParallelTest();
+  auto Arrays() const -> speedofsound::EnvironmentArrays;
+
+  std::vector<double> temperature_, humidity_, pressure_, co2_mole_fraction_;
+  // Not a multiple of kParallelGrain, so the last range is partial
+  const size_t kCount = 5 * speedofsound::kParallelGrain + 123;
+  const std::vector<size_t> kThreadCounts = {1, 2, 4};
+  const std::vector<speedofsound::BatchKernel> kKernels = {
+      speedofsound::BatchKernel::kAuto, speedofsound::BatchKernel::kScalar,
+      speedofsound::BatchKernel::kSse2, speedofsound::BatchKernel::kAvx2,
+      speedofsound::BatchKernel::kAvx512};
+};
+
+#endif  // TEST_SPEED_OF_SOUND_PARALLEL_TEST_H_
@@ -0,0 +1,92 @@
+#include "speed-of-sound-path_test.h"
+
+#include <math.h>
+
+TravelTimeIntegratorTest::TravelTimeIntegratorTest() {
+  path_.push_back(speedofsound::PathSample(
+      0.0, speedofsound::Environment(2.0, 0.1, 101000.0, 0.0004)));
+  path_.push_back(speedofsound::PathSample(
+      150.0, speedofsound::Environment(5.0, 0.3, 100800.0, 0.0004)));
+  path_.push_back(speedofsound::PathSample(
+      400.0, speedofsound::Environment(28.0, 0.95, 100500.0, 0.0006)));
+  path_.push_back(speedofsound::PathSample(
+      400.0, speedofsound::Environment(28.0, 0.95, 100500.0, 0.0006)));
+  path_.push_back(speedofsound::PathSample(
+      1000.0, speedofsound::Environment(15.0, 0.5, 99000.0, 0.0005)));
+}
+
+auto TravelTimeIntegratorTest::ReferenceTravelTime(
+    const std::vector<speedofsound::PathSample>& path) const -> double {
+  auto time = 0.0;
+  for (size_t i = 1; i < path.size(); ++i) {
+    const auto& a = path[i - 1];
+    const auto& b = path[i];
+    const auto step = (b.distance_ - a.distance_) / kReferenceIntervals;
+    for (size_t j = 0; j <= kReferenceIntervals; ++j) {
+      const auto u = static_cast<double>(j) / kReferenceIntervals;
+      const speedofsound::Environment environment(
+          a.environment_.temperature_ +
+              (b.environment_.temperature_ - a.environment_.temperature_) * u,
+          a.environment_.humidity_ +
+              (b.environment_.humidity_ - a.environment_.humidity_) * u,
+          a.environment_.pressure_ +
+              (b.environment_.pressure_ - a.environment_.pressure_) * u,
+          a.environment_.co2_mole_fraction_ +
+              (b.environment_.co2_mole_fraction_ -
+               a.environment_.co2_mole_fraction_) *
+                  u);
+      const auto weight = j == 0 || j == kReferenceIntervals ? 1.0
+                          : j % 2 == 1                       ? 4.0
+                                                             : 2.0;
+      time += weight * step / 3.0 / speed_of_sound_.QuickCompute(environment);
+    }
+  }
+  return time;
+}
+
+TEST_F(TravelTimeIntegratorTest, ConstantEnvironment) {
+  const speedofsound::Environment environment(20.0, 0.5, 100000.0, 0.0004);
+  const std::vector<speedofsound::PathSample> path = {
+      speedofsound::PathSample(10.0, environment),
+      speedofsound::PathSample(510.0, environment)};
+  const speedofsound::TravelTimeIntegrator integrator(1.0e-9);
+  double travel_time;
+  ASSERT_TRUE(integrator.Integrate(path.data(), path.size(), &travel_time));
+  EXPECT_DOUBLE_EQ(500.0 / speed_of_sound_.QuickCompute(environment),
+                   travel_time);
+}
+
+TEST_F(TravelTimeIntegratorTest, WithinToleranceOfReference) {
+  const auto reference = ReferenceTravelTime(path_);
+  for (const auto tolerance : kTolerances) {
+    const speedofsound::TravelTimeIntegrator integrator(tolerance);
+    EXPECT_EQ(tolerance, integrator.GetTolerance());
+    double travel_time;
+    ASSERT_TRUE(integrator.Integrate(path_.data(), path_.size(),
+                                     &travel_time));
+    EXPECT_NEAR(reference, travel_time, tolerance);
+  }
+}
+
+TEST_F(TravelTimeIntegratorTest, InvalidPaths) {
+  const speedofsound::TravelTimeIntegrator integrator(1.0e-9);
+  double travel_time = 0.0;
+  EXPECT_FALSE(integrator.Integrate(path_.data(), 1, &travel_time));
+  auto path = path_;
+  path[2].distance_ = 100.0;
+  EXPECT_FALSE(integrator.Integrate(path.data(), path.size(), &travel_time));
+  path = path_;
+  path[1].environment_.humidity_ = 1.5;
+  EXPECT_FALSE(integrator.Integrate(path.data(), path.size(), &travel_time));
+  EXPECT_EQ(0.0, travel_time);
+}
+
+TEST_F(TravelTimeIntegratorTest, InvalidTolerance) {
+  double travel_time = 0.0;
+  for (const auto tolerance : {0.0, -1.0e-9, static_cast<double>(NAN)}) {
+    const speedofsound::TravelTimeIntegrator integrator(tolerance);
+    EXPECT_FALSE(
+        integrator.Integrate(path_.data(), path_.size(), &travel_time));
+  }
+  EXPECT_EQ(0.0, travel_time);
+}
@@ -0,0 +1,26 @@
+#ifndef TEST_SPEED_OF_SOUND_PATH_TEST_H_
+#define TEST_SPEED_OF_SOUND_PATH_TEST_H_
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "speed-of-sound-path.h"
+#include "speed-of-sound.h"
+
+class TravelTimeIntegratorTest : public ::testing::Test {
+ public:
+  TravelTimeIntegratorTest();
+  // Composite Simpson rule with QuickCompute on a fine grid
+  auto ReferenceTravelTime(const std::vector<speedofsound::PathSample>& path)
+      const -> double;
+
+  speedofsound::SpeedOfSound speed_of_sound_;
+  // A kilometre across a warm front: temperature and humidity swing over
+  // most of their valid range
+  std::vector<speedofsound::PathSample> path_;
+  const std::vector<double> kTolerances = {1.0e-6, 1.0e-8, 1.0e-10};
+  const size_t kReferenceIntervals = 2000;
+};
+
+#endif  // TEST_SPEED_OF_SOUND_PATH_TEST_H_
@@ -0,0 +1,66 @@
+#include "speed-of-sound-ranging_test.h"
+
+EchoRangingTest::EchoRangingTest() {
+  for (size_t i = 0; i < kCount; ++i) {
+    const auto fraction = static_cast<double>(i) / (kCount - 1);
+    echo_time_.push_back(1.0e-4 + 0.05 * fraction);
+    temperature_.push_back(kEnvironment.temperature_ - 2.0 + 4.0 * fraction);
+    humidity_.push_back(kEnvironment.humidity_ + 0.1 * (i % 3) / 2.0);
+    pressure_.push_back(kEnvironment.pressure_ + 500.0 * (i % 5) / 4.0);
+    co2_mole_fraction_.push_back(kEnvironment.co2_mole_fraction_);
+  }
+}
+
+auto EchoRangingTest::Arrays() const -> speedofsound::EnvironmentArrays {
+  return speedofsound::EnvironmentArrays(
+      temperature_.data(), humidity_.data(), pressure_.data(),
+      co2_mole_fraction_.data());
+}
+
+TEST_F(EchoRangingTest, DefaultsToStandardEnvironmentRoundTrip) {
+  const speedofsound::EchoRanging ranging;
+  EXPECT_EQ(speedofsound::EchoPath::kRoundTrip, ranging.GetPath());
+  speedofsound::SpeedOfSound speed_of_sound;
+  EXPECT_EQ(speed_of_sound.GetInitSpeedOfSound(),
+            ranging.GetSpeedOfSound().GetInitSpeedOfSound());
+}
+
+TEST_F(EchoRangingTest, DistanceInOneEnvironment) {
+  speedofsound::SpeedOfSound speed_of_sound;
+  const auto c = speed_of_sound.Compute(kEnvironment);
+  for (const auto path :
+       {speedofsound::EchoPath::kOneWay, speedofsound::EchoPath::kRoundTrip}) {
+    const speedofsound::EchoRanging ranging(kEnvironment, path);
+    const auto fraction = path == speedofsound::EchoPath::kOneWay ? 1.0 : 0.5;
+    std::vector<double> distance(kCount);
+    ranging.Distance(echo_time_.data(), kCount, distance.data());
+    for (size_t i = 0; i < kCount; ++i) {
+      ASSERT_EQ(echo_time_[i] * c * fraction, distance[i]);
+    }
+  }
+}
+
+TEST_F(EchoRangingTest, UpdateMovesTheLinearizationPoint) {
+  speedofsound::EchoRanging ranging;
+  ranging.Update(kEnvironment);
+  speedofsound::SpeedOfSound speed_of_sound;
+  const auto c = speed_of_sound.Compute(kEnvironment);
+  EXPECT_EQ(c, ranging.GetSpeedOfSound().GetInitSpeedOfSound());
+  const double echo_time = 0.01;
+  double distance;
+  ranging.Distance(&echo_time, 1, &distance);
+  EXPECT_EQ(echo_time * c * 0.5, distance);
+}
+
+TEST_F(EchoRangingTest, EnvironmentStreamMatchesApproximate) {
+  const speedofsound::EchoRanging ranging(kEnvironment);
+  const auto& speed_of_sound = ranging.GetSpeedOfSound();
+  std::vector<double> distance(kCount);
+  ranging.Distance(Arrays(), echo_time_.data(), kCount, distance.data());
+  for (size_t i = 0; i < kCount; ++i) {
+    const speedofsound::Environment environment(
+        temperature_[i], humidity_[i], pressure_[i], co2_mole_fraction_[i]);
+    ASSERT_EQ(echo_time_[i] * speed_of_sound.Approximate(environment) * 0.5,
+              distance[i]);
+  }
+}
@@ -0,0 +1,23 @@
+#ifndef TEST_SPEED_OF_SOUND_RANGING_TEST_H_
+#define TEST_SPEED_OF_SOUND_RANGING_TEST_H_
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "environment.h"
+#include "speed-of-sound-ranging.h"
+
+class EchoRangingTest : public ::testing::Test {
+ public:
+  EchoRangingTest();
+  auto Arrays() const -> speedofsound::EnvironmentArrays;
+
+  std::vector<double> echo_time_;
+  std::vector<double> temperature_, humidity_, pressure_, co2_mole_fraction_;
+  const speedofsound::Environment kEnvironment =
+      speedofsound::Environment(25.0, 0.6, 98000.0, 0.0005);
+  const size_t kCount = 1001;
+};
+
+#endif  // TEST_SPEED_OF_SOUND_RANGING_TEST_H_
@@ -1,5 +1,7 @@
 #include "speed-of-sound-theory_test.h"
 
+#include <math.h>
+
 SpeedOfSoundTheoryTest::SpeedOfSoundTheoryTest() {
   min_case.temperature_ = speedofsound::theory::kMinTemperature;
   min_case.humidity_ = speedofsound::theory::kMinHumidity;
@@ -102,6 +104,39 @@ TEST_F(SpeedOfSoundTheoryTest, dPsv_dt) {
   }
 }
 
+TEST_F(SpeedOfSoundTheoryTest, FastPsv) {
+  const auto tolerance = speedofsound::theory::kFastPsvMaxRelativeError;
+  const auto t_min = speedofsound::theory::kMinTemperature;
+  const auto t_max = speedofsound::theory::kMaxTemperature;
+  for (auto t = t_min; t <= t_max; t += (t_max - t_min) * 1.0e-5) {
+    const auto T = speedofsound::theory::T(t);
+    const auto Psv = speedofsound::theory::Psv(T);
+    const auto dPsv_dt = speedofsound::theory::dPsv_dt(T);
+    auto fast_dPsv_dt = 0.0;
+    const auto fast_Psv =
+        speedofsound::theory::FastPsvAndDerivative(T, &fast_dPsv_dt);
+    ASSERT_EQ(fast_Psv, speedofsound::theory::FastPsv(T));
+    ASSERT_NEAR(Psv, fast_Psv, Psv * tolerance);
+    ASSERT_NEAR(dPsv_dt, fast_dPsv_dt, dPsv_dt * tolerance);
+  }
+}
+
+// Sweeps across both edges of the exponential table, and well beyond them
+TEST_F(SpeedOfSoundTheoryTest, FastPsvOutsideValidRange) {
+  const auto tolerance = speedofsound::theory::kFastPsvMaxRelativeError;
+  for (auto t = -60.0; t <= 100.0; t += 1.0e-2) {
+    const auto T = speedofsound::theory::T(t);
+    const auto Psv = speedofsound::theory::Psv(T);
+    const auto dPsv_dt = speedofsound::theory::dPsv_dt(T);
+    auto fast_dPsv_dt = 0.0;
+    const auto fast_Psv =
+        speedofsound::theory::FastPsvAndDerivative(T, &fast_dPsv_dt);
+    ASSERT_NEAR(Psv, fast_Psv, Psv * tolerance) << t;
+    ASSERT_NEAR(dPsv_dt, fast_dPsv_dt, dPsv_dt * tolerance) << t;
+  }
+  EXPECT_TRUE(isnan(speedofsound::theory::FastPsv(static_cast<double>(NAN))));
+}
+
 TEST_F(SpeedOfSoundTheoryTest, Xw) {
   speedofsound::Environment random_case;
   random_case.temperature_ = 11.998297271608877;
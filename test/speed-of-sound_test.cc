@@ -1,6 +1,6 @@
 #include "speed-of-sound_test.h"
 
-#include <chrono>
+#include <math.h>
 
 #include "environment.h"
 
@@ -107,6 +107,20 @@ TEST_F(EnvironmentRateTest, EnvironmentRateConstructorDefaultValue) {
   EXPECT_DOUBLE_EQ(environment_rate_.co2_mole_fraction_rate_, 0.0);
 }
 
+TEST_F(EnvironmentCurvatureTest, EnvironmentCurvatureConstructorDefaultValue) {
+  EXPECT_DOUBLE_EQ(environment_curvature_.temperature_temperature_, 0.0);
+  EXPECT_DOUBLE_EQ(environment_curvature_.temperature_humidity_, 0.0);
+  EXPECT_DOUBLE_EQ(environment_curvature_.temperature_pressure_, 0.0);
+  EXPECT_DOUBLE_EQ(environment_curvature_.temperature_co2_mole_fraction_, 0.0);
+  EXPECT_DOUBLE_EQ(environment_curvature_.humidity_humidity_, 0.0);
+  EXPECT_DOUBLE_EQ(environment_curvature_.humidity_pressure_, 0.0);
+  EXPECT_DOUBLE_EQ(environment_curvature_.humidity_co2_mole_fraction_, 0.0);
+  EXPECT_DOUBLE_EQ(environment_curvature_.pressure_pressure_, 0.0);
+  EXPECT_DOUBLE_EQ(environment_curvature_.pressure_co2_mole_fraction_, 0.0);
+  EXPECT_DOUBLE_EQ(
+      environment_curvature_.co2_mole_fraction_co2_mole_fraction_, 0.0);
+}
+
 TEST_F(SpeedOfSoundTest, EnvironmentConstructorDefaultValues) {
   EXPECT_DOUBLE_EQ(speed_of_sound_.GetInitEnvironment().temperature_,
                    speedofsound::theory::kStdTemperature);
@@ -136,6 +150,107 @@ TEST_F(SpeedOfSoundTest, EnvironmentOverloadConstructorValues) {
                    speedofsound::theory::kMinCO2MoleFraction);
 }
 
+TEST_F(SpeedOfSoundTest, EnvironmentOverloadConstructorRateValues) {
+  speedofsound::Environment environment_;
+  environment_.temperature_ = speedofsound::theory::kMinTemperature;
+  environment_.humidity_ = speedofsound::theory::kMinHumidity;
+  environment_.pressure_ = speedofsound::theory::kMinPressure;
+  environment_.co2_mole_fraction_ = speedofsound::theory::kMinCO2MoleFraction;
+  speedofsound::SpeedOfSound speed_of_sound(environment_);
+  speed_of_sound_.Compute(environment_);
+
+  EXPECT_DOUBLE_EQ(speed_of_sound.GetInitEnvironmentRate().temperature_rate_,
+                   speed_of_sound_.GetInitEnvironmentRate().temperature_rate_);
+  EXPECT_DOUBLE_EQ(speed_of_sound.GetInitEnvironmentRate().humidity_rate_,
+                   speed_of_sound_.GetInitEnvironmentRate().humidity_rate_);
+  EXPECT_DOUBLE_EQ(speed_of_sound.GetInitEnvironmentRate().pressure_rate_,
+                   speed_of_sound_.GetInitEnvironmentRate().pressure_rate_);
+  EXPECT_DOUBLE_EQ(
+      speed_of_sound.GetInitEnvironmentRate().co2_mole_fraction_rate_,
+      speed_of_sound_.GetInitEnvironmentRate().co2_mole_fraction_rate_);
+}
+
+TEST_F(SpeedOfSoundTest, ApproximationOrderDefaultValues) {
+  speedofsound::Environment environment_;
+  speedofsound::SpeedOfSound speed_of_sound(environment_);
+  speedofsound::SpeedOfSound quadratic_speed_of_sound(
+      environment_, speedofsound::ApproximationOrder::kQuadratic);
+
+  EXPECT_EQ(speed_of_sound_.GetApproximationOrder(),
+            speedofsound::ApproximationOrder::kLinear);
+  EXPECT_EQ(speed_of_sound.GetApproximationOrder(),
+            speedofsound::ApproximationOrder::kLinear);
+  EXPECT_EQ(quadratic_speed_of_sound.GetApproximationOrder(),
+            speedofsound::ApproximationOrder::kQuadratic);
+  EXPECT_DOUBLE_EQ(
+      speed_of_sound.GetInitEnvironmentCurvature().temperature_temperature_,
+      0.0);
+}
+
+TEST_F(SpeedOfSoundTest, EnvironmentCurvatureMatchesRateDifferences) {
+  const auto relative_tolerance = 1.0e-6;
+  const speedofsound::Environment environment_;
+  speedofsound::SpeedOfSound speed_of_sound(
+      environment_, speedofsound::ApproximationOrder::kQuadratic);
+  const auto H = speed_of_sound.GetInitEnvironmentCurvature();
+  // Central differences of the analytic gradient along each variable
+  auto rate_difference = [&](double speedofsound::Environment::*variable,
+                             double delta) {
+    auto e = environment_;
+    e.*variable = environment_.*variable + delta;
+    speed_of_sound_.Compute(e);
+    const auto rate_plus = speed_of_sound_.GetInitEnvironmentRate();
+    e.*variable = environment_.*variable - delta;
+    speed_of_sound_.Compute(e);
+    const auto rate_minus = speed_of_sound_.GetInitEnvironmentRate();
+    speedofsound::EnvironmentRate rate;
+    rate.temperature_rate_ =
+        (rate_plus.temperature_rate_ - rate_minus.temperature_rate_) /
+        (2.0 * delta);
+    rate.humidity_rate_ =
+        (rate_plus.humidity_rate_ - rate_minus.humidity_rate_) / (2.0 * delta);
+    rate.pressure_rate_ =
+        (rate_plus.pressure_rate_ - rate_minus.pressure_rate_) / (2.0 * delta);
+    rate.co2_mole_fraction_rate_ = (rate_plus.co2_mole_fraction_rate_ -
+                                    rate_minus.co2_mole_fraction_rate_) /
+                                   (2.0 * delta);
+    return rate;
+  };
+  const auto d_dt =
+      rate_difference(&speedofsound::Environment::temperature_, 1.0e-3);
+  const auto d_dh =
+      rate_difference(&speedofsound::Environment::humidity_, 1.0e-5);
+  const auto d_dp = rate_difference(&speedofsound::Environment::pressure_, 1.0);
+  const auto d_dxc =
+      rate_difference(&speedofsound::Environment::co2_mole_fraction_, 1.0e-6);
+
+  EXPECT_NEAR(H.temperature_temperature_, d_dt.temperature_rate_,
+              fabs(H.temperature_temperature_) * relative_tolerance);
+  EXPECT_NEAR(H.temperature_humidity_, d_dt.humidity_rate_,
+              fabs(H.temperature_humidity_) * relative_tolerance);
+  EXPECT_NEAR(H.temperature_humidity_, d_dh.temperature_rate_,
+              fabs(H.temperature_humidity_) * relative_tolerance);
+  EXPECT_NEAR(H.temperature_pressure_, d_dt.pressure_rate_,
+              fabs(H.temperature_pressure_) * relative_tolerance);
+  EXPECT_NEAR(H.temperature_pressure_, d_dp.temperature_rate_,
+              fabs(H.temperature_pressure_) * relative_tolerance);
+  EXPECT_NEAR(H.temperature_co2_mole_fraction_, d_dt.co2_mole_fraction_rate_,
+              fabs(H.temperature_co2_mole_fraction_) * relative_tolerance);
+  EXPECT_NEAR(H.humidity_humidity_, d_dh.humidity_rate_,
+              fabs(H.humidity_humidity_) * relative_tolerance);
+  EXPECT_NEAR(H.humidity_pressure_, d_dh.pressure_rate_,
+              fabs(H.humidity_pressure_) * relative_tolerance);
+  EXPECT_NEAR(H.humidity_co2_mole_fraction_, d_dh.co2_mole_fraction_rate_,
+              fabs(H.humidity_co2_mole_fraction_) * relative_tolerance);
+  EXPECT_NEAR(H.pressure_pressure_, d_dp.pressure_rate_,
+              fabs(H.pressure_pressure_) * relative_tolerance);
+  EXPECT_NEAR(H.pressure_co2_mole_fraction_, d_dp.co2_mole_fraction_rate_,
+              fabs(H.pressure_co2_mole_fraction_) * relative_tolerance);
+  EXPECT_NEAR(
+      H.co2_mole_fraction_co2_mole_fraction_, d_dxc.co2_mole_fraction_rate_,
+      fabs(H.co2_mole_fraction_co2_mole_fraction_) * relative_tolerance);
+}
+
 TEST_F(SpeedOfSoundTest, EnvironmentRateConstructorDefaultValues) {
   const auto t = speedofsound::theory::kStdTemperature;
   const auto h = speedofsound::theory::kStdHumidity;
@@ -192,6 +307,30 @@ TEST_F(SpeedOfSoundTest, ComputeReturnsCorrectValue) {
   }
 }
 
+TEST_F(SpeedOfSoundTest, ComputeRateMatchesCompute) {
+  speedofsound::Environment environment_;
+  speedofsound::EnvironmentRate rate;
+  const auto init_environment = speed_of_sound_.GetInitEnvironment();
+  for (auto t = kTMin; t <= kTMax; t += (kTMax - kTMin) * kIncrementFactor) {
+    for (auto h = kHMin; h <= kHMax; h += (kHMax - kHMin) * kIncrementFactor) {
+      environment_.temperature_ = t;
+      environment_.humidity_ = h;
+      const auto c = speed_of_sound_.ComputeRate(environment_, &rate);
+      EXPECT_EQ(init_environment.temperature_,
+                speed_of_sound_.GetInitEnvironment().temperature_);
+      speedofsound::SpeedOfSound reference;
+      ASSERT_EQ(reference.Compute(environment_), c);
+      ASSERT_EQ(c, reference.GetInitSpeedOfSound());
+      const auto expected = reference.GetInitEnvironmentRate();
+      ASSERT_EQ(expected.temperature_rate_, rate.temperature_rate_);
+      ASSERT_EQ(expected.humidity_rate_, rate.humidity_rate_);
+      ASSERT_EQ(expected.pressure_rate_, rate.pressure_rate_);
+      ASSERT_EQ(expected.co2_mole_fraction_rate_,
+                rate.co2_mole_fraction_rate_);
+    }
+  }
+}
+
 TEST_F(SpeedOfSoundTest, QuickComputeReturnsCorrectValue) {
   speedofsound::Environment environment_;
   for (auto t = kTMin; t <= kTMax; t += (kTMax - kTMin) * kIncrementFactor) {
@@ -272,49 +411,81 @@ TEST_F(SpeedOfSoundTest, LinearApproximationResultWithinTolerance) {
   }
 }
 
-TEST_F(SpeedOfSoundTest, ApproximationFasterThanQuickCompute) {
-  const auto runtime_ratio = 1.0 / 3.0;
-  speedofsound::Environment environment_;
-  auto quick_compute_timer_start = std::chrono::high_resolution_clock::now();
+TEST_F(SpeedOfSoundTest, QuadraticApproximationResultWithinTolerance) {
+  const auto environment_variance = 40.0 / 100.0;
+  const auto tolerance = 0.05 / 100.0;
+  speedofsound::Environment e_init;
+  speedofsound::Environment e;
   for (auto t = kTMin; t <= kTMax; t += (kTMax - kTMin) * kIncrementFactor) {
     for (auto h = kHMin; h <= kHMax; h += (kHMax - kHMin) * kIncrementFactor) {
       for (auto p = kPMin; p <= kPMax;
            p += (kPMax - kPMin) * kIncrementFactor) {
         for (auto xc = kXcMin; xc <= kXcMax;
              xc += (kXcMax - kXcMin) * kIncrementFactor) {
-          environment_.temperature_ = t;
-          environment_.humidity_ = h;
-          environment_.pressure_ = p;
-          environment_.co2_mole_fraction_ = xc;
-          speed_of_sound_.QuickCompute(environment_);
+          e_init.temperature_ = t;
+          e_init.humidity_ = h;
+          e_init.pressure_ = p;
+          e_init.co2_mole_fraction_ = xc;
+          speedofsound::SpeedOfSound speed_of_sound(
+              e_init, speedofsound::ApproximationOrder::kQuadratic);
+          e.temperature_ = (1.0 - environment_variance) * t;
+          e.humidity_ = (1.0 - environment_variance) * h;
+          e.pressure_ = (1.0 - environment_variance) * p;
+          e.co2_mole_fraction_ = (1.0 - environment_variance) * xc;
+          auto c = speed_of_sound.QuickCompute(e);
+          auto c_approx = speed_of_sound.Approximate(e);
+          ASSERT_NEAR(c, c_approx, c * tolerance);
+          e.temperature_ = (1.0 + environment_variance) * t;
+          e.humidity_ = (1.0 + environment_variance) * h;
+          e.pressure_ = (1.0 + environment_variance) * p;
+          e.co2_mole_fraction_ = (1.0 + environment_variance) * xc;
+          c = speed_of_sound.QuickCompute(e);
+          c_approx = speed_of_sound.Approximate(e);
+          ASSERT_NEAR(c, c_approx, c * tolerance);
         }
       }
     }
   }
-  const auto quick_compute_timer_end =
-      std::chrono::high_resolution_clock::now();
-  const auto quick_compute_time =
-      quick_compute_timer_end - quick_compute_timer_start;
-  auto approximation_timer_start = std::chrono::high_resolution_clock::now();
-  for (auto t = kTMin; t <= kTMax; t += (kTMax - kTMin) * kIncrementFactor) {
-    for (auto h = kHMin; h <= kHMax; h += (kHMax - kHMin) * kIncrementFactor) {
+}
+
+TEST_F(SpeedOfSoundTest, ScalarInstantiationsWithinTolerance) {
+  const auto environment_variance = 10.0 / 100.0;
+  const auto increment_factor = 10.0 / 100.0;
+  speedofsound::Environment e_init;
+  speedofsound::Environment e;
+  for (auto t = kTMin; t <= kTMax; t += (kTMax - kTMin) * increment_factor) {
+    for (auto h = kHMin; h <= kHMax; h += (kHMax - kHMin) * increment_factor) {
       for (auto p = kPMin; p <= kPMax;
-           p += (kPMax - kPMin) * kIncrementFactor) {
+           p += (kPMax - kPMin) * increment_factor) {
         for (auto xc = kXcMin; xc <= kXcMax;
-             xc += (kXcMax - kXcMin) * kIncrementFactor) {
-          environment_.temperature_ = t;
-          environment_.humidity_ = h;
-          environment_.pressure_ = p;
-          environment_.co2_mole_fraction_ = xc;
-          speed_of_sound_.Approximate(environment_);
+             xc += (kXcMax - kXcMin) * increment_factor) {
+          e_init = speedofsound::Environment(t, h, p, xc);
+          e = speedofsound::Environment((1.0 - environment_variance) * t,
+                                        (1.0 + environment_variance) * h,
+                                        (1.0 - environment_variance) * p,
+                                        (1.0 + environment_variance) * xc);
+          const speedofsound::BasicEnvironment<float> e_init_float(t, h, p,
+                                                                   xc);
+          const speedofsound::BasicEnvironment<float> e_float(
+              e.temperature_, e.humidity_, e.pressure_, e.co2_mole_fraction_);
+          const speedofsound::BasicEnvironment<long double> e_init_long(
+              t, h, p, xc);
+          const speedofsound::BasicEnvironment<long double> e_long(
+              e.temperature_, e.humidity_, e.pressure_, e.co2_mole_fraction_);
+          const auto c = speed_of_sound_.Compute(e_init);
+          const auto c_approx = speed_of_sound_.Approximate(e);
+          speedofsound::BasicSpeedOfSound<float> speed_of_sound_float;
+          speedofsound::BasicSpeedOfSound<long double> speed_of_sound_long;
+          ASSERT_NEAR(speed_of_sound_float.Compute(e_init_float), c,
+                      c * speedofsound::kFloatMaxRelativeError);
+          ASSERT_NEAR(speed_of_sound_float.Approximate(e_float), c_approx,
+                      c_approx * speedofsound::kFloatMaxRelativeError);
+          ASSERT_NEAR(speed_of_sound_long.Compute(e_init_long), c,
+                      c * speedofsound::kLongDoubleMaxRelativeError);
+          ASSERT_NEAR(speed_of_sound_long.Approximate(e_long), c_approx,
+                      c_approx * speedofsound::kLongDoubleMaxRelativeError);
         }
       }
     }
   }
-  const auto approximation_timer_end =
-      std::chrono::high_resolution_clock::now();
-  const auto approximation_time =
-      approximation_timer_end - approximation_timer_start;
-  EXPECT_LE(approximation_time.count(),
-            quick_compute_time.count() * runtime_ratio);
 }
@@ -14,6 +14,11 @@ class EnvironmentRateTest : public ::testing::Test {
   speedofsound::EnvironmentRate environment_rate_;
 };
 
+class EnvironmentCurvatureTest : public ::testing::Test {
+ public:
+  speedofsound::EnvironmentCurvature environment_curvature_;
+};
+
 class SpeedOfSoundTest : public ::testing::Test {
  public:
   speedofsound::SpeedOfSound speed_of_sound_;
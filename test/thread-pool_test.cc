@@ -0,0 +1,75 @@
+#include "thread-pool_test.h"
+
+#include <atomic>
+#include <chrono>
+
+auto ThreadPoolTest::Visits(speedofsound::ThreadPool* pool,
+                            const size_t count, const size_t grain)
+    -> std::vector<int> {
+  std::vector<int> visits(count, 0);
+  std::atomic<bool> ranges_within_grain(true);
+  pool->ParallelFor(count, grain, [&](size_t begin, size_t end) {
+    if (begin >= end || end - begin > grain || end > count) {
+      ranges_within_grain = false;
+      return;
+    }
+    for (auto i = begin; i < end; ++i) ++visits[i];
+  });
+  EXPECT_TRUE(ranges_within_grain);
+  return visits;
+}
+
+TEST_F(ThreadPoolTest, ThreadCount) {
+  EXPECT_LE(1u, speedofsound::ThreadPool().GetThreadCount());
+  for (const auto thread_count : kThreadCounts) {
+    EXPECT_EQ(thread_count,
+              speedofsound::ThreadPool(thread_count).GetThreadCount());
+  }
+}
+
+TEST_F(ThreadPoolTest, ParallelForVisitsEveryIndexOnce) {
+  for (const auto thread_count : kThreadCounts) {
+    speedofsound::ThreadPool pool(thread_count);
+    for (const auto count : kCounts) {
+      const auto visits = Visits(&pool, count, kGrain);
+      for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(1, visits[i]) << thread_count << " threads, index " << i;
+      }
+    }
+  }
+}
+
+TEST_F(ThreadPoolTest, ParallelForReusesThreads) {
+  speedofsound::ThreadPool pool(4);
+  const size_t kRepetitions = 200;
+  std::atomic<size_t> total(0);
+  for (size_t i = 0; i < kRepetitions; ++i) {
+    pool.ParallelFor(1000, 1, [&](size_t begin, size_t end) {
+      total += end - begin;
+    });
+  }
+  EXPECT_EQ(kRepetitions * 1000, total);
+}
+
+TEST_F(ThreadPoolTest, IdleThreadsStealWork) {
+  // The first range of the calling thread's share waits until another thread
+  // has worked on that share, which only happens by stealing
+  speedofsound::ThreadPool pool(4);
+  const size_t kCount = 4000;
+  std::atomic<bool> stolen(false);
+  const auto calling_thread = std::this_thread::get_id();
+  pool.ParallelFor(kCount, 1, [&](size_t begin, size_t end) {
+    static_cast<void>(end);
+    if (begin == 0) {
+      const auto deadline =
+          std::chrono::steady_clock::now() + std::chrono::seconds(10);
+      while (!stolen && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+      }
+    } else if (begin < kCount / 4 &&
+               std::this_thread::get_id() != calling_thread) {
+      stolen = true;
+    }
+  });
+  EXPECT_TRUE(stolen);
+}
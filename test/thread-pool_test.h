@@ -0,0 +1,23 @@
+#ifndef TEST_THREAD_POOL_TEST_H_
+#define TEST_THREAD_POOL_TEST_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "thread-pool.h"
+
+class ThreadPoolTest : public ::testing::Test {
+ public:
+  // Counts how often ParallelFor visits each index and checks range sizes
+  static auto Visits(speedofsound::ThreadPool* pool, const size_t count,
+                     const size_t grain) -> std::vector<int>;
+
+  const std::vector<size_t> kThreadCounts = {1, 2, 3, 8};
+  const std::vector<size_t> kCounts = {0, 1, 7, 64, 65, 1000, 100003};
+  const size_t kGrain = 64;
+};
+
+#endif  // TEST_THREAD_POOL_TEST_H_
@@ -0,0 +1,143 @@
+// Compares the speed of sound engines with a long double reference on a
+// dense grid over the valid range. Prints, for each engine, the largest and
+// mean absolute error in every temperature and humidity region, then a
+// summary of accuracy against the time of one evaluation.
+//
+// Usage: accuracy-sweep [OPTIONS] [ENGINE...]
+//   --points N     grid points per axis (default: the AccuracySweepOptions
+//                  defaults)
+//   --threads N    threads evaluating the grid (default: one per hardware
+//                  thread)
+//   --tolerance X  tolerance of the anchored and Chebyshev engines (m/s)
+//   ENGINE         engines to compare (default: all of them)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include "speed-of-sound-accuracy.h"
+#include "speed-of-sound-theory.h"
+
+namespace {
+
+auto Usage(const char* program) -> int {
+  fprintf(stderr,
+          "Usage: %s [--points N] [--threads N] [--tolerance X] "
+          "[ENGINE...]\nEngines:",
+          program);
+  for (size_t i = 0; i < speedofsound::kAccuracyEngineCount; ++i) {
+    fprintf(stderr, " %s", speedofsound::AccuracyEngineName(
+                               static_cast<speedofsound::AccuracyEngine>(i)));
+  }
+  fprintf(stderr, "\n");
+  return EXIT_FAILURE;
+}
+
+auto ParseCount(const char* text, size_t* count) -> bool {
+  char* end = nullptr;
+  const auto value = strtoul(text, &end, 10);
+  if (end == text || *end != '\0' || value == 0) return false;
+  *count = value;
+  return true;
+}
+
+auto PrintErrorMap(const speedofsound::AccuracySweepOptions& options,
+                   const speedofsound::EngineAccuracy& result) -> void {
+  namespace theory = speedofsound::theory;
+  const auto t_regions = options.temperature_regions_;
+  const auto h_regions = options.humidity_regions_;
+  printf("%s: max / mean absolute error (m/s)\n",
+         speedofsound::AccuracyEngineName(result.engine_));
+  printf("%10s", "t \\ h");
+  for (size_t h = 0; h < h_regions; ++h) {
+    const auto width = (theory::kMaxHumidity - theory::kMinHumidity) /
+                       static_cast<double>(h_regions);
+    printf("   %4.2f-%4.2f        ", theory::kMinHumidity + h * width,
+           theory::kMinHumidity + (h + 1) * width);
+  }
+  printf("\n");
+  for (size_t t = 0; t < t_regions; ++t) {
+    const auto width = (theory::kMaxTemperature - theory::kMinTemperature) /
+                       static_cast<double>(t_regions);
+    printf("%4.1f-%4.1f ", theory::kMinTemperature + t * width,
+           theory::kMinTemperature + (t + 1) * width);
+    for (size_t h = 0; h < h_regions; ++h) {
+      const auto& region = result.regions_[t * h_regions + h];
+      printf(" %9.2e/%9.2e", region.max_error_, region.MeanError());
+    }
+    printf("\n");
+  }
+  printf("\n");
+}
+
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  speedofsound::AccuracySweepOptions options;
+  size_t thread_count = 0;
+  std::vector<speedofsound::AccuracyEngine> engines;
+  for (int i = 1; i < argc; ++i) {
+    size_t points = 0;
+    speedofsound::AccuracyEngine engine;
+    if (strcmp(argv[i], "--points") == 0 && i + 1 < argc) {
+      if (!ParseCount(argv[++i], &points)) {
+        fprintf(stderr, "Invalid point count: %s\n", argv[i]);
+        return EXIT_FAILURE;
+      }
+      options.temperature_points_ = points;
+      options.humidity_points_ = points;
+      options.pressure_points_ = points;
+      options.co2_mole_fraction_points_ = points;
+    } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      if (!ParseCount(argv[++i], &thread_count)) {
+        fprintf(stderr, "Invalid thread count: %s\n", argv[i]);
+        return EXIT_FAILURE;
+      }
+    } else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+      char* end = nullptr;
+      options.surrogate_tolerance_ = strtod(argv[++i], &end);
+      if (end == argv[i] || *end != '\0') {
+        fprintf(stderr, "Invalid tolerance: %s\n", argv[i]);
+        return EXIT_FAILURE;
+      }
+    } else if (speedofsound::ParseAccuracyEngine(argv[i], &engine)) {
+      engines.push_back(engine);
+    } else {
+      return Usage(argv[0]);
+    }
+  }
+  if (engines.empty()) {
+    for (size_t i = 0; i < speedofsound::kAccuracyEngineCount; ++i) {
+      engines.push_back(static_cast<speedofsound::AccuracyEngine>(i));
+    }
+  }
+  if (!options.Validate()) {
+    fprintf(stderr,
+            "Invalid options: each axis needs at least %zu points and the "
+            "tolerance must be positive\n",
+            options.temperature_regions_);
+    return EXIT_FAILURE;
+  }
+  speedofsound::ThreadPool pool(thread_count);
+  speedofsound::AccuracySweep sweep(&pool);
+  std::vector<speedofsound::EngineAccuracy> results;
+  if (!sweep.Run(options, engines, &results)) {
+    fprintf(stderr, "Cannot run the sweep (is an engine listed twice?)\n");
+    return EXIT_FAILURE;
+  }
+  for (const auto& result : results) PrintErrorMap(options, result);
+  printf("%-22s %12s %12s %10s\n", "engine", "max (m/s)", "mean (m/s)",
+         "ns/call");
+  for (const auto& result : results) {
+    printf("%-22s %12.3e %12.3e %10.2f\n",
+           speedofsound::AccuracyEngineName(result.engine_),
+           result.total_.max_error_, result.total_.MeanError(),
+           result.nanoseconds_per_call_);
+  }
+  printf("%llu grid points per engine on %zu threads\n",
+         static_cast<unsigned long long>(results[0].total_.count_),
+         pool.GetThreadCount());
+  return EXIT_SUCCESS;
+}
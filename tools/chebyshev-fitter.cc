@@ -0,0 +1,85 @@
+// Fits a Chebyshev surrogate of QuickCompute to a requested accuracy and
+// writes its terms as a C++ header defining a constexpr ChebyshevSurrogate.
+//
+// Usage: chebyshev-fitter TOLERANCE [OUTPUT]
+//   TOLERANCE  largest absolute error allowed over the valid range (m/s)
+//   OUTPUT     header to write (default: standard output)
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "speed-of-sound-chebyshev-fitter.h"
+
+namespace {
+
+auto WriteHeader(FILE* file, const double tolerance,
+                 const speedofsound::ChebyshevFitter& fitter) -> bool {
+  const auto degree = fitter.GetDegree();
+  auto ok = fprintf(file,
+                    "// Generated by chebyshev-fitter %.17g\n"
+                    "#ifndef SPEED_OF_SOUND_CHEBYSHEV_TERMS_H_\n"
+                    "#define SPEED_OF_SOUND_CHEBYSHEV_TERMS_H_\n\n"
+                    "#include \"speed-of-sound-chebyshev.h\"\n\n"
+                    "namespace speedofsound {\n\n"
+                    "namespace chebyshev_terms {\n\n"
+                    "constexpr ChebyshevDegree kDegree(%zu, %zu, %zu, %zu);\n"
+                    "constexpr double kMaxError = %.17g;\n"
+                    "constexpr ChebyshevTerm kTerms[] = {\n",
+                    tolerance, degree.temperature_degree_,
+                    degree.humidity_degree_, degree.pressure_degree_,
+                    degree.co2_mole_fraction_degree_,
+                    fitter.GetMaxError()) > 0;
+  for (const auto& term : fitter.GetTerms()) {
+    ok = ok && fprintf(file, "    ChebyshevTerm(%.17g, %u, %u, %u, %u),\n",
+                       term.coefficient_, term.temperature_degree_,
+                       term.humidity_degree_, term.pressure_degree_,
+                       term.co2_mole_fraction_degree_) > 0;
+  }
+  ok = ok && fprintf(file,
+                     "};\n"
+                     "constexpr ChebyshevSurrogate kSurrogate(\n"
+                     "    kDegree, kTerms, sizeof(kTerms) / sizeof(kTerms[0]),"
+                     " kMaxError);\n\n"
+                     "}  // namespace chebyshev_terms\n\n"
+                     "}  // namespace speedofsound\n\n"
+                     "#endif  // SPEED_OF_SOUND_CHEBYSHEV_TERMS_H_\n") > 0;
+  return ok;
+}
+
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  if (argc < 2 || argc > 3) {
+    fprintf(stderr, "Usage: %s TOLERANCE [OUTPUT]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  char* end = nullptr;
+  const auto tolerance = strtod(argv[1], &end);
+  if (end == argv[1] || *end != '\0' || !(tolerance > 0.0)) {
+    fprintf(stderr, "Invalid tolerance: %s\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+  speedofsound::ChebyshevFitter fitter;
+  if (!fitter.Fit(tolerance)) {
+    fprintf(stderr, "Cannot reach a tolerance of %s m/s\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+  const auto degree = fitter.GetDegree();
+  fprintf(stderr,
+          "%zu terms of degree (%zu, %zu, %zu, %zu), max error %.3g m/s\n",
+          fitter.GetTerms().size(), degree.temperature_degree_,
+          degree.humidity_degree_, degree.pressure_degree_,
+          degree.co2_mole_fraction_degree_, fitter.GetMaxError());
+  auto file = argc == 3 ? fopen(argv[2], "w") : stdout;
+  if (file == nullptr) {
+    fprintf(stderr, "Cannot open %s\n", argv[2]);
+    return EXIT_FAILURE;
+  }
+  auto ok = WriteHeader(file, tolerance, fitter);
+  if (file != stdout) ok = fclose(file) == 0 && ok;
+  if (!ok) {
+    fprintf(stderr, "Cannot write the terms\n");
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
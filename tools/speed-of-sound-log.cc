@@ -0,0 +1,87 @@
+// Converts a sensor log of environments into speed of sound values, one per
+// record, and reports the throughput on standard error.
+//
+// Usage: speed-of-sound-log [OPTIONS] INPUT [OUTPUT]
+//   --binary-input          INPUT holds packed records of four doubles
+//   --binary-output         write packed doubles instead of CSV lines
+//   --approximate TOLERANCE use AdaptiveSpeedOfSound within TOLERANCE (m/s)
+//                           instead of QuickCompute
+//   OUTPUT                  file to write (default: standard output)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "speed-of-sound-log.h"
+
+namespace {
+
+auto Usage(const char* program) -> int {
+  fprintf(stderr,
+          "Usage: %s [--binary-input] [--binary-output] "
+          "[--approximate TOLERANCE] INPUT [OUTPUT]\n",
+          program);
+  return EXIT_FAILURE;
+}
+
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  auto input_format = speedofsound::LogFormat::kCsv;
+  auto output_format = speedofsound::LogFormat::kCsv;
+  auto engine = speedofsound::LogEngine::kQuickCompute;
+  double tolerance = 0.0;
+  const char* paths[2] = {nullptr, nullptr};
+  size_t path_count = 0;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--binary-input") == 0) {
+      input_format = speedofsound::LogFormat::kBinary;
+    } else if (strcmp(argv[i], "--binary-output") == 0) {
+      output_format = speedofsound::LogFormat::kBinary;
+    } else if (strcmp(argv[i], "--approximate") == 0 && i + 1 < argc) {
+      engine = speedofsound::LogEngine::kApproximate;
+      char* end = nullptr;
+      tolerance = strtod(argv[++i], &end);
+      if (end == argv[i] || *end != '\0' || !(tolerance > 0.0)) {
+        fprintf(stderr, "Invalid tolerance: %s\n", argv[i]);
+        return EXIT_FAILURE;
+      }
+    } else if (argv[i][0] == '-' || path_count == 2) {
+      return Usage(argv[0]);
+    } else {
+      paths[path_count++] = argv[i];
+    }
+  }
+  if (path_count == 0) return Usage(argv[0]);
+  speedofsound::LogReader reader;
+  if (!reader.Open(paths[0], input_format)) {
+    fprintf(stderr, "Cannot open %s\n", paths[0]);
+    return EXIT_FAILURE;
+  }
+  auto file = paths[1] != nullptr ? fopen(paths[1], "wb") : stdout;
+  if (file == nullptr) {
+    fprintf(stderr, "Cannot open %s\n", paths[1]);
+    return EXIT_FAILURE;
+  }
+  speedofsound::LogWriter writer(file, output_format);
+  speedofsound::LogStatistics statistics;
+  const auto start = std::chrono::steady_clock::now();
+  auto ok = speedofsound::ProcessLog(&reader, &writer, engine, tolerance,
+                                     &statistics);
+  if (file != stdout) ok = fclose(file) == 0 && ok;
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  if (reader.HasError()) {
+    fprintf(stderr, "Malformed record at line %zu\n", reader.GetErrorLine());
+  } else if (!ok) {
+    fprintf(stderr, "Cannot write the output\n");
+  }
+  fprintf(stderr,
+          "%zu records (%zu invalid), %zu bytes in %.3f s, %.3f GB/s\n",
+          statistics.records_, statistics.invalid_records_,
+          statistics.bytes_read_, elapsed.count(),
+          statistics.bytes_read_ / elapsed.count() * 1.0e-9);
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}